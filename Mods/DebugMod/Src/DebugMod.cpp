@@ -58,9 +58,7 @@ void DebugMod::OnEngineInitialized()
     const ZMemberDelegate<DebugMod, void(const SGameUpdateEvent&)> s_Delegate(this, &DebugMod::OnFrameUpdate);
     Globals::GameLoopManager->RegisterFrameUpdate(s_Delegate, 1, EUpdateMode::eUpdatePlayMode);
 
-    std::thread thread(LoadHashMap);
-
-    thread.detach();
+    LoadHashMap();
 }
 
 void DebugMod::OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent)
@@ -636,63 +634,31 @@ void DebugMod::LoadRepositoryProps()
 
 void DebugMod::LoadHashMap()
 {
-    // TODO: Re-do.
-
-    /*if (!std::filesystem::exists("hash_list.txt"))
-    {
-        DownloadHashMap();
-
-        //LZMA::Extract();
-    }
-
-    auto s_InputFile = std::ifstream("hash_list.txt", std::ios::binary | std::ios::ate);
+    // The hash list is memory-mapped and only its header is checked here, so this doesn't read the file.
+    // It isn't shipped with the mod: see the DebugMod readme for how to create it with Tools/HashListConverter.
+    const std::filesystem::path s_HashListPath = std::filesystem::current_path() / "hash_list.hhl";
 
-    if (s_InputFile.fail())
+    if (!std::filesystem::exists(s_HashListPath))
     {
+        Logger::Warn(
+            "Hash list not found at '{}'. Resource hashes will be shown instead of paths. "
+            "Convert hash_list.txt with HashListConverter and place it there to show paths.",
+            s_HashListPath.string()
+        );
         return;
     }
 
-    const auto s_FileSize = static_cast<uint64_t>(s_InputFile.tellg());
-
-    s_InputFile.seekg(0, s_InputFile.beg);
-
-    std::vector<char> s_Data(s_FileSize, 0);
-
-    s_InputFile.read(s_Data.data(), s_FileSize);
-
-    uint64_t s_Position = 0;
-    uint64_t s_LastPosition = 0;
-    uint64_t s_LineCount = 0;
-
-    mutex.lock();
-
-    while (s_Position < s_Data.size())
+    if (!m_HashList.Load(s_HashListPath.string()))
     {
-        if (s_Data[s_Position] == 0x0A)
-        {
-            s_LineCount++;
-
-            s_Data[s_Position] = 0x0;
-
-            if (s_LineCount > 3)
-            {
-                const auto s_StringView = std::string_view(&s_Data[s_LastPosition]);
-                const size_t s_Index = s_StringView.find_first_of(',');
-
-                auto s_Hash = std::string(s_StringView.substr(0, (s_Index - 5)));
-                const auto s_ResourceId = std::string(s_StringView.substr(s_Index + 1, s_StringView.length() - (s_Index + 1)));
-
-                runtimeResourceIDsToResourceIDs[std::stoull(s_Hash, nullptr, 16)] = s_ResourceId;
-
-            }
-
-            s_LastPosition = s_Position + 1;
-        }
-
-        s_Position++;
+        Logger::Error(
+            "Hash list at '{}' could not be read or is not a valid hash list. "
+            "Convert hash_list.txt again with HashListConverter.",
+            s_HashListPath.string()
+        );
+        return;
     }
 
-    mutex.unlock();*/
+    Logger::Info("Loaded hash list with {} entries from '{}'.", m_HashList.GetSize(), s_HashListPath.string());
 }
 
 void DebugMod::DownloadHashMap()
@@ -794,6 +760,54 @@ std::string DebugMod::FindNPCEntityNameInBrickBackReferences(
     unsigned long long p_EntityId,
     unsigned long long& p_ResourceHash
 )
+{
+    std::string s_EntityName;
+    ZResourceContainer* s_ResourceContainer = *Globals::ResourceContainer;
+    std::vector<ZRuntimeResourceID> s_Referrers;
+
+    // The index isn't built until the game thread gets to it, and doesn't cover bricks loaded since,
+    // so scan every resource until it does.
+    if (!SDK()->GetResourceReferrers(ZRuntimeResourceID(p_TempBrickHash), s_Referrers))
+    {
+        return ScanNPCEntityNameInBrickBackReferences(p_TempBrickHash, p_EntityId, p_ResourceHash);
+    }
+
+    for (const ZRuntimeResourceID& s_Referrer : s_Referrers)
+    {
+        const unsigned long long s_ResourceHash2 = s_Referrer.GetID();
+        const auto s_ResourceIndex = s_ResourceContainer->m_indices.find(s_Referrer);
+
+        if (s_ResourceIndex == s_ResourceContainer->m_indices.end())
+        {
+            continue;
+        }
+
+        const ZResourceContainer::SResourceInfo& s_ResourceInfo = s_ResourceContainer->m_resources[s_ResourceIndex->second.val];
+
+        if (s_ResourceInfo.resourceType != 'TEMP')
+        {
+            continue;
+        }
+
+        if (IsNPCBrickEntityType(s_ResourceHash2))
+        {
+            s_EntityName = GetEntityName(s_ResourceHash2, p_EntityId, p_ResourceHash);
+
+            if (!s_EntityName.empty())
+            {
+                break;
+            }
+        }
+    }
+
+    return s_EntityName;
+}
+
+std::string DebugMod::ScanNPCEntityNameInBrickBackReferences(
+    unsigned long long p_TempBrickHash,
+    unsigned long long p_EntityId,
+    unsigned long long& p_ResourceHash
+)
 {
     std::string s_EntityName;
     ZResourceContainer* s_ResourceContainer = *Globals::ResourceContainer;
@@ -805,27 +819,23 @@ std::string DebugMod::FindNPCEntityNameInBrickBackReferences(
 
         if (s_ResourceInfo->resourceType == 'TEMP' &&
             s_ResourceInfo->numReferences > 0 &&
-            m_RuntimeResourceIDsToResourceIDs.contains(s_ResourceHash2) &&
-            m_RuntimeResourceIDsToResourceIDs[s_ResourceHash2].ends_with(".brick].pc_entitytype") &&
-            m_RuntimeResourceIDsToResourceIDs[s_ResourceHash2].contains("/npc_"))
+            IsNPCBrickEntityType(s_ResourceHash2))
         {
-            const ZResourceIndex s_ResourceIndex = s_ResourceContainer->m_indices.find(s_ResourceInfo->rid)->second;
             TArray<ZResourceIndex> s_ReferenceIndices;
             TArray<unsigned char> s_ReferenceFlags;
 
-            Functions::ZResourceContainer_GetResourceReferences->Call(s_ResourceContainer, ZResourceIndex(s_ResourceIndex), s_ReferenceIndices, s_ReferenceFlags);
+            Functions::ZResourceContainer_GetResourceReferences->Call(s_ResourceContainer, ZResourceIndex(i), s_ReferenceIndices, s_ReferenceFlags);
 
             for (size_t j = 0; j < s_ReferenceIndices.size(); ++j)
             {
-                const size_t s_ReferenceIndex = s_ReferenceIndices[j].val;
+                const int s_ReferenceIndex = s_ReferenceIndices[j].val;
 
                 if (s_ReferenceIndex == -1)
                 {
                     continue;
                 }
 
-                ZResourceContainer::SResourceInfo s_ReferenceInfo = s_ResourceContainer->m_resources[s_ReferenceIndex];
-                const unsigned long long s_ReferenceHash = s_ReferenceInfo.rid.GetID();
+                const unsigned long long s_ReferenceHash = s_ResourceContainer->m_resources[s_ReferenceIndex].rid.GetID();
 
                 if (s_ReferenceHash == p_TempBrickHash)
                 {
@@ -848,6 +858,13 @@ std::string DebugMod::FindNPCEntityNameInBrickBackReferences(
     return s_EntityName;
 }
 
+bool DebugMod::IsNPCBrickEntityType(unsigned long long p_ResourceHash) const
+{
+    const std::string_view s_ResourcePath = m_HashList.Find(p_ResourceHash);
+
+    return s_ResourcePath.ends_with(".brick].pc_entitytype") && s_ResourcePath.contains("/npc_");
+}
+
 std::string DebugMod::ConvertDynamicObjectValueTString(ZDynamicObject* p_DynamicObject)
 {
     std::string s_Result;
@@ -14,6 +14,7 @@
 
 #include "ImGuizmo.h"
 #include "Glacier/ZScene.h"
+#include "IO/ZHashList.h"
 
 class ZGlobalOutfitKit;
 class ZHitman5;
@@ -56,6 +57,8 @@ private:
     static void DownloadHashMap();
     std::string GetEntityName(unsigned long long p_TempBrickHash, unsigned long long p_EntityId, unsigned long long& p_ResourceHash);
     std::string FindNPCEntityNameInBrickBackReferences(unsigned long long p_TempBrickHash, unsigned long long p_EntityId, unsigned long long& p_ResourceHash);
+    std::string ScanNPCEntityNameInBrickBackReferences(unsigned long long p_TempBrickHash, unsigned long long p_EntityId, unsigned long long& p_ResourceHash);
+    bool IsNPCBrickEntityType(unsigned long long p_ResourceHash) const;
 
     std::string ConvertDynamicObjectValueTString(ZDynamicObject* p_DynamicObject);
     void LoadResourceData(unsigned long long p_Hash, std::vector<char>& p_ResourceData);
@@ -116,7 +119,7 @@ private:
     std::multimap<std::string, ZRepositoryID> m_RepositoryProps;
     const char* m_CharSetCharacterTypes[3] = { "Actor", "Nude", "HeroA" };
 
-    inline static std::unordered_map<unsigned long long, std::string> m_RuntimeResourceIDsToResourceIDs;
+    inline static ZHashList m_HashList;
     inline static std::mutex m_Mutex;
 
     ZHM5CrippleBox* m_Hm5CrippleBox = nullptr;
@@ -76,18 +76,18 @@ void DebugMod::DrawEntityBox(bool p_HasFocus)
             ImGui::TextUnformatted(fmt::format("Entity Name: {}", m_SelectedEntityName).c_str());
             ImGui::TextUnformatted(fmt::format("Entity ID: {:016x}", m_EntityId).c_str());
 
-            if (m_RuntimeResourceIDsToResourceIDs.contains(m_SelectedResourceHash))
+            if (const std::string_view s_Path = m_HashList.Find(m_SelectedResourceHash); !s_Path.empty())
             {
-                ImGui::TextUnformatted(fmt::format("Template Entity: {}", m_RuntimeResourceIDsToResourceIDs[m_SelectedResourceHash]).c_str());
+                ImGui::TextUnformatted(fmt::format("Template Entity: {}", s_Path).c_str());
             }
             else
             {
                 ImGui::TextUnformatted(fmt::format("Template Entity: {}", m_SelectedResourceHash).c_str());
             }
 
-            if (m_RuntimeResourceIDsToResourceIDs.contains(m_BrickEntityId))
+            if (const std::string_view s_Path = m_HashList.Find(m_BrickEntityId); !s_Path.empty())
             {
-                ImGui::TextUnformatted(fmt::format("Brick Template Entity: {}", m_RuntimeResourceIDsToResourceIDs[m_BrickEntityId]).c_str());
+                ImGui::TextUnformatted(fmt::format("Brick Template Entity: {}", s_Path).c_str());
             }
             else
             {
@@ -102,9 +102,9 @@ void DebugMod::DrawEntityBox(bool p_HasFocus)
                 ZResourceContainer::SResourceInfo s_PrimResourceInfo = (*Globals::ResourceContainer)->m_resources[s_Property.Get().m_nResourceIndex];
                 unsigned long long s_PrimHash = s_PrimResourceInfo.rid.GetID();
 
-                if (m_RuntimeResourceIDsToResourceIDs.contains(s_PrimHash))
+                if (const std::string_view s_Path = m_HashList.Find(s_PrimHash); !s_Path.empty())
                 {
-                    ImGui::TextUnformatted(fmt::format("PRIM Assembly Path: {}", m_RuntimeResourceIDsToResourceIDs[s_PrimHash]).c_str());
+                    ImGui::TextUnformatted(fmt::format("PRIM Assembly Path: {}", s_Path).c_str());
                 }
                 else
                 {
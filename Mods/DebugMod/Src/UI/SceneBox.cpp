@@ -17,21 +17,32 @@ void DebugMod::DrawSceneBox(bool p_HasFocus)
     {
         static size_t s_Selected = 0;
         const ZEntitySceneContext* s_EntitySceneContext = Globals::Hitman5Module->m_pEntitySceneContext;
-        const std::string s_EntityTemplate = m_RuntimeResourceIDsToResourceIDs[s_EntitySceneContext->m_SceneConfig.m_ridSceneFactory.GetID()];
-        const std::string s_EntityBlueprint = std::format("{}.pc_entityblueprint", s_EntityTemplate.substr(0, s_EntityTemplate.find_last_of(".")));
+        const uint64_t s_SceneFactoryHash = s_EntitySceneContext->m_SceneConfig.m_ridSceneFactory.GetID();
+        const std::string_view s_SceneFactoryPath = m_HashList.Find(s_SceneFactoryHash);
+
+        // Without a hash list (or for unknown hashes) the resource ids are shown instead of paths.
+        const std::string s_EntityTemplate = s_SceneFactoryPath.empty()
+            ? std::format("{:016X}", s_SceneFactoryHash)
+            : std::string(s_SceneFactoryPath);
+        const std::string s_EntityBlueprint = s_SceneFactoryPath.empty()
+            ? "unknown"
+            : std::format("{}.pc_entityblueprint", s_SceneFactoryPath.substr(0, s_SceneFactoryPath.find_last_of(".")));
 
         ImGui::Text("Scene name: %s", s_EntitySceneContext->m_sceneData.m_sceneName.c_str());
         ImGui::Text("Type: %s", s_EntitySceneContext->m_sceneData.m_type.c_str());
         ImGui::Text("Code Name Hint: %s", s_EntitySceneContext->m_sceneData.m_codeNameHint.c_str());
-        ImGui::Text("Entity Template: %s", s_EntityTemplate);
-        ImGui::Text("Entity Blueprint: %s", s_EntityBlueprint);
+        ImGui::Text("Entity Template: %s", s_EntityTemplate.c_str());
+        ImGui::Text("Entity Blueprint: %s", s_EntityBlueprint.c_str());
 
         ImGui::BeginChild("left pane", ImVec2(300, 0), true, ImGuiWindowFlags_HorizontalScrollbar);
 
         for (int i = 0; i < s_EntitySceneContext->m_aLoadedBricks.size(); ++i)
         {
             ZRuntimeResourceID s_RuntimeResourceId = s_EntitySceneContext->m_aLoadedBricks[i].runtimeResourceID;
-            std::string s_ResourceId = m_RuntimeResourceIDsToResourceIDs[s_RuntimeResourceId.GetID()];
+            const std::string_view s_Path = m_HashList.Find(s_RuntimeResourceId.GetID());
+            const std::string s_ResourceId = s_Path.empty()
+                ? std::format("{:016X}", s_RuntimeResourceId.GetID())
+                : std::string(s_Path);
 
             if (ImGui::Selectable(s_ResourceId.c_str(), s_Selected == i))
             {
@@ -8,7 +8,6 @@
 
 #include <ResourceLib_HM3.h>
 
-#include <queue>
 #include <utility>
 
 ZEntityRef Editor::FindEntity(EntitySelector p_Selector) {
@@ -30,59 +29,8 @@ ZEntityRef Editor::FindEntity(EntitySelector p_Selector) {
 	}
 
 	// Otherwise we're selecting from the entity tree.
-	const ZRuntimeResourceID s_TBLU = p_Selector.TbluHash.value();
-
-	// Create a queue and add the root to it.
-	std::queue<std::shared_ptr<EntityTreeNode>> s_NodeQueue;
-	s_NodeQueue.push(m_CachedEntityTree);
-
-	// Keep track of the last node that matched the entity ID, but not the TBLU.
-	std::shared_ptr<EntityTreeNode> s_IdMatchedNode = nullptr;
-
-	// Keep iterating through the tree until we find the node we're looking for.
-	while (!s_NodeQueue.empty()) {
-		// Access the first node in the queue
-		auto s_Node = s_NodeQueue.front();
-		s_NodeQueue.pop();
-
-		if (s_Node->EntityId == p_Selector.EntityId) {
-			bool s_Matches = s_Node->TBLU == s_TBLU;
-
-			// If the TBLU doesn't match, then check the owner entity.
-			if (!s_Matches) {
-				const auto s_OwningEntity = s_Node->Entity.GetOwningEntity();
-
-				if (s_OwningEntity && s_OwningEntity.GetBlueprintFactory()) {
-					s_Matches = s_OwningEntity.GetBlueprintFactory()->m_ridResource == s_TBLU;
-				}
-			}
-
-			// If it's not that either, try our own factory.
-			if (!s_Matches) {
-				const auto s_Factory = s_Node->Entity.GetBlueprintFactory();
-
-				if (s_Factory) {
-					s_Matches = s_Factory->m_ridResource == s_TBLU;
-				}
-			}
-
-			// Found the node we're looking for!
-			if (s_Matches) {
-				return s_Node->Entity;
-			}
-
-			// Otherwise, keep track of the last node that matched the entity ID.
-			s_IdMatchedNode = s_Node;
-		}
-
-		// If not found, add children to the queue.
-		for (auto& childPair : s_Node->Children) {
-			s_NodeQueue.push(childPair.second);
-		}
-	}
-
-	if (s_IdMatchedNode) {
-		return s_IdMatchedNode->Entity;
+	if (const auto s_Node = m_CachedEntityTreeIndex.Find(p_Selector.EntityId, p_Selector.TbluHash.value())) {
+		return s_Node->Entity;
 	}
 
 	return {};
@@ -111,7 +59,14 @@ void Editor::SpawnEntity(ZRuntimeResourceID p_Template, uint64_t p_EntityId, std
 }
 
 void Editor::DestroyEntity(EntitySelector p_Selector, std::optional<std::string> p_ClientId) {
+	const auto s_Entity = FindEntity(p_Selector);
+
+	if (!s_Entity) {
+		throw std::runtime_error("Could not find entity for the given selector.");
+	}
 
+	// Nothing may sample the entity once it is destroyed.
+	m_Server.ReleaseEntity(s_Entity);
 }
 
 void Editor::SetEntityName(EntitySelector p_Selector, std::string p_Name, std::optional<std::string> p_ClientId) {
@@ -124,66 +79,70 @@ void Editor::SetEntityName(EntitySelector p_Selector, std::string p_Name, std::o
 
 void Editor::SetEntityProperty(EntitySelector p_Selector, uint32_t p_PropertyId, std::string_view p_JsonValue, std::optional<std::string> p_ClientId) {
 	if (const auto s_Entity = FindEntity(p_Selector)) {
-		auto s_EntityType = s_Entity->GetType();
-		auto s_Property = s_EntityType->FindProperty(p_PropertyId);
+		SetEntityProperty(s_Entity, p_PropertyId, p_JsonValue, std::move(p_ClientId));
+	} else {
+		throw std::runtime_error("Could not find entity for the given selector.");
+	}
+}
 
-		if (!s_Property) {
-			throw std::runtime_error("Could not find property for the given ID.");
-		}
+void Editor::SetEntityProperty(ZEntityRef p_Entity, uint32_t p_PropertyId, std::string_view p_JsonValue, std::optional<std::string> p_ClientId) {
+	auto s_EntityType = p_Entity->GetType();
+	auto s_Property = s_EntityType->FindProperty(p_PropertyId);
 
-		if (!s_Property->m_pType || !s_Property->m_pType->getPropertyInfo() || !s_Property->m_pType->getPropertyInfo()->m_pType) {
-			throw std::runtime_error("Unable to set this property because its type information is missing from the game.");
-		}
+	if (!s_Property) {
+		throw std::runtime_error("Could not find property for the given ID.");
+	}
 
-		const auto s_PropertyInfo = s_Property->m_pType->getPropertyInfo();
+	if (!s_Property->m_pType || !s_Property->m_pType->getPropertyInfo() || !s_Property->m_pType->getPropertyInfo()->m_pType) {
+		throw std::runtime_error("Unable to set this property because its type information is missing from the game.");
+	}
 
-		if (s_PropertyInfo->m_pType->typeInfo()->isEntity()) {
-			if (p_JsonValue == "null") {
-				TEntityRef<ZEntityImpl> s_EntityRef;
-				OnSetPropertyValue(s_Entity, p_PropertyId, ZObjectRef(s_PropertyInfo->m_pType, &s_EntityRef), std::move(p_ClientId));
-			} else {
-				// Parse EntitySelector
-				simdjson::ondemand::parser s_Parser;
-				const auto s_EntitySelectorJson = simdjson::padded_string(p_JsonValue);
-				simdjson::ondemand::document s_EntitySelectorMsg = s_Parser.iterate(s_EntitySelectorJson);
-
-				const auto s_EntitySelector = EditorServer::ReadEntitySelector(s_EntitySelectorMsg);
-
-				if (const auto s_TargetEntity = FindEntity(s_EntitySelector)) {
-					TEntityRef<ZEntityImpl> s_EntityRef(s_TargetEntity);
-					OnSetPropertyValue(s_Entity, p_PropertyId, ZObjectRef(s_PropertyInfo->m_pType, &s_EntityRef), std::move(p_ClientId));
-				} else {
-					throw std::runtime_error("Could not find entity for the given selector.");
-				}
-			}
+	const auto s_PropertyInfo = s_Property->m_pType->getPropertyInfo();
+
+	if (s_PropertyInfo->m_pType->typeInfo()->isEntity()) {
+		if (p_JsonValue == "null") {
+			TEntityRef<ZEntityImpl> s_EntityRef;
+			OnSetPropertyValue(p_Entity, p_PropertyId, ZObjectRef(s_PropertyInfo->m_pType, &s_EntityRef), std::move(p_ClientId));
 		} else {
-			const uint16_t s_TypeSize = s_PropertyInfo->m_pType->typeInfo()->m_nTypeSize;
-			const uint16_t s_TypeAlignment = s_PropertyInfo->m_pType->typeInfo()->m_nTypeAlignment;
-			const std::string s_TypeName = s_PropertyInfo->m_pType->typeInfo()->m_pTypeName;
-
-			void* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(
-				s_TypeSize,
-				s_TypeAlignment
-			);
-
-			const bool s_Success = HM3_JsonToGameStruct(
-				s_TypeName.c_str(),
-				p_JsonValue.data(),
-				p_JsonValue.size(),
-				s_Data,
-				s_TypeSize
-			);
-
-			if (!s_Success) {
-				(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
-				throw std::runtime_error("Unable to convert JSON to game struct.");
-			}
+			// Parse EntitySelector
+			simdjson::ondemand::parser s_Parser;
+			const auto s_EntitySelectorJson = simdjson::padded_string(p_JsonValue);
+			simdjson::ondemand::document s_EntitySelectorMsg = s_Parser.iterate(s_EntitySelectorJson);
 
-			OnSetPropertyValue(s_Entity, p_PropertyId, ZObjectRef(s_PropertyInfo->m_pType, s_Data), std::move(p_ClientId));
-			(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
+			const auto s_EntitySelector = EditorServer::ReadEntitySelector(s_EntitySelectorMsg);
+
+			if (const auto s_TargetEntity = FindEntity(s_EntitySelector)) {
+				TEntityRef<ZEntityImpl> s_EntityRef(s_TargetEntity);
+				OnSetPropertyValue(p_Entity, p_PropertyId, ZObjectRef(s_PropertyInfo->m_pType, &s_EntityRef), std::move(p_ClientId));
+			} else {
+				throw std::runtime_error("Could not find entity for the given selector.");
+			}
 		}
 	} else {
-		throw std::runtime_error("Could not find entity for the given selector.");
+		const uint16_t s_TypeSize = s_PropertyInfo->m_pType->typeInfo()->m_nTypeSize;
+		const uint16_t s_TypeAlignment = s_PropertyInfo->m_pType->typeInfo()->m_nTypeAlignment;
+		const std::string s_TypeName = s_PropertyInfo->m_pType->typeInfo()->m_pTypeName;
+
+		void* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(
+			s_TypeSize,
+			s_TypeAlignment
+		);
+
+		const bool s_Success = HM3_JsonToGameStruct(
+			s_TypeName.c_str(),
+			p_JsonValue.data(),
+			p_JsonValue.size(),
+			s_Data,
+			s_TypeSize
+		);
+
+		if (!s_Success) {
+			(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
+			throw std::runtime_error("Unable to convert JSON to game struct.");
+		}
+
+		OnSetPropertyValue(p_Entity, p_PropertyId, ZObjectRef(s_PropertyInfo->m_pType, s_Data), std::move(p_ClientId));
+		(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
 	}
 }
 
@@ -197,4 +156,187 @@ void Editor::SignalEntityPin(EntitySelector p_Selector, uint32_t p_PinId, bool p
 
 void Editor::RebuildEntityTree() {
 	UpdateEntities();
-}
\ No newline at end of file
+}
+
+void Editor::QueueCommandBatch(EditorCommandBatch p_Batch) {
+	std::scoped_lock s_Lock(m_PendingCommandBatchesMutex);
+	m_PendingCommandBatches.push_back(std::move(p_Batch));
+}
+
+void Editor::ApplyPendingCommandBatches() {
+	std::vector<EditorCommandBatch> s_Batches;
+
+	{
+		std::scoped_lock s_Lock(m_PendingCommandBatchesMutex);
+		s_Batches.swap(m_PendingCommandBatches);
+	}
+
+	for (const auto& s_Batch : s_Batches) {
+		m_Server.OnCommandBatchApplied(s_Batch.ClientId, s_Batch.MessageId, ApplyCommandBatch(s_Batch));
+	}
+}
+
+EditorCommandBatchResult Editor::ApplyCommandBatch(const EditorCommandBatch& p_Batch) {
+	EditorCommandBatchResult s_Result;
+
+	// Entities are resolved up front, so an atomic batch with a bad selector fails before anything is changed.
+	std::vector<ZEntityRef> s_Entities(p_Batch.Commands.size());
+
+	for (size_t i = 0; i < p_Batch.Commands.size(); ++i) {
+		s_Entities[i] = FindEntity(p_Batch.Commands[i].Entity);
+
+		if (!s_Entities[i]) {
+			s_Result.Errors.emplace_back(i, "Could not find entity for the given selector.");
+		}
+	}
+
+	if (p_Batch.Atomic && !s_Result.Errors.empty()) {
+		return s_Result;
+	}
+
+	std::vector<CommandUndo> s_Undos;
+
+	for (size_t i = 0; i < p_Batch.Commands.size(); ++i) {
+		if (!s_Entities[i]) {
+			continue;
+		}
+
+		try {
+			auto s_Undo = ApplyCommand(p_Batch.Commands[i], s_Entities[i], p_Batch.ClientId);
+			++s_Result.Applied;
+
+			if (p_Batch.Atomic) {
+				s_Undos.push_back(std::move(s_Undo));
+			} else {
+				FreeCommandUndo(s_Undo);
+			}
+		} catch (const std::exception& e) {
+			s_Result.Errors.emplace_back(i, e.what());
+
+			if (p_Batch.Atomic) {
+				break;
+			}
+		}
+	}
+
+	if (p_Batch.Atomic && !s_Result.Errors.empty()) {
+		for (auto it = s_Undos.rbegin(); it != s_Undos.rend(); ++it) {
+			UndoCommand(*it, p_Batch.ClientId);
+		}
+
+		s_Result.RolledBack = !s_Undos.empty();
+		s_Result.Applied = 0;
+	}
+
+	for (auto& s_Undo : s_Undos) {
+		FreeCommandUndo(s_Undo);
+	}
+
+	return s_Result;
+}
+
+Editor::CommandUndo Editor::ApplyCommand(const EditorCommand& p_Command, ZEntityRef p_Entity, const std::string& p_ClientId) {
+	CommandUndo s_Undo {
+		.Kind = p_Command.Kind,
+		.Entity = p_Entity,
+	};
+
+	switch (p_Command.Kind) {
+		case EEditorCommandKind::SetEntityTransform: {
+			auto* s_Spatial = p_Entity.QueryInterface<ZSpatialEntity>();
+
+			if (!s_Spatial) {
+				throw std::runtime_error("The entity doesn't have a transform.");
+			}
+
+			s_Undo.WorldTransform = s_Spatial->GetWorldMatrix();
+			OnEntityTransformChange(p_Entity, p_Command.Transform, p_Command.Relative, p_ClientId);
+			break;
+		}
+		case EEditorCommandKind::SetEntityName: {
+			{
+				std::shared_lock s_Lock(m_CachedEntityTreeMutex);
+
+				if (const auto it = m_EntityNames.find(p_Entity); it != m_EntityNames.end()) {
+					s_Undo.Name = it->second;
+				}
+			}
+
+			OnEntityNameChange(p_Entity, p_Command.Name, p_ClientId);
+			break;
+		}
+		case EEditorCommandKind::SetEntityProperty: {
+			const auto s_EntityType = p_Entity->GetType();
+			const auto s_Property = s_EntityType ? s_EntityType->FindProperty(p_Command.PropertyId) : nullptr;
+
+			if (!s_Property) {
+				throw std::runtime_error("Could not find property for the given ID.");
+			}
+
+			if (!s_Property->m_pType || !s_Property->m_pType->getPropertyInfo() || !s_Property->m_pType->getPropertyInfo()->m_pType) {
+				throw std::runtime_error("Unable to set this property because its type information is missing from the game.");
+			}
+
+			const auto s_PropertyInfo = s_Property->m_pType->getPropertyInfo();
+			const auto s_TypeInfo = s_PropertyInfo->m_pType->typeInfo();
+			const auto s_PropertyAddress = reinterpret_cast<uintptr_t>(p_Entity.m_pEntity) + s_Property->m_nOffset;
+
+			// Keep a copy of the current value to restore it from.
+			s_Undo.PropertyId = p_Command.PropertyId;
+			s_Undo.PropertyType = s_PropertyInfo->m_pType;
+			s_Undo.PropertyValue = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(s_TypeInfo->m_nTypeSize, s_TypeInfo->m_nTypeAlignment);
+
+			if (s_PropertyInfo->m_nFlags & EPropertyInfoFlags::E_HAS_GETTER_SETTER) {
+				s_PropertyInfo->get(reinterpret_cast<void*>(s_PropertyAddress), s_Undo.PropertyValue, s_PropertyInfo->m_nOffset);
+			} else {
+				s_TypeInfo->m_pTypeFunctions->copyConstruct(s_Undo.PropertyValue, reinterpret_cast<void*>(s_PropertyAddress));
+			}
+
+			try {
+				SetEntityProperty(p_Entity, p_Command.PropertyId, p_Command.JsonValue, p_ClientId);
+			} catch (...) {
+				FreeCommandUndo(s_Undo);
+				throw;
+			}
+
+			break;
+		}
+	}
+
+	return s_Undo;
+}
+
+void Editor::UndoCommand(const CommandUndo& p_Undo, const std::string& p_ClientId) {
+	switch (p_Undo.Kind) {
+		case EEditorCommandKind::SetEntityTransform:
+			OnEntityTransformChange(p_Undo.Entity, p_Undo.WorldTransform, false, p_ClientId);
+			break;
+		case EEditorCommandKind::SetEntityName:
+			if (p_Undo.Name) {
+				OnEntityNameChange(p_Undo.Entity, *p_Undo.Name, p_ClientId);
+			} else {
+				// The entity didn't have a custom name before.
+				{
+					std::scoped_lock s_Lock(m_CachedEntityTreeMutex);
+					m_EntityNames.erase(p_Undo.Entity);
+				}
+
+				m_Server.OnEntityNameChanged(p_Undo.Entity, p_ClientId);
+			}
+
+			break;
+		case EEditorCommandKind::SetEntityProperty:
+			OnSetPropertyValue(p_Undo.Entity, p_Undo.PropertyId, ZObjectRef(p_Undo.PropertyType, p_Undo.PropertyValue), p_ClientId);
+			break;
+	}
+}
+
+void Editor::FreeCommandUndo(CommandUndo& p_Undo) {
+	if (!p_Undo.PropertyValue) {
+		return;
+	}
+
+	p_Undo.PropertyType->typeInfo()->m_pTypeFunctions->destruct(p_Undo.PropertyValue);
+	(*Globals::MemoryManager)->m_pNormalAllocator->Free(p_Undo.PropertyValue);
+	p_Undo.PropertyValue = nullptr;
+}
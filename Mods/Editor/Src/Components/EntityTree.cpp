@@ -9,65 +9,22 @@
 #include "IconsMaterialDesign.h"
 #include "Logging.h"
 
+#include <algorithm>
+#include <execution>
 #include <shared_mutex>
 #include <queue>
 #include <map>
+#include <unordered_set>
 #include <utility>
 
-void Editor::UpdateEntities() {
-	const auto s_SceneCtx = Globals::Hitman5Module->m_pEntitySceneContext;
-
-	if (!s_SceneCtx
-	    || !s_SceneCtx->m_pScene
-	    || !s_SceneCtx->m_pScene.m_ref
-	    || s_SceneCtx->m_aLoadedBricks.size() == 0) {
-		return;
-	}
-
-	const auto s_SceneEnt = s_SceneCtx->m_pScene.m_ref;
-
-	// Go through a first pass by creating all the nodes of the tree using a BFS
-	// approach. We'll also opportunistically assign children nodes to parents we've
-	// seen before. Then, as a second pass we'll go through and assign the remaining
-	// children nodes to their parents.
-
-	std::unordered_map<ZEntityRef, std::shared_ptr<EntityTreeNode>> s_NodeMap;
+// Collects the entities spawned by a brick in breadth-first order. Runs on a worker thread,
+// so it only reads from the game and keeps everything it finds local.
+static std::vector<EntityTreeNodeInfo> CollectBrickEntities(ZEntityBlueprintFactoryBase* p_BrickFactory, ZEntityRef p_BrickEntity) {
+	std::vector<EntityTreeNodeInfo> s_Entities;
+	std::unordered_set<ZEntityRef> s_SeenEntities;
 	std::queue<std::pair<ZEntityBlueprintFactoryBase*, ZEntityRef>> s_NodeQueue;
-	std::queue<std::shared_ptr<EntityTreeNode>> s_ParentlessNodes;
-
-	// Add all the brick nodes to the queue.
-	for (const auto& s_Brick: s_SceneCtx->m_aLoadedBricks) {
-		auto s_BrickEnt = s_Brick.entityRef;
-
-		if (!s_BrickEnt) {
-			continue;
-		}
-
-		const auto s_BpFactory = s_BrickEnt.GetBlueprintFactory();
-
-		if (!s_BpFactory) {
-			continue;
-		}
-
-		s_NodeQueue.emplace(s_BpFactory, s_BrickEnt);
-	}
-
-	auto s_SceneFactory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_SceneEnt.GetBlueprintFactory());
-
-	if (s_SceneEnt.GetOwningEntity()) {
-		s_SceneFactory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_SceneEnt.GetOwningEntity().GetBlueprintFactory());
-	}
 
-	// Create the root scene node.
-	auto s_SceneNode = std::make_shared<EntityTreeNode>(
-		"Scene Root",
-		s_SceneEnt->GetType()->m_nEntityId,
-		s_SceneFactory->m_ridResource,
-		s_SceneEnt
-	);
-
-	s_NodeMap.emplace(s_SceneEnt, s_SceneNode);
-	s_NodeMap.emplace(ZEntityRef(), s_SceneNode);
+	s_NodeQueue.emplace(p_BrickFactory, p_BrickEntity);
 
 	while (!s_NodeQueue.empty()) {
 		// Pop the next factory and its root entity off the queue.
@@ -77,7 +34,7 @@ void Editor::UpdateEntities() {
 		const auto s_SubEntityCount = s_CurrentFactory->GetSubEntitiesCount();
 		const bool s_IsTemplateFactory = s_CurrentFactory->IsTemplateEntityBlueprintFactory();
 
-		// Go through each of its sub-entities and create nodes for them.
+		// Go through each of its sub-entities and collect them.
 		for (int i = 0; i < s_SubEntityCount; ++i) {
 			const ZEntityRef s_SubEntity = s_CurrentFactory->GetSubEntity(s_CurrentRoot.m_pEntity, i);
 			const auto s_SubEntityFactory = s_CurrentFactory->GetSubEntityBlueprint(i);
@@ -86,106 +43,150 @@ void Editor::UpdateEntities() {
 				continue;
 			}
 
-			// If this sub-entity has already been added to the tree, skip it.
-			if (s_NodeMap.contains(s_SubEntity)) {
+			// If this sub-entity has already been collected, skip it.
+			if (!s_SeenEntities.insert(s_SubEntity).second) {
 				continue;
 			}
 
-			const auto s_SubEntityId = s_SubEntity->GetType()->m_nEntityId;
-			std::string s_EntityName = "<noname>";
+			std::string_view s_EntityName = "<noname>";
 
 			// If our current factory is a template factory, we can get the name of the entity from it.
 			if (s_IsTemplateFactory) {
 				const auto s_TemplateBpFactory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_CurrentFactory);
 
 				if (s_TemplateBpFactory->m_pTemplateEntityBlueprint) {
-					s_EntityName = s_TemplateBpFactory->m_pTemplateEntityBlueprint->subEntities[i].entityName;
+					const auto& s_Name = s_TemplateBpFactory->m_pTemplateEntityBlueprint->subEntities[i].entityName;
+					s_EntityName = std::string_view(s_Name.c_str(), s_Name.size());
 				}
 			}
 
-			// Format a human-readable name for the entity.
-			const auto s_EntityTypeName = s_SubEntity->GetType()->m_pInterfaces->operator[](0).m_pTypeId->typeInfo()->m_pTypeName;
-			const auto s_EntityHumanName = fmt::format(
-				"{}::{} ({:08x})",
-				s_EntityName,
-				s_EntityTypeName,
-				s_SubEntityId
-			);
-
-			// Add the node to the map.
-			const auto s_SubEntityNode = std::make_shared<EntityTreeNode>(
-				s_EntityHumanName,
-				s_SubEntityId,
-				s_CurrentFactory->m_ridResource,
-				s_SubEntity
-			);
-
-			const auto s_LogicalParent = s_SubEntity.GetLogicalParent();
-
-			if (s_LogicalParent) {
-				auto s_ParentNode = s_NodeMap.find(s_LogicalParent);
-
-				if (s_ParentNode != s_NodeMap.end()) {
-					// If we have already seen the logical parent of this sub-entity, add it to the parent's children.
-					s_ParentNode->second->Children.insert({ s_EntityHumanName, s_SubEntityNode });
-				}
-				else {
-					// Otherwise, add it to the parentless nodes queue.
-					s_ParentlessNodes.push(s_SubEntityNode);
-				}
-			} else {
-				// If it has no logical parent, add it to the parentless nodes queue.
-				s_ParentlessNodes.push(s_SubEntityNode);
-			}
+			s_Entities.push_back({
+				.Name = s_EntityName,
+				.TypeName = s_SubEntity->GetType()->m_pInterfaces->operator[](0).m_pTypeId->typeInfo()->m_pTypeName,
+				.EntityId = s_SubEntity->GetType()->m_nEntityId,
+				.TBLU = s_CurrentFactory->m_ridResource,
+				.Entity = s_SubEntity,
+				.LogicalParent = s_SubEntity.GetLogicalParent(),
+			});
 
 			// If the sub-entity has a factory with more sub-entities, add it to the queue.
 			if (s_SubEntityFactory && s_SubEntityFactory->GetSubEntitiesCount() > 0) {
 				s_NodeQueue.emplace(s_SubEntityFactory, s_SubEntity);
 			}
-
-			s_NodeMap[s_SubEntity] = s_SubEntityNode;
 		}
 	}
 
-	// Go through the nodes and assign any remaining children to their parents.
-	while (!s_ParentlessNodes.empty()) {
-		const auto s_Node = s_ParentlessNodes.front();
-		s_ParentlessNodes.pop();
+	return s_Entities;
+}
 
-		const auto s_LogicalParent = s_Node->Entity.GetLogicalParent();
+void Editor::UpdateEntities() {
+	const auto s_SceneCtx = Globals::Hitman5Module->m_pEntitySceneContext;
 
-		// If it has a logical parent and that parent is in the map, add it to the parent's children.
-		if (s_LogicalParent) {
-			auto s_ParentNode = s_NodeMap.find(s_LogicalParent);
+	if (!s_SceneCtx
+	    || !s_SceneCtx->m_pScene
+	    || !s_SceneCtx->m_pScene.m_ref
+	    || s_SceneCtx->m_aLoadedBricks.size() == 0) {
+		return;
+	}
 
-			if (s_ParentNode != s_NodeMap.end()) {
-				s_ParentNode->second->Children.insert({ s_Node->Name, s_Node });
-				continue;
-			}
+	const auto s_SceneEnt = s_SceneCtx->m_pScene.m_ref;
+
+	// Bricks are walked in parallel, each collecting the entities it spawned. The results are then
+	// merged in brick order, which keeps the first occurrence of entities reachable from several bricks.
+	// Finally, nodes are linked to their logical parents in a single pass over the flat tree.
+
+	std::vector<std::pair<ZEntityBlueprintFactoryBase*, ZEntityRef>> s_Bricks;
+
+	for (const auto& s_Brick: s_SceneCtx->m_aLoadedBricks) {
+		auto s_BrickEnt = s_Brick.entityRef;
+
+		if (!s_BrickEnt) {
+			continue;
 		}
 
-		// Otherwise, add it to the root node.
-		s_NodeMap[ZEntityRef()] = s_Node;
+		const auto s_BpFactory = s_BrickEnt.GetBlueprintFactory();
+
+		if (!s_BpFactory) {
+			continue;
+		}
+
+		s_Bricks.emplace_back(s_BpFactory, s_BrickEnt);
 	}
 
+	std::vector<std::vector<EntityTreeNodeInfo>> s_BrickEntities(s_Bricks.size());
+
+	std::for_each(std::execution::par, s_Bricks.begin(), s_Bricks.end(), [&](const auto& p_Brick) {
+		const auto s_BrickIndex = &p_Brick - s_Bricks.data();
+		s_BrickEntities[s_BrickIndex] = CollectBrickEntities(p_Brick.first, p_Brick.second);
+	});
+
+	size_t s_EntityCount = 1;
+
+	for (const auto& s_Entities : s_BrickEntities) {
+		s_EntityCount += s_Entities.size();
+	}
+
+	auto s_SceneFactory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_SceneEnt.GetBlueprintFactory());
+
+	if (s_SceneEnt.GetOwningEntity()) {
+		s_SceneFactory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_SceneEnt.GetOwningEntity().GetBlueprintFactory());
+	}
+
+	auto s_Tree = std::make_shared<EntityTree>(s_EntityCount);
+
+	// Create the root scene node. It has no logical parent so nothing else can become its parent.
+	s_Tree->AddNode({
+		.Name = "Scene Root",
+		.EntityId = s_SceneEnt->GetType()->m_nEntityId,
+		.TBLU = s_SceneFactory->m_ridResource,
+		.Entity = s_SceneEnt,
+	});
+
+	for (const auto& s_Entities : s_BrickEntities) {
+		for (const auto& s_Entity : s_Entities) {
+			s_Tree->AddNode(s_Entity);
+		}
+	}
+
+	s_Tree->LinkNodes();
+
+	auto s_Snapshot = BuildEntityTreeSnapshot(*s_Tree);
+
+	EntityTreeIndex s_Index;
+	s_Index.Build(*s_Tree);
+
 	// Update the cached tree.
 	m_CachedEntityTreeMutex.lock();
-	m_CachedEntityTree = std::move(s_SceneNode);
-	m_CachedEntityTreeMutex.unlock();
 
-	m_Server.OnEntityTreeRebuilt();
-}
+	m_CachedEntityTree = std::move(s_Tree);
+	m_CachedEntityTreeIndex = std::move(s_Index);
+
+	const auto s_PreviousSnapshot = std::exchange(m_CachedEntityTreeSnapshot, std::move(s_Snapshot));
+
+	// Tell clients what changed if we have something to compare against. This happens under the lock
+	// so the events of concurrent rebuilds are published in order.
+	if (s_PreviousSnapshot.empty()) {
+		m_Server.OnEntityTreeRebuilt();
+	}
+	else {
+		m_Server.OnEntityTreeChanged(
+			DiffEntityTreeSnapshots(s_PreviousSnapshot, m_CachedEntityTreeSnapshot),
+			m_CachedEntityTreeSnapshot.size()
+		);
+	}
 
-void Editor::RenderEntity(std::shared_ptr<EntityTreeNode> p_Node) {
-	if (!p_Node) return;
+	m_Server.ReleaseRemovedEntities(m_CachedEntityTree);
 
-	const auto s_Entity = p_Node->Entity;
-	const auto s_EntityName = p_Node->Name;
+	m_CachedEntityTreeMutex.unlock();
+}
+
+void Editor::RenderEntity(const EntityTree& p_Tree, const EntityTreeNode& p_Node) {
+	const auto s_Entity = p_Node.Entity;
 	const auto s_IsSelected = s_Entity == m_SelectedEntity;
 
 	ImGuiTreeNodeFlags s_Flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth;
 
-	if (p_Node->Children.empty()) {
+	if (p_Node.ChildCount == 0) {
 		s_Flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 	}
 
@@ -201,18 +202,35 @@ void Editor::RenderEntity(std::shared_ptr<EntityTreeNode> p_Node) {
 		ImGui::SetNextItemOpen(true);
 	}
 
-	auto s_Open = ImGui::TreeNodeEx(
-		s_EntityName.c_str(),
-		s_Flags
-	);
+	// Nodes are identified by their entity, so their open state survives tree rebuilds.
+	bool s_Open;
+
+	if (p_Node.TypeName.empty()) {
+		s_Open = ImGui::TreeNodeEx(
+			s_Entity.GetEntity(),
+			s_Flags,
+			"%.*s",
+			static_cast<int>(p_Node.Name.size()), p_Node.Name.data()
+		);
+	}
+	else {
+		s_Open = ImGui::TreeNodeEx(
+			s_Entity.GetEntity(),
+			s_Flags,
+			"%.*s::%.*s (%08llx)",
+			static_cast<int>(p_Node.Name.size()), p_Node.Name.data(),
+			static_cast<int>(p_Node.TypeName.size()), p_Node.TypeName.data(),
+			p_Node.EntityId
+		);
+	}
 
 	if (ImGui::IsItemClicked()) {
 		OnSelectEntity(s_Entity, std::nullopt);
 	}
 
 	if (s_Open) {
-		for (const auto& s_Child: p_Node->Children) {
-			RenderEntity(s_Child.second);
+		for (const auto s_Child : p_Tree.GetChildren(p_Node)) {
+			RenderEntity(p_Tree, p_Tree.GetNode(s_Child));
 		}
 
 		if (!(s_Flags & ImGuiTreeNodeFlags_NoTreePushOnOpen)) {
@@ -341,10 +359,17 @@ void Editor::DrawEntityTree() {
 			UpdateEntities();
 		}
 
+		ImGui::InputText("##SceneSnapshotPath", m_SceneSnapshotPath, IM_ARRAYSIZE(m_SceneSnapshotPath));
+		ImGui::SameLine();
+
+		if (ImGui::Button("Save scene snapshot")) {
+			QueueSceneSnapshot({ .Path = std::filesystem::path(reinterpret_cast<const char8_t*>(m_SceneSnapshotPath)) });
+		}
+
 		m_CachedEntityTreeMutex.lock_shared();
 
 		if (m_CachedEntityTree) {
-			RenderEntity(m_CachedEntityTree);
+			RenderEntity(*m_CachedEntityTree, m_CachedEntityTree->GetRoot());
 		}
 		else {
 			ImGui::Text("No entities loaded. You may want to press the 'Rebuild entity tree' button.");
@@ -2,6 +2,121 @@
 
 #include "IconsMaterialDesign.h"
 
+#include <Glacier/Hash.h>
+#include <Glacier/Reflection.h>
+
+#include <charconv>
+
+static void PinTooltip(uint64_t p_FireCount, STypeID* p_PayloadType)
+{
+    if (!ImGui::IsItemHovered())
+        return;
+
+    const char* s_TypeName = p_PayloadType && p_PayloadType->typeInfo() ? p_PayloadType->typeInfo()->m_pTypeName : "void";
+
+    ImGui::SetTooltip("Signalled %llu times\nPayload: %s", p_FireCount, s_TypeName);
+}
+
+// Pins are separated by commas, and are either names or ids prefixed with 0x.
+static void AddPinsToFilter(std::string_view p_Pins, PinSignalFilter& p_Filter)
+{
+    while (!p_Pins.empty())
+    {
+        const size_t s_End = p_Pins.find(',');
+        std::string_view s_Pin = p_Pins.substr(0, s_End);
+        p_Pins = s_End == std::string_view::npos ? std::string_view() : p_Pins.substr(s_End + 1);
+
+        const size_t s_First = s_Pin.find_first_not_of(" \t");
+
+        if (s_First == std::string_view::npos)
+            continue;
+
+        s_Pin = s_Pin.substr(s_First, s_Pin.find_last_not_of(" \t") - s_First + 1);
+
+        uint32_t s_PinId;
+
+        if (s_Pin.starts_with("0x") &&
+            std::from_chars(s_Pin.data() + 2, s_Pin.data() + s_Pin.size(), s_PinId, 16).ptr == s_Pin.data() + s_Pin.size())
+            p_Filter.AddPin(s_PinId);
+        else
+            p_Filter.AddPin(Hash::Crc32(s_Pin.data(), s_Pin.size()));
+    }
+}
+
+void Editor::UpdatePinSignalFilter()
+{
+    const bool s_FilterEntities = m_PinSignalScope != EPinSignalScope::AllEntities;
+
+    std::shared_ptr<const EntityTree> s_Tree;
+
+    if (m_PinSignalScope == EPinSignalScope::SelectedSubtree)
+    {
+        std::shared_lock s_Lock(m_CachedEntityTreeMutex);
+        s_Tree = m_CachedEntityTree;
+    }
+
+    const ZEntityRef s_Entity = s_FilterEntities ? m_SelectedEntity : ZEntityRef();
+
+    if (m_PinSignalScope == m_PinSignalFilterScope && s_Entity == m_PinSignalFilterEntity &&
+        s_Tree == m_PinSignalFilterTree && m_PinSignalFilterPins == m_PinSignalPins)
+        return;
+
+    m_PinSignalFilterScope = m_PinSignalScope;
+    m_PinSignalFilterEntity = s_Entity;
+    m_PinSignalFilterTree = std::move(s_Tree);
+    m_PinSignalFilterPins = m_PinSignalPins;
+
+    if (!s_FilterEntities && m_PinSignalFilterPins.find_first_not_of(" \t,") == std::string::npos)
+    {
+        m_PinSignals.SetFilter(nullptr);
+        return;
+    }
+
+    auto s_Filter = std::make_unique<PinSignalFilter>();
+
+    AddPinsToFilter(m_PinSignalFilterPins, *s_Filter);
+
+    // Without a selection only the null entity is added, which never signals, so nothing is recorded.
+    if (s_FilterEntities)
+        s_Filter->AddEntity(s_Entity);
+
+    // The tree is immutable, so it can be read without the lock while it is kept alive.
+    if (m_PinSignalFilterTree && s_Entity)
+    {
+        if (const auto s_Node = m_PinSignalFilterTree->FindNode(s_Entity))
+            s_Filter->AddSubtree(*m_PinSignalFilterTree, *s_Node);
+    }
+
+    m_PinSignals.SetFilter(std::move(s_Filter));
+}
+
+void Editor::DrainPinSignals()
+{
+    m_DrainedPinSignals.clear();
+    m_DroppedPinSignals += m_PinSignals.Drain(m_DrainedPinSignals);
+
+    for (const auto& s_Signal : m_DrainedPinSignals)
+    {
+        auto& s_FiredPins = s_Signal.Direction == EPinDirection::Input ? m_FiredInputPins : m_FiredOutputPins;
+        auto& s_Info = s_FiredPins[s_Signal.PinId];
+
+        // Signals are only ordered per thread, so keep the latest one.
+        if (s_Signal.Timestamp >= s_Info.m_FireTimestamp)
+        {
+            s_Info.m_FireTimestamp = s_Signal.Timestamp;
+            s_Info.m_PayloadType = s_Signal.PayloadType;
+        }
+
+        ++s_Info.m_FireCount;
+    }
+
+    if (m_PinTraceRecorder.IsRecording())
+    {
+        std::shared_lock s_Lock(m_CachedEntityTreeMutex);
+        m_PinTraceRecorder.Record(m_DrainedPinSignals, m_CachedEntityTree.get());
+    }
+}
+
 void Editor::DrawPinTracer()
 {
     auto s_ImgGuiIO = ImGui::GetIO();
@@ -10,7 +125,11 @@ void Editor::DrawPinTracer()
     ImGui::SetNextWindowSize({ 400, s_ImgGuiIO.DisplaySize.y - 710 });
     ImGui::Begin(ICON_MD_PUSH_PIN " Pin Tracer", nullptr, ImGuiWindowFlags_HorizontalScrollbar);
 
-    auto s_Now = std::chrono::system_clock::now();
+    const uint64_t s_Now = PinSignalCapture::Now();
+    const double s_TicksPerSecond = m_PinSignals.GetTicksPerSecond();
+
+    if (m_DroppedPinSignals > 0)
+        ImGui::TextColored({ 1.f, 0.6f, 0.f, 1.f }, fmt::format("{} signals dropped", m_DroppedPinSignals).c_str());
 
     ImGui::Text(ICON_MD_LOGIN " Input Pins");
 
@@ -18,7 +137,9 @@ void Editor::DrawPinTracer()
 
     for (auto it = m_FiredInputPins.begin(); it != m_FiredInputPins.end();)
     {
-        std::chrono::duration<double> s_ElapsedSeconds = s_Now - it->second.m_FireTime;
+        const std::chrono::duration<double> s_ElapsedSeconds(
+            s_Now > it->second.m_FireTimestamp ? (s_Now - it->second.m_FireTimestamp) / s_TicksPerSecond : 0.0
+        );
 
         if (s_ElapsedSeconds.count() > 1.f)
         {
@@ -44,6 +165,7 @@ void Editor::DrawPinTracer()
             s_Color = { 0.1f, 0.f, 0.f, 1.f }; // Very Dark Red
 
         ImGui::TextColored(s_Color, fmt::format("{:x}", it->first).c_str());
+        PinTooltip(it->second.m_FireCount, it->second.m_PayloadType);
 
         const float s_LastStartX = ImGui::GetItemRectMin().x;
         const float s_LastEndX = ImGui::GetItemRectMax().x;
@@ -65,7 +187,9 @@ void Editor::DrawPinTracer()
 
     for (auto it = m_FiredOutputPins.begin(); it != m_FiredOutputPins.end();)
     {
-        std::chrono::duration<double> s_ElapsedSeconds = s_Now - it->second.m_FireTime;
+        const std::chrono::duration<double> s_ElapsedSeconds(
+            s_Now > it->second.m_FireTimestamp ? (s_Now - it->second.m_FireTimestamp) / s_TicksPerSecond : 0.0
+        );
 
         if (s_ElapsedSeconds.count() > 1.f)
         {
@@ -126,6 +250,8 @@ void Editor::DrawPinTracer()
         else
             ImGui::TextColored(s_LerpedColor, fmt::format("{:x}", it->first).c_str());
 
+        PinTooltip(it->second.m_FireCount, it->second.m_PayloadType);
+
         const float s_LastStartX = ImGui::GetItemRectMin().x;
         const float s_LastEndX = ImGui::GetItemRectMax().x;
         const float s_LastWidth = s_LastEndX - s_LastStartX;
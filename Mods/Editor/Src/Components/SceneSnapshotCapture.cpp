@@ -0,0 +1,121 @@
+#include <Editor.h>
+
+#include "Logging.h"
+
+#include <algorithm>
+#include <queue>
+
+void Editor::QueueSceneSnapshot(SceneSnapshotRequest p_Request) {
+	std::scoped_lock s_Lock(m_PendingSceneSnapshotsMutex);
+	m_PendingSceneSnapshots.push_back(std::move(p_Request));
+}
+
+void Editor::CapturePendingSceneSnapshots() {
+	std::vector<SceneSnapshotRequest> s_Requests;
+
+	{
+		std::scoped_lock s_Lock(m_PendingSceneSnapshotsMutex);
+		s_Requests.swap(m_PendingSceneSnapshots);
+	}
+
+	if (s_Requests.empty()) {
+		return;
+	}
+
+	std::shared_lock s_TreeLock(m_CachedEntityTreeMutex);
+
+	for (auto& s_Request : s_Requests) {
+		if (!m_CachedEntityTree) {
+			OnSceneSnapshotSaved(s_Request, { .Error = "The entity tree hasn't been built yet." });
+			continue;
+		}
+
+		// Everything is read here, within a single frame, so the snapshot is consistent.
+		// Sorting and writing it out is left to the snapshot thread.
+		CapturedSceneSnapshot s_Snapshot { .Request = std::move(s_Request) };
+		s_Snapshot.Entities.reserve(m_CachedEntityTree->Size());
+
+		std::queue<const EntityTreeNode*> s_NodeQueue;
+		s_NodeQueue.push(&m_CachedEntityTree->GetRoot());
+
+		while (!s_NodeQueue.empty()) {
+			const auto s_Node = s_NodeQueue.front();
+			s_NodeQueue.pop();
+
+			for (const auto s_Child : m_CachedEntityTree->GetChildren(*s_Node)) {
+				s_NodeQueue.push(&m_CachedEntityTree->GetNode(s_Child));
+			}
+
+			if (s_Node->Entity) {
+				EditorServer::CaptureSnapshotEntity(*s_Node, s_Snapshot.Entities.emplace_back());
+			}
+		}
+
+		{
+			std::scoped_lock s_Lock(m_CapturedSceneSnapshotsMutex);
+			m_CapturedSceneSnapshots.push_back(std::move(s_Snapshot));
+		}
+
+		m_CapturedSceneSnapshotsCondition.notify_one();
+	}
+}
+
+void Editor::WriteCapturedSceneSnapshots(std::stop_token p_StopToken) {
+	while (true) {
+		CapturedSceneSnapshot s_Snapshot;
+
+		{
+			std::unique_lock s_Lock(m_CapturedSceneSnapshotsMutex);
+
+			if (!m_CapturedSceneSnapshotsCondition.wait(s_Lock, p_StopToken, [this] { return !m_CapturedSceneSnapshots.empty(); })) {
+				return;
+			}
+
+			s_Snapshot = std::move(m_CapturedSceneSnapshots.front());
+			m_CapturedSceneSnapshots.pop_front();
+		}
+
+		SceneSnapshotResult s_Result;
+
+		try {
+			// Stable, so entities that share an id and blueprint keep their tree order and get paired up the same way when diffing.
+			std::ranges::stable_sort(s_Snapshot.Entities, SceneSnapshot::EntityLess);
+
+			SceneSnapshot::Writer s_Writer(s_Snapshot.Request.Path);
+
+			for (const auto& s_Entity : s_Snapshot.Entities) {
+				if (p_StopToken.stop_requested()) {
+					return;
+				}
+
+				s_Writer.WriteEntity(s_Entity);
+			}
+
+			s_Result.Bytes = s_Writer.Finish();
+			s_Result.Entities = s_Writer.GetEntityCount();
+		}
+		catch (const std::exception& e) {
+			s_Result.Error = e.what();
+		}
+
+		OnSceneSnapshotSaved(s_Snapshot.Request, std::move(s_Result));
+	}
+}
+
+void Editor::OnSceneSnapshotSaved(const SceneSnapshotRequest& p_Request, SceneSnapshotResult p_Result) {
+	// Snapshots requested by a client are reported back to it. The ones requested from the UI are only logged.
+	if (p_Request.ClientId) {
+		m_Server.OnSceneSnapshotSaved(p_Request, std::move(p_Result));
+		return;
+	}
+
+	const auto s_Path = p_Request.Path.u8string();
+	const std::string_view s_PathView(reinterpret_cast<const char*>(s_Path.data()), s_Path.size());
+
+	if (p_Result.Error) {
+		Logger::Error("Could not save scene snapshot to '{}': {}", s_PathView, *p_Result.Error);
+	}
+	else {
+		Logger::Info("Saved scene snapshot of {} entities ({} bytes) to '{}'.", p_Result.Entities, p_Result.Bytes, s_PathView);
+	}
+}
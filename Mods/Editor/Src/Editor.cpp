@@ -94,6 +94,28 @@ void Editor::Init()
 	m_UseScaleSnap = GetSettingBool("general", "scale_snap", true);
 	m_ScaleSnapValue = GetSettingDouble("general", "scale_snap_value", 1.0);
 	m_UseQneTransforms = GetSettingBool("general", "qne_transforms", false);
+
+	// Compression is off by default since it only pays off when the client isn't on the same machine.
+	const auto s_Compression = GetSetting("server", "compression", "disabled");
+	const auto s_CompressionThreshold = GetSettingUInt("server", "compression_threshold", 1024);
+
+	uWS::CompressOptions s_CompressOptions = uWS::DISABLED;
+
+	if (s_Compression == "shared") {
+		s_CompressOptions = uWS::SHARED_COMPRESSOR;
+	}
+	else if (s_Compression == "dedicated") {
+		s_CompressOptions = uWS::DEDICATED_COMPRESSOR;
+	}
+	else if (s_Compression != "disabled") {
+		Logger::Warn("Unknown editor server compression '{}', compression will be disabled.", s_Compression.c_str());
+	}
+
+	m_Server.Start(s_CompressOptions, s_CompressionThreshold);
+
+	m_SceneSnapshotThread = std::jthread([this](std::stop_token p_StopToken) {
+		WriteCapturedSceneSnapshots(p_StopToken);
+	});
 }
 
 void Editor::OnDrawMenu()
@@ -103,6 +125,45 @@ void Editor::OnDrawMenu()
 		ToggleEditorServerEnabled();
 	}
 
+	if (const auto s_Stats = m_Server.GetCompressionStats(); s_Stats.CompressedMessages > 0) {
+		ImGui::Text(
+			"Compressed %llu of %llu messages (%.1f MB, ~%.1fx) in %.1f ms",
+			s_Stats.CompressedMessages,
+			s_Stats.CompressedMessages + s_Stats.UncompressedMessages,
+			s_Stats.CompressedInputBytes / (1024.0 * 1024.0),
+			s_Stats.EstimatedRatio,
+			std::chrono::duration<double, std::milli>(s_Stats.CompressionTime).count()
+		);
+	}
+
+	bool s_RecordingPinTrace = m_PinTraceRecorder.IsRecording();
+	if (ImGui::Checkbox("RECORD PIN TRACE", &s_RecordingPinTrace)) {
+		TogglePinTraceRecording();
+	}
+
+	if (m_PinTraceRecorder.IsRecording()) {
+		ImGui::Text(
+			"Recorded %llu pin signals (%.1f MB)",
+			m_PinTraceRecorder.GetSignalCount(),
+			m_PinTraceRecorder.GetWrittenBytes() / (1024.0 * 1024.0)
+		);
+	}
+	else {
+		ImGui::InputText("##PinTracePath", m_PinTracePath, IM_ARRAYSIZE(m_PinTracePath));
+	}
+
+	if (const auto s_Error = m_PinTraceRecorder.GetError()) {
+		ImGui::TextColored({ 1.f, 0.f, 0.f, 1.f }, "Pin trace recording stopped: %s", s_Error->c_str());
+	}
+
+	// Only matching signals are traced and recorded, which keeps the cost of the pin detours down.
+	int s_PinSignalScope = static_cast<int>(m_PinSignalScope);
+	if (ImGui::Combo("##PinSignalScope", &s_PinSignalScope, "Trace all entities\0Trace selected entity\0Trace selected entity and children\0")) {
+		m_PinSignalScope = static_cast<EPinSignalScope>(s_PinSignalScope);
+	}
+
+	ImGui::InputTextWithHint("##PinSignalPins", "All pins, or names and 0x ids separated by commas", m_PinSignalPins, IM_ARRAYSIZE(m_PinSignalPins));
+
     /*if (ImGui::Button(ICON_MD_VIDEO_SETTINGS "  EDITOR"))
     {
         const auto s_Scene = Globals::Hitman5Module->m_pEntitySceneContext->m_pScene;
@@ -164,6 +225,24 @@ void Editor::ToggleEditorServerEnabled() {
 	m_Server.SetEnabled(!m_Server.GetEnabled());
 }
 
+void Editor::TogglePinTraceRecording() {
+	if (m_PinTraceRecorder.IsRecording()) {
+		m_PinTraceRecorder.Stop();
+		Logger::Info("Recorded {} pin signals to '{}'.", m_PinTraceRecorder.GetSignalCount(), m_PinTracePath);
+		return;
+	}
+
+	try {
+		m_PinTraceRecorder.Start(
+			std::filesystem::path(reinterpret_cast<const char8_t*>(m_PinTracePath)),
+			m_PinSignals.GetTicksPerSecond()
+		);
+	}
+	catch (const std::exception& e) {
+		Logger::Error("Could not start recording pin trace: {}", e.what());
+	}
+}
+
 void Editor::CopyToClipboard(const std::string& p_String) const
 {
     if (!OpenClipboard(nullptr))
@@ -448,6 +527,10 @@ void Editor::OnDrawUI(bool p_HasFocus)
     DrawEntityTree();
     DrawEntityProperties();
     DrawEntityManipulator(p_HasFocus);
+
+    // Drained every frame, even while the tracer isn't shown, so the capture buffers don't fill up.
+    UpdatePinSignalFilter();
+    DrainPinSignals();
     //DrawPinTracer();
 
     if (m_CameraRT && m_Camera)
@@ -502,7 +585,14 @@ void Editor::OnDrawUI(bool p_HasFocus)
 
 void Editor::OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent)
 {
+    // Batches are applied first, so the changes they make go out with the rest of the frame's events.
+    ApplyPendingCommandBatches();
+
+    // Snapshots are captured after the batches, so they include the changes made by batches sent before them.
+    CapturePendingSceneSnapshots();
 
+    // Entity changes made during the frame are coalesced and sent out together.
+    m_Server.FlushEvents();
 }
 
 void Editor::OnMouseDown(SVector2 p_Pos, bool p_FirstClick)
@@ -793,6 +883,8 @@ DEFINE_PLUGIN_DETOUR(Editor, void, OnLoadScene, ZEntitySceneContext* th, ZSceneD
 
 	m_CachedEntityTreeMutex.lock();
 	m_CachedEntityTree.reset();
+	m_CachedEntityTreeSnapshot.clear();
+	m_CachedEntityTreeIndex.Clear();
 	m_CachedEntityTreeMutex.unlock();
 
     std::vector<std::string> s_Bricks;
@@ -822,6 +914,8 @@ DEFINE_PLUGIN_DETOUR(Editor, void, OnClearScene, ZEntitySceneContext* th, bool f
 
 	m_CachedEntityTreeMutex.lock();
 	m_CachedEntityTree.reset();
+	m_CachedEntityTreeSnapshot.clear();
+	m_CachedEntityTreeIndex.Clear();
 	m_CachedEntityTreeMutex.unlock();
 
     m_Server.OnSceneClearing(forReload);
@@ -831,24 +925,16 @@ DEFINE_PLUGIN_DETOUR(Editor, void, OnClearScene, ZEntitySceneContext* th, bool f
 
 DEFINE_PLUGIN_DETOUR(Editor, bool, OnInputPin, ZEntityRef entity, uint32_t pinId, const ZObjectRef& data)
 {
-    //if (entity == m_SelectedEntity)
-    {
-        m_FiredInputPins[pinId] = PinFireInfo {
-            .m_FireTime = std::chrono::system_clock::now(),
-        };
-    }
+    // Runs on whichever thread signals the pin, so it only records the signal for the pin tracer to pick up.
+    m_PinSignals.Record(entity, pinId, EPinDirection::Input, data.m_pTypeID);
 
     return { HookAction::Continue() };
 }
 
 DEFINE_PLUGIN_DETOUR(Editor, bool, OnOutputPin, ZEntityRef entity, uint32_t pinId, const ZObjectRef& data)
 {
-    //if (entity == m_SelectedEntity)
-    {
-        m_FiredOutputPins[pinId] = PinFireInfo {
-            .m_FireTime = std::chrono::system_clock::now(),
-        };
-    }
+    // Runs on whichever thread signals the pin, so it only records the signal for the pin tracer to pick up.
+    m_PinSignals.Record(entity, pinId, EPinDirection::Output, data.m_pTypeID);
 
     return { HookAction::Continue() };
 }
@@ -6,6 +6,10 @@
 #include <unordered_map>
 #include <map>
 #include <shared_mutex>
+#include <condition_variable>
+#include <deque>
+#include <stop_token>
+#include <thread>
 
 #include "IPluginInterface.h"
 #include "Glacier/ZEntity.h"
@@ -15,6 +19,10 @@
 #include "ImGuizmo.h"
 #include "EditorServer.h"
 #include "EntityTreeNode.h"
+#include "EntityTreeDelta.h"
+#include "EntityTreeIndex.h"
+#include "PinSignalCapture.h"
+#include "PinTraceRecorder.h"
 
 struct QneTransform {
 	SVector3 Position;
@@ -42,12 +50,21 @@ public:
 	void SetEntityName(EntitySelector p_Selector, std::string p_Name, std::optional<std::string> p_ClientId);
 	void SetEntityProperty(EntitySelector p_Selector, uint32_t p_PropertyId, std::string_view p_JsonValue, std::optional<std::string> p_ClientId);
 	void SignalEntityPin(EntitySelector p_Selector, uint32_t p_PinId, bool p_Output);
-	void LockEntityTree() { m_CachedEntityTreeMutex.lock_shared(); }
-	std::shared_ptr<EntityTreeNode> GetEntityTree() { return m_CachedEntityTree; }
-	void UnlockEntityTree() { m_CachedEntityTreeMutex.unlock_shared(); }
+	// The entity tree stays locked until the returned lock is released or goes out of scope.
+	[[nodiscard]] std::shared_lock<std::shared_mutex> LockEntityTree() { return std::shared_lock(m_CachedEntityTreeMutex); }
+	std::shared_ptr<const EntityTree> GetEntityTree() { return m_CachedEntityTree; }
+
+	// The entity tree must be locked while the query runs and while the nodes it returns are used.
+	std::vector<const EntityTreeNode*> QueryEntities(const EntityQuery& p_Query) const { return m_CachedEntityTreeIndex.Query(p_Query); }
 	ZEntityRef FindEntity(EntitySelector p_Selector);
 	void RebuildEntityTree();
 
+	// Called on the server thread. The batch is applied on the game thread at the start of the next frame.
+	void QueueCommandBatch(EditorCommandBatch p_Batch);
+
+	// The scene is captured on the game thread at the start of the next frame, and written to disk in the background.
+	void QueueSceneSnapshot(SceneSnapshotRequest p_Request);
+
 private:
     void SpawnCameras();
     void ActivateCamera(ZEntityRef* m_CameraEntity);
@@ -60,7 +77,7 @@ private:
 
     void DrawEntityProperties();
 
-    void RenderEntity(std::shared_ptr<EntityTreeNode> p_Node);
+    void RenderEntity(const EntityTree& p_Tree, const EntityTreeNode& p_Node);
     void DrawEntityTree();
     bool SearchForEntityById(ZTemplateEntityBlueprintFactory* p_BrickFactory, ZEntityRef p_BrickEntity, uint64_t p_EntityId);
     bool SearchForEntityByType(ZTemplateEntityBlueprintFactory* p_BrickFactory, ZEntityRef p_BrickEntity, const std::string& p_TypeName);
@@ -73,14 +90,47 @@ private:
 	void OnSetPropertyValue(ZEntityRef p_Entity, uint32_t p_PropertyId, const ZObjectRef& p_Value, std::optional<std::string> p_ClientId);
 	void OnSignalEntityPin(ZEntityRef p_Entity, const std::string& p_Pin, bool p_Output);
 	void OnSignalEntityPin(ZEntityRef p_Entity, uint32_t p_PinId, bool p_Output);
+	void SetEntityProperty(ZEntityRef p_Entity, uint32_t p_PropertyId, std::string_view p_JsonValue, std::optional<std::string> p_ClientId);
+
+	// The state a batch command changed, so atomic batches can be rolled back.
+	struct CommandUndo {
+		EEditorCommandKind Kind;
+		ZEntityRef Entity;
+		SMatrix WorldTransform;
+		std::optional<std::string> Name;
+		uint32_t PropertyId = 0;
+
+		// A copy of the previous property value, owned by the undo entry. Freed with FreeCommandUndo.
+		STypeID* PropertyType = nullptr;
+		void* PropertyValue = nullptr;
+	};
+
+	void ApplyPendingCommandBatches();
+	EditorCommandBatchResult ApplyCommandBatch(const EditorCommandBatch& p_Batch);
+	CommandUndo ApplyCommand(const EditorCommand& p_Command, ZEntityRef p_Entity, const std::string& p_ClientId);
+	void UndoCommand(const CommandUndo& p_Undo, const std::string& p_ClientId);
+	static void FreeCommandUndo(CommandUndo& p_Undo);
+
+	// A scene snapshot that was captured and is waiting to be written to disk.
+	struct CapturedSceneSnapshot {
+		SceneSnapshotRequest Request;
+		std::vector<SceneSnapshot::Entity> Entities;
+	};
+
+	void CapturePendingSceneSnapshots();
+	void WriteCapturedSceneSnapshots(std::stop_token p_StopToken);
+	void OnSceneSnapshotSaved(const SceneSnapshotRequest& p_Request, SceneSnapshotResult p_Result);
 
     void OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent);
 
+    void UpdatePinSignalFilter();
+    void DrainPinSignals();
     void DrawPinTracer();
 
     static bool ImGuiCopyWidget(const std::string& p_Id);
 
 	void ToggleEditorServerEnabled();
+	void TogglePinTraceRecording();
 
 	// Properties
 	void UnsupportedProperty(const std::string& p_Id, ZEntityRef p_Entity, ZEntityProperty* p_Property, void* p_Data);
@@ -157,11 +207,41 @@ private:
 
     struct PinFireInfo
     {
-        std::chrono::time_point<std::chrono::system_clock> m_FireTime;
+        // In PinSignalCapture time stamp counter ticks.
+        uint64_t m_FireTimestamp = 0;
+        uint64_t m_FireCount = 0;
+        STypeID* m_PayloadType = nullptr;
+    };
+
+    enum class EPinSignalScope : int
+    {
+        AllEntities,
+        SelectedEntity,
+        SelectedSubtree,
     };
 
+    // Written by the pin detours on any thread, and drained by the pin tracer.
+    PinSignalCapture m_PinSignals;
+
+    // Edited in the menu. The filter of the capture is rebuilt on the UI thread when these or the selection change.
+    EPinSignalScope m_PinSignalScope = EPinSignalScope::AllEntities;
+    char m_PinSignalPins[512] = "";
+
+    // What the current filter of the capture was built from.
+    EPinSignalScope m_PinSignalFilterScope = EPinSignalScope::AllEntities;
+    std::string m_PinSignalFilterPins;
+    ZEntityRef m_PinSignalFilterEntity;
+    std::shared_ptr<const EntityTree> m_PinSignalFilterTree;
+
+    // Only used by the pin tracer, on the UI thread.
+    std::vector<PinSignal> m_DrainedPinSignals;
     std::unordered_map<uint32_t, PinFireInfo> m_FiredInputPins = {};
     std::unordered_map<uint32_t, PinFireInfo> m_FiredOutputPins = {};
+    uint64_t m_DroppedPinSignals = 0;
+
+    // Drained pin signals are also written here while a pin trace is being recorded.
+    PinTraceRecorder m_PinTraceRecorder;
+    char m_PinTracePath[260] = "pins.zept";
 
     SOCKET m_QneSocket = INVALID_SOCKET;
     bool m_ConnectedToQne = false;
@@ -169,12 +249,29 @@ private:
     sockaddr_in m_QneAddress = {};
 
 	std::shared_mutex m_CachedEntityTreeMutex;
-	std::shared_ptr<EntityTreeNode> m_CachedEntityTree;
+	std::shared_ptr<EntityTree> m_CachedEntityTree;
+	EntityTreeSnapshot m_CachedEntityTreeSnapshot;
+	EntityTreeIndex m_CachedEntityTreeIndex;
 
 	std::unordered_map<uint64_t, ZEntityRef> m_SpawnedEntities;
 	std::unordered_map<ZEntityRef, std::string> m_EntityNames;
 
+	std::mutex m_PendingCommandBatchesMutex;
+	std::vector<EditorCommandBatch> m_PendingCommandBatches;
+
+	std::mutex m_PendingSceneSnapshotsMutex;
+	std::vector<SceneSnapshotRequest> m_PendingSceneSnapshots;
+
+	std::mutex m_CapturedSceneSnapshotsMutex;
+	std::condition_variable_any m_CapturedSceneSnapshotsCondition;
+	std::deque<CapturedSceneSnapshot> m_CapturedSceneSnapshots;
+
+	char m_SceneSnapshotPath[260] = "scene.zesn";
+
 	EditorServer m_Server;
+
+	// Declared last, so it is stopped before anything it uses is destroyed.
+	std::jthread m_SceneSnapshotThread;
 };
 
 DECLARE_ZHM_PLUGIN(Editor)
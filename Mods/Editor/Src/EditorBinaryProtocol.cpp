@@ -0,0 +1,342 @@
+#include "EditorBinaryProtocol.h"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+namespace EditorBinaryProtocol {
+	enum EMessageFlags : uint8_t {
+		MESSAGE_HAS_ID = 1 << 0,
+	};
+
+	enum EEntityFlags : uint8_t {
+		ENTITY_IS_GAME = 1 << 0,
+		ENTITY_HAS_NAME = 1 << 1,
+		ENTITY_HAS_CHILD_COUNT = 1 << 2,
+	};
+
+	enum EEntityTransformFlags : uint8_t {
+		TRANSFORM_IS_GAME = 1 << 0,
+		TRANSFORM_HAS_RELATIVE = 1 << 1,
+	};
+
+	enum EDetailsFlags : uint8_t {
+		DETAILS_HAS_TRANSFORM = 1 << 0,
+		DETAILS_HAS_RELATIVE_TRANSFORM = 1 << 1,
+	};
+
+	void Writer::WriteHeader(EMessageType p_Type, std::optional<int64_t> p_MessageId) {
+		WriteU8(static_cast<uint8_t>(p_Type));
+		WriteU8(p_MessageId ? MESSAGE_HAS_ID : 0);
+
+		if (p_MessageId) {
+			WriteI64(*p_MessageId);
+		}
+	}
+
+	void Writer::WriteTransform(const Transform& p_Transform) {
+		for (const float s_Value : p_Transform.Position) {
+			WriteF32(s_Value);
+		}
+
+		for (const float s_Value : p_Transform.Rotation) {
+			WriteF32(s_Value);
+		}
+
+		for (const float s_Value : p_Transform.Scale) {
+			WriteF32(s_Value);
+		}
+	}
+
+	void Writer::WriteEntity(const Entity& p_Entity) {
+		uint8_t s_Flags = 0;
+
+		if (p_Entity.Tblu) {
+			s_Flags |= ENTITY_IS_GAME;
+		}
+
+		if (p_Entity.Name) {
+			s_Flags |= ENTITY_HAS_NAME;
+		}
+
+		if (p_Entity.ChildCount) {
+			s_Flags |= ENTITY_HAS_CHILD_COUNT;
+		}
+
+		WriteU64(p_Entity.Id);
+		WriteU8(s_Flags);
+
+		if (p_Entity.Tblu) {
+			WriteU64(*p_Entity.Tblu);
+		}
+
+		WriteString(p_Entity.Type);
+
+		if (p_Entity.Name) {
+			WriteString(*p_Entity.Name);
+		}
+
+		if (p_Entity.ChildCount) {
+			WriteU32(*p_Entity.ChildCount);
+		}
+	}
+
+	void Writer::WriteEntityTransform(const EntityTransform& p_Transform) {
+		uint8_t s_Flags = 0;
+
+		if (p_Transform.Tblu) {
+			s_Flags |= TRANSFORM_IS_GAME;
+		}
+
+		if (p_Transform.RelativeTransform) {
+			s_Flags |= TRANSFORM_HAS_RELATIVE;
+		}
+
+		WriteU64(p_Transform.Id);
+		WriteU8(s_Flags);
+
+		if (p_Transform.Tblu) {
+			WriteU64(*p_Transform.Tblu);
+		}
+
+		WriteTransform(p_Transform.WorldTransform);
+
+		if (p_Transform.RelativeTransform) {
+			WriteTransform(*p_Transform.RelativeTransform);
+		}
+	}
+
+	void Writer::WritePropertyValue(const PropertyValue& p_Property) {
+		WriteString(p_Property.Name);
+		WriteString(p_Property.Type);
+		WriteU8(static_cast<uint8_t>(p_Property.Kind));
+
+		switch (p_Property.Kind) {
+			case EPropertyValueKind::Entity:
+				WriteEntity(p_Property.EntityValue);
+				break;
+			case EPropertyValueKind::Json:
+				WriteString(p_Property.JsonValue);
+				break;
+			case EPropertyValueKind::Null:
+				break;
+		}
+	}
+
+	void Writer::WriteEntityDetails(const EntityDetails& p_Details) {
+		WriteEntity(p_Details.Base);
+
+		uint8_t s_Flags = 0;
+
+		if (p_Details.WorldTransform) {
+			s_Flags |= DETAILS_HAS_TRANSFORM;
+		}
+
+		if (p_Details.RelativeTransform) {
+			s_Flags |= DETAILS_HAS_RELATIVE_TRANSFORM;
+		}
+
+		WriteU8(s_Flags);
+
+		WriteU32(static_cast<uint32_t>(p_Details.Interfaces.size()));
+
+		for (const auto& s_Interface : p_Details.Interfaces) {
+			WriteString(s_Interface);
+		}
+
+		if (p_Details.WorldTransform) {
+			WriteTransform(*p_Details.WorldTransform);
+		}
+
+		if (p_Details.RelativeTransform) {
+			WriteTransform(*p_Details.RelativeTransform);
+		}
+
+		WriteU32(static_cast<uint32_t>(p_Details.Properties.size()));
+
+		for (const auto& s_Property : p_Details.Properties) {
+			WritePropertyValue(s_Property);
+		}
+	}
+
+	void Reader::ReadRaw(void* p_Data, size_t p_Size) {
+		if (p_Size > GetRemaining()) {
+			throw std::out_of_range(
+				std::format("Tried to read {} bytes at offset {} of a {} byte message.", p_Size, m_Position, m_Data.size())
+			);
+		}
+
+		memcpy(p_Data, m_Data.data() + m_Position, p_Size);
+		m_Position += p_Size;
+	}
+
+	uint64_t Reader::ReadVarint() {
+		uint64_t s_Value = 0;
+
+		for (int s_Shift = 0; s_Shift < 64; s_Shift += 7) {
+			const uint8_t s_Byte = ReadU8();
+			s_Value |= static_cast<uint64_t>(s_Byte & 0x7F) << s_Shift;
+
+			if (!(s_Byte & 0x80)) {
+				return s_Value;
+			}
+		}
+
+		throw std::runtime_error("Varint is longer than 64 bits.");
+	}
+
+	std::string_view Reader::ReadString() {
+		const uint64_t s_Size = ReadVarint();
+
+		if (s_Size > GetRemaining()) {
+			throw std::out_of_range(
+				std::format("String of {} bytes at offset {} runs past the end of the message.", s_Size, m_Position)
+			);
+		}
+
+		const std::string_view s_Value(reinterpret_cast<const char*>(m_Data.data() + m_Position), s_Size);
+		m_Position += s_Size;
+
+		return s_Value;
+	}
+
+	MessageHeader Reader::ReadHeader() {
+		MessageHeader s_Header {};
+
+		const uint8_t s_Type = ReadU8();
+
+		if (s_Type < static_cast<uint8_t>(EMessageType::EntityList) || s_Type > static_cast<uint8_t>(EMessageType::EntityTransformOnlyUpdated)) {
+			throw std::runtime_error(std::format("Unknown binary message type {}.", s_Type));
+		}
+
+		s_Header.Type = static_cast<EMessageType>(s_Type);
+
+		if (ReadU8() & MESSAGE_HAS_ID) {
+			s_Header.MessageId = ReadI64();
+		}
+
+		return s_Header;
+	}
+
+	Transform Reader::ReadTransform() {
+		Transform s_Transform {};
+
+		for (float& s_Value : s_Transform.Position) {
+			s_Value = ReadF32();
+		}
+
+		for (float& s_Value : s_Transform.Rotation) {
+			s_Value = ReadF32();
+		}
+
+		for (float& s_Value : s_Transform.Scale) {
+			s_Value = ReadF32();
+		}
+
+		return s_Transform;
+	}
+
+	Entity Reader::ReadEntity() {
+		Entity s_Entity {};
+
+		s_Entity.Id = ReadU64();
+
+		const uint8_t s_Flags = ReadU8();
+
+		if (s_Flags & ENTITY_IS_GAME) {
+			s_Entity.Tblu = ReadU64();
+		}
+
+		s_Entity.Type = ReadString();
+
+		if (s_Flags & ENTITY_HAS_NAME) {
+			s_Entity.Name = ReadString();
+		}
+
+		if (s_Flags & ENTITY_HAS_CHILD_COUNT) {
+			s_Entity.ChildCount = ReadU32();
+		}
+
+		return s_Entity;
+	}
+
+	EntityTransform Reader::ReadEntityTransform() {
+		EntityTransform s_Transform {};
+
+		s_Transform.Id = ReadU64();
+
+		const uint8_t s_Flags = ReadU8();
+
+		if (s_Flags & TRANSFORM_IS_GAME) {
+			s_Transform.Tblu = ReadU64();
+		}
+
+		s_Transform.WorldTransform = ReadTransform();
+
+		if (s_Flags & TRANSFORM_HAS_RELATIVE) {
+			s_Transform.RelativeTransform = ReadTransform();
+		}
+
+		return s_Transform;
+	}
+
+	PropertyValue Reader::ReadPropertyValue() {
+		PropertyValue s_Property {};
+
+		s_Property.Name = ReadString();
+		s_Property.Type = ReadString();
+
+		const uint8_t s_Kind = ReadU8();
+
+		switch (static_cast<EPropertyValueKind>(s_Kind)) {
+			case EPropertyValueKind::Null:
+				break;
+			case EPropertyValueKind::Entity:
+				s_Property.EntityValue = ReadEntity();
+				break;
+			case EPropertyValueKind::Json:
+				s_Property.JsonValue = ReadString();
+				break;
+			default:
+				throw std::runtime_error(std::format("Unknown property value kind {}.", s_Kind));
+		}
+
+		s_Property.Kind = static_cast<EPropertyValueKind>(s_Kind);
+
+		return s_Property;
+	}
+
+	EntityDetails Reader::ReadEntityDetails() {
+		EntityDetails s_Details {};
+
+		s_Details.Base = ReadEntity();
+
+		const uint8_t s_Flags = ReadU8();
+		const uint32_t s_InterfaceCount = ReadU32();
+
+		// Every element takes at least one byte, which bounds what a corrupt count can make us allocate.
+		s_Details.Interfaces.reserve((std::min<size_t>)(s_InterfaceCount, GetRemaining()));
+
+		for (uint32_t i = 0; i < s_InterfaceCount; ++i) {
+			s_Details.Interfaces.push_back(ReadString());
+		}
+
+		if (s_Flags & DETAILS_HAS_TRANSFORM) {
+			s_Details.WorldTransform = ReadTransform();
+		}
+
+		if (s_Flags & DETAILS_HAS_RELATIVE_TRANSFORM) {
+			s_Details.RelativeTransform = ReadTransform();
+		}
+
+		const uint32_t s_PropertyCount = ReadU32();
+
+		s_Details.Properties.reserve((std::min<size_t>)(s_PropertyCount, GetRemaining()));
+
+		for (uint32_t i = 0; i < s_PropertyCount; ++i) {
+			s_Details.Properties.push_back(ReadPropertyValue());
+		}
+
+		return s_Details;
+	}
+}
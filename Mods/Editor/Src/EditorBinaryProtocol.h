@@ -0,0 +1,249 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Binary encoding of the high-volume editor events, used by clients that ask for it in their hello message.
+ * Binary events are sent as binary websocket frames; everything else keeps being sent as JSON text frames.
+ *
+ * All values are little-endian.
+ *   string:         varint byte length, followed by UTF-8 bytes
+ *   message:        u8 type, u8 flags (1 = has msgId), [i64 msgId], body
+ *   entityList:     u32 count, entity[count]
+ *   entityListChunk u32 chunk, u8 done, u32 count, entity[count]
+ *   entityDetails, hitmanEntity, cameraEntity, entityTransformUpdated:
+ *                   details
+ *   entityTransformOnlyUpdated:
+ *                   u64 id, u8 flags (1 = game entity, 2 = has relative transform), [u64 tblu], transform, [transform]
+ *   entity:         u64 id, u8 flags (1 = game entity, 2 = has name, 4 = has child count),
+ *                   [u64 tblu], string type, [string name], [u32 childCount]
+ *   details:        entity, u8 flags (1 = has transform, 2 = has relative transform),
+ *                   u32 interfaceCount, string[interfaceCount], [transform], [transform],
+ *                   u32 propertyCount, property[propertyCount]
+ *   transform:      f32 position[3], f32 rotation[3] (yaw, pitch, roll), f32 scale[3]
+ *   property:       string name, string type, u8 kind (0 = null, 1 = entity, 2 = json), [entity | string json]
+ */
+namespace EditorBinaryProtocol {
+	static_assert(std::endian::native == std::endian::little, "The binary editor protocol is little-endian.");
+
+	enum class EMessageType : uint8_t {
+		EntityList = 1,
+		EntityListChunk = 2,
+		EntityDetails = 3,
+		HitmanEntity = 4,
+		CameraEntity = 5,
+		EntityTransformUpdated = 6,
+		EntityTransformOnlyUpdated = 7,
+	};
+
+	enum class EPropertyValueKind : uint8_t {
+		Null = 0,
+		Entity = 1,
+		Json = 2,
+	};
+
+	struct MessageHeader {
+		EMessageType Type;
+		std::optional<int64_t> MessageId;
+	};
+
+	struct Transform {
+		std::array<float, 3> Position;
+		std::array<float, 3> Rotation;
+		std::array<float, 3> Scale;
+	};
+
+	struct Entity {
+		uint64_t Id = 0;
+
+		// Only set for entities spawned by the game.
+		std::optional<uint64_t> Tblu;
+		std::string_view Type;
+		std::optional<std::string_view> Name;
+		std::optional<uint32_t> ChildCount;
+	};
+
+	// Sent instead of the full details to clients that only want transforms in their transform updates.
+	struct EntityTransform {
+		uint64_t Id = 0;
+		std::optional<uint64_t> Tblu;
+		Transform WorldTransform;
+		std::optional<Transform> RelativeTransform;
+	};
+
+	struct PropertyValue {
+		std::string_view Name;
+		std::string_view Type;
+		EPropertyValueKind Kind = EPropertyValueKind::Null;
+		Entity EntityValue;
+		std::string_view JsonValue;
+	};
+
+	struct EntityDetails {
+		Entity Base;
+		std::vector<std::string_view> Interfaces;
+		std::optional<Transform> WorldTransform;
+		std::optional<Transform> RelativeTransform;
+		std::vector<PropertyValue> Properties;
+	};
+
+	/**
+	 * Append-only encoder. Like JsonWriter, clearing it keeps its buffer so it can be reused between messages.
+	 */
+	class Writer {
+	public:
+		explicit Writer(size_t p_ReserveSize = 16 * 1024) {
+			m_Buffer.reserve(p_ReserveSize);
+		}
+
+		void Clear() {
+			m_Buffer.clear();
+		}
+
+		[[nodiscard]] std::string_view View() const {
+			return m_Buffer;
+		}
+
+		void WriteU8(uint8_t p_Value) {
+			m_Buffer.push_back(static_cast<char>(p_Value));
+		}
+
+		void WriteU32(uint32_t p_Value) {
+			WriteRaw(&p_Value, sizeof(p_Value));
+		}
+
+		void WriteU64(uint64_t p_Value) {
+			WriteRaw(&p_Value, sizeof(p_Value));
+		}
+
+		void WriteI64(int64_t p_Value) {
+			WriteRaw(&p_Value, sizeof(p_Value));
+		}
+
+		void WriteF32(float p_Value) {
+			WriteRaw(&p_Value, sizeof(p_Value));
+		}
+
+		void WriteVarint(uint64_t p_Value) {
+			while (p_Value >= 0x80) {
+				m_Buffer.push_back(static_cast<char>((p_Value & 0x7F) | 0x80));
+				p_Value >>= 7;
+			}
+
+			m_Buffer.push_back(static_cast<char>(p_Value));
+		}
+
+		void WriteString(std::string_view p_Value) {
+			WriteVarint(p_Value.size());
+			m_Buffer.append(p_Value);
+		}
+
+		/**
+		 * Writes a placeholder for a value that is only known later, like the number of elements that pass a filter.
+		 * @return The offset to pass to PatchU8 / PatchU32.
+		 */
+		size_t ReserveU8() {
+			const size_t s_Offset = m_Buffer.size();
+			WriteU8(0);
+			return s_Offset;
+		}
+
+		size_t ReserveU32() {
+			const size_t s_Offset = m_Buffer.size();
+			WriteU32(0);
+			return s_Offset;
+		}
+
+		void PatchU8(size_t p_Offset, uint8_t p_Value) {
+			m_Buffer[p_Offset] = static_cast<char>(p_Value);
+		}
+
+		void PatchU32(size_t p_Offset, uint32_t p_Value) {
+			memcpy(m_Buffer.data() + p_Offset, &p_Value, sizeof(p_Value));
+		}
+
+		void WriteHeader(EMessageType p_Type, std::optional<int64_t> p_MessageId);
+		void WriteTransform(const Transform& p_Transform);
+		void WriteEntity(const Entity& p_Entity);
+		void WriteEntityTransform(const EntityTransform& p_Transform);
+		void WritePropertyValue(const PropertyValue& p_Property);
+		void WriteEntityDetails(const EntityDetails& p_Details);
+
+	private:
+		void WriteRaw(const void* p_Data, size_t p_Size) {
+			m_Buffer.append(static_cast<const char*>(p_Data), p_Size);
+		}
+
+		std::string m_Buffer;
+	};
+
+	/**
+	 * Decoder over a received message. Decoded strings point into the message buffer.
+	 * Throws std::out_of_range when the message is truncated and std::runtime_error when it is malformed.
+	 */
+	class Reader {
+	public:
+		explicit Reader(std::span<const std::byte> p_Data) : m_Data(p_Data) {}
+
+		explicit Reader(std::string_view p_Data) :
+			m_Data(reinterpret_cast<const std::byte*>(p_Data.data()), p_Data.size()) {}
+
+		[[nodiscard]] size_t GetRemaining() const {
+			return m_Data.size() - m_Position;
+		}
+
+		uint8_t ReadU8() {
+			uint8_t s_Value;
+			ReadRaw(&s_Value, sizeof(s_Value));
+			return s_Value;
+		}
+
+		uint32_t ReadU32() {
+			uint32_t s_Value;
+			ReadRaw(&s_Value, sizeof(s_Value));
+			return s_Value;
+		}
+
+		uint64_t ReadU64() {
+			uint64_t s_Value;
+			ReadRaw(&s_Value, sizeof(s_Value));
+			return s_Value;
+		}
+
+		int64_t ReadI64() {
+			int64_t s_Value;
+			ReadRaw(&s_Value, sizeof(s_Value));
+			return s_Value;
+		}
+
+		float ReadF32() {
+			float s_Value;
+			ReadRaw(&s_Value, sizeof(s_Value));
+			return s_Value;
+		}
+
+		uint64_t ReadVarint();
+		std::string_view ReadString();
+
+		MessageHeader ReadHeader();
+		Transform ReadTransform();
+		Entity ReadEntity();
+		EntityTransform ReadEntityTransform();
+		PropertyValue ReadPropertyValue();
+		EntityDetails ReadEntityDetails();
+
+	private:
+		void ReadRaw(void* p_Data, size_t p_Size);
+
+		std::span<const std::byte> m_Data;
+		size_t m_Position = 0;
+	};
+}
@@ -6,7 +6,8 @@
 #include <numbers>
 
 #include "Editor.h"
-#include "JsonHelpers.h"
+
+#include <Psapi.h>
 
 #include <Glacier/ZEntity.h>
 #include <Glacier/EntityFactory.h>
@@ -15,11 +16,88 @@
 
 #include <ResourceLib_HM3.h>
 
+#include <zlib.h>
+
 // 46735 is a phoneword for HMSDK
 constinit const char* c_EditorHost = "127.0.0.1";
 constinit const uint16_t c_EditorPort = 46735;
 
-EditorServer::EditorServer() {
+// Streamed entity lists stop producing chunks while more than this is waiting to be sent to the client,
+// and resume once the socket drains. Kept below uWS's default backpressure limit so chunks are never dropped.
+constexpr unsigned int c_EntityListMaxBufferedAmount = 32 * 1024;
+constexpr size_t c_DefaultEntityListChunkSize = 1000;
+constexpr size_t c_MaxEntityListChunkSize = 100000;
+
+// Tree deltas larger than this fraction of the tree are replaced by an entityTreeRebuilt event,
+// since re-listing the tree is about as cheap for clients at that point.
+constexpr size_t c_EntityTreeDeltaMinSize = 256;
+constexpr size_t c_EntityTreeDeltaMaxTreeFraction = 4;
+
+// Default rate limit for transform updates, in updates per second per client. Clients can change it in their hello message.
+constexpr uint32_t c_DefaultMaxTransformUpdateRate = 30;
+
+// Transform updates are held back while more than this is waiting to be sent to a client,
+// so a slow client can't build up a backlog of stale transforms.
+constexpr unsigned int c_TransformUpdateMaxBufferedAmount = 32 * 1024;
+
+// Batches are applied within a single frame, so this bounds how long a batch can stall the game.
+constexpr size_t c_MaxBatchCommandCount = 10000;
+
+// Entity queries return results in pages of at most this many entities.
+constexpr size_t c_DefaultEntityQueryLimit = 100;
+constexpr size_t c_MaxEntityQueryLimit = 10000;
+
+// Bounds the cost of compiling and running name patterns.
+constexpr size_t c_MaxEntityQueryPatternLength = 256;
+
+// Clients can only write snapshots to files with this extension in this directory, relative to the
+// working directory of the game, so they can't overwrite anything else.
+constexpr std::string_view c_SceneSnapshotExtension = ".zesn";
+constexpr std::string_view c_SceneSnapshotDirectory = "SceneSnapshots";
+
+// One in this many compressed messages is compressed again with zlib to estimate the compression ratio.
+constexpr uint64_t c_CompressionSampleInterval = 32;
+
+// Resolves a snapshot path from a client under the snapshot directory. Throws if it would end up anywhere else.
+static std::filesystem::path ResolveSceneSnapshotPath(std::string_view p_Path) {
+	const std::filesystem::path s_Path(std::u8string_view(reinterpret_cast<const char8_t*>(p_Path.data()), p_Path.size()));
+
+	if (s_Path.extension() != c_SceneSnapshotExtension) {
+		throw std::runtime_error(std::format("Scene snapshots must be saved to a {} file.", c_SceneSnapshotExtension));
+	}
+
+	if (s_Path.has_root_path()) {
+		throw std::runtime_error(std::format("Scene snapshot paths must be relative to the {} directory.", c_SceneSnapshotDirectory));
+	}
+
+	// Canonical, so neither .. nor links within the directory can lead out of it.
+	const auto s_Directory = std::filesystem::weakly_canonical(std::filesystem::absolute(c_SceneSnapshotDirectory));
+	const auto s_Resolved = std::filesystem::weakly_canonical(s_Directory / s_Path);
+	const auto s_Relative = s_Resolved.lexically_relative(s_Directory);
+
+	if (s_Relative.empty() || *s_Relative.begin() == "..") {
+		throw std::runtime_error(std::format("Scene snapshots can only be saved in the {} directory.", c_SceneSnapshotDirectory));
+	}
+
+	std::filesystem::create_directories(s_Resolved.parent_path());
+
+	return s_Resolved;
+}
+
+static std::chrono::steady_clock::duration GetMinTransformInterval(uint32_t p_MaxRate) {
+	if (p_MaxRate == 0) {
+		return std::chrono::steady_clock::duration::zero();
+	}
+
+	return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / p_MaxRate;
+}
+
+EditorServer::EditorServer() {}
+
+void EditorServer::Start(uWS::CompressOptions p_Compression, size_t p_CompressionThreshold) {
+	m_Compression = p_Compression;
+	m_CompressionThreshold = p_CompressionThreshold;
+
 	m_ServerThread = std::jthread(
 		[this]() {
 			auto* s_App = new uWS::App();
@@ -30,7 +108,7 @@ EditorServer::EditorServer() {
 
 			s_App->ws<SocketUserData>(
 				"/*", {
-					.compression = uWS::DISABLED,
+					.compression = m_Compression,
 					.open = [this](WebSocket* p_Socket) {
 						Logger::Debug("New editor connection established.");
 
@@ -38,7 +116,9 @@ EditorServer::EditorServer() {
 						const auto s_ClientIdStr = std::to_string(s_ClientId);
 
 						p_Socket->getUserData()->ClientId = s_ClientIdStr;
-						m_SocketUserDatas.push_back(p_Socket->getUserData());
+						p_Socket->getUserData()->MinTransformInterval = GetMinTransformInterval(c_DefaultMaxTransformUpdateRate);
+						m_Sockets.push_back(p_Socket);
+						m_SocketsByClientId[s_ClientIdStr] = p_Socket;
 					},
 					.message = [&](WebSocket* p_Socket, std::string_view p_Message, uWS::OpCode p_OpCode) {
 						Logger::Trace("Socket message received: {}", p_Message);
@@ -54,11 +134,16 @@ EditorServer::EditorServer() {
 							SendError(p_Socket, e.what(), std::nullopt);
 						}
 					},
+					.drain = [](WebSocket* p_Socket) {
+						ContinueEntityListStream(p_Socket);
+					},
 					.close = [this](WebSocket* p_Socket, int p_Code, std::string_view p_Message) {
 						Logger::Debug("Editor connection closed with code '{}' and message: {}", p_Code, p_Message);
 
-						auto s_Data = p_Socket->getUserData();
-						m_SocketUserDatas.erase(std::remove(m_SocketUserDatas.begin(), m_SocketUserDatas.end(), s_Data), m_SocketUserDatas.end());
+						ReleasePropertyWatches(p_Socket->getUserData());
+
+						m_Sockets.erase(std::remove(m_Sockets.begin(), m_Sockets.end(), p_Socket), m_Sockets.end());
+						m_SocketsByClientId.erase(p_Socket->getUserData()->ClientId);
 					}
 				}
 			);
@@ -102,10 +187,125 @@ EditorServer::~EditorServer() {
 
 bool EditorServer::m_Enabled = true;
 
+uWS::CompressOptions EditorServer::m_Compression = uWS::DISABLED;
+size_t EditorServer::m_CompressionThreshold = 0;
+
+std::atomic<uint64_t> EditorServer::m_CompressedMessages = 0;
+std::atomic<uint64_t> EditorServer::m_UncompressedMessages = 0;
+std::atomic<uint64_t> EditorServer::m_CompressedInputBytes = 0;
+std::atomic<uint64_t> EditorServer::m_SampledInputBytes = 0;
+std::atomic<uint64_t> EditorServer::m_SampledOutputBytes = 0;
+std::atomic<int64_t> EditorServer::m_CompressionTimeNs = 0;
+
+EntityTypeMetadataCache EditorServer::m_TypeMetadata;
+
+bool EditorServer::ShouldCompress(std::string_view p_Message) {
+	if (m_Compression == uWS::DISABLED || p_Message.size() < m_CompressionThreshold) {
+		m_UncompressedMessages.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	return true;
+}
+
+void EditorServer::RecordCompressedMessage(std::string_view p_Message, std::chrono::nanoseconds p_Time) {
+	const uint64_t s_Count = m_CompressedMessages.fetch_add(1, std::memory_order_relaxed);
+
+	m_CompressedInputBytes.fetch_add(p_Message.size(), std::memory_order_relaxed);
+	m_CompressionTimeNs.fetch_add(p_Time.count(), std::memory_order_relaxed);
+
+	// uWS doesn't tell us how large the compressed frame was, so compress a sample of the
+	// messages again with the same raw deflate settings to estimate the ratio.
+	if (s_Count % c_CompressionSampleInterval != 0) {
+		return;
+	}
+
+	z_stream s_Stream {};
+
+	if (deflateInit2(&s_Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		return;
+	}
+
+	thread_local std::vector<Bytef> s_Output;
+	s_Output.resize(deflateBound(&s_Stream, static_cast<uLong>(p_Message.size())));
+
+	s_Stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(p_Message.data()));
+	s_Stream.avail_in = static_cast<uInt>(p_Message.size());
+	s_Stream.next_out = s_Output.data();
+	s_Stream.avail_out = static_cast<uInt>(s_Output.size());
+
+	if (deflate(&s_Stream, Z_FINISH) == Z_STREAM_END) {
+		m_SampledInputBytes.fetch_add(p_Message.size(), std::memory_order_relaxed);
+		m_SampledOutputBytes.fetch_add(s_Stream.total_out, std::memory_order_relaxed);
+	}
+
+	deflateEnd(&s_Stream);
+}
+
+void EditorServer::Send(WebSocket* p_Socket, std::string_view p_Message, uWS::OpCode p_OpCode) {
+	if (!ShouldCompress(p_Message)) {
+		p_Socket->send(p_Message, p_OpCode);
+		return;
+	}
+
+	const auto s_Start = std::chrono::steady_clock::now();
+	p_Socket->send(p_Message, p_OpCode, true);
+	RecordCompressedMessage(p_Message, std::chrono::steady_clock::now() - s_Start);
+}
+
+void EditorServer::Publish(std::string_view p_Topic, std::string_view p_Message, uWS::OpCode p_OpCode) {
+	if (!ShouldCompress(p_Message)) {
+		m_App->publish(p_Topic, p_Message, p_OpCode);
+		return;
+	}
+
+	const auto s_Start = std::chrono::steady_clock::now();
+	m_App->publish(p_Topic, p_Message, p_OpCode, true);
+	RecordCompressedMessage(p_Message, std::chrono::steady_clock::now() - s_Start);
+}
+
+bool EditorServer::Publish(WebSocket* p_Sender, std::string_view p_Topic, std::string_view p_Message, uWS::OpCode p_OpCode) {
+	if (!ShouldCompress(p_Message)) {
+		return p_Sender->publish(p_Topic, p_Message, p_OpCode);
+	}
+
+	const auto s_Start = std::chrono::steady_clock::now();
+	const bool s_Published = p_Sender->publish(p_Topic, p_Message, p_OpCode, true);
+	RecordCompressedMessage(p_Message, std::chrono::steady_clock::now() - s_Start);
+
+	return s_Published;
+}
+
+EditorServerCompressionStats EditorServer::GetCompressionStats() const {
+	EditorServerCompressionStats s_Stats;
+
+	s_Stats.CompressedMessages = m_CompressedMessages.load(std::memory_order_relaxed);
+	s_Stats.UncompressedMessages = m_UncompressedMessages.load(std::memory_order_relaxed);
+	s_Stats.CompressedInputBytes = m_CompressedInputBytes.load(std::memory_order_relaxed);
+	s_Stats.CompressionTime = std::chrono::nanoseconds(m_CompressionTimeNs.load(std::memory_order_relaxed));
+
+	const uint64_t s_SampledOutputBytes = m_SampledOutputBytes.load(std::memory_order_relaxed);
+
+	if (s_SampledOutputBytes > 0) {
+		s_Stats.EstimatedRatio = static_cast<double>(m_SampledInputBytes.load(std::memory_order_relaxed)) / s_SampledOutputBytes;
+	}
+
+	return s_Stats;
+}
+
 void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message) noexcept(false) {
-	simdjson::ondemand::parser s_Parser;
-	const auto s_Json = simdjson::padded_string(p_Message);
-	simdjson::ondemand::document s_JsonMsg = s_Parser.iterate(s_Json);
+	auto* s_Data = p_Socket->getUserData();
+
+	// simdjson needs some readable padding past the end of the input, which the uWS message buffer doesn't guarantee.
+	if (s_Data->MessageBuffer.size() < p_Message.size() + simdjson::SIMDJSON_PADDING) {
+		s_Data->MessageBuffer.resize(p_Message.size() + simdjson::SIMDJSON_PADDING);
+	}
+
+	memcpy(s_Data->MessageBuffer.data(), p_Message.data(), p_Message.size());
+
+	simdjson::ondemand::document s_JsonMsg = s_Data->Parser.iterate(
+		s_Data->MessageBuffer.data(), p_Message.size(), s_Data->MessageBuffer.size()
+	);
 
 	const std::string_view s_Type = s_JsonMsg["type"];
 	Logger::Trace("Editor message type: {}", s_Type);
@@ -120,6 +320,26 @@ void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message) no
 
 	if (s_Type == "hello") {
 		p_Socket->getUserData()->Identifier = std::string_view(s_JsonMsg["identifier"]);
+
+		if (auto s_ProtocolField = s_JsonMsg.find_field_unordered("protocol"); s_ProtocolField.error() == simdjson::SUCCESS) {
+			const std::string_view s_Protocol = s_ProtocolField;
+
+			if (s_Protocol != "json" && s_Protocol != "binary") {
+				throw std::runtime_error(std::format("Unknown editor protocol: {}", s_Protocol));
+			}
+
+			p_Socket->getUserData()->BinaryProtocol = s_Protocol == "binary";
+		}
+
+		if (auto s_RateField = s_JsonMsg.find_field_unordered("maxTransformRate"); s_RateField.error() == simdjson::SUCCESS) {
+			const uint64_t s_MaxRate = s_RateField;
+			p_Socket->getUserData()->MinTransformInterval = GetMinTransformInterval(static_cast<uint32_t>(std::min<uint64_t>(s_MaxRate, UINT32_MAX)));
+		}
+
+		if (auto s_TransformOnlyField = s_JsonMsg.find_field_unordered("transformOnly"); s_TransformOnlyField.error() == simdjson::SUCCESS) {
+			p_Socket->getUserData()->TransformOnlyUpdates = bool(s_TransformOnlyField);
+		}
+
 		SendWelcome(p_Socket);
 	}
 	else if (s_Type == "selectEntity") {
@@ -152,15 +372,7 @@ void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message) no
 		);
 	}
 	else if (s_Type == "setEntityProperty") {
-		int32_t s_PropertyId;
-
-		if (s_JsonMsg["property"].type() == simdjson::ondemand::json_type::number) {
-			s_PropertyId = s_JsonMsg["property"];
-		}
-		else {
-			std::string_view s_PropertyName = s_JsonMsg["property"];
-			s_PropertyId = Hash::Crc32(s_PropertyName.data(), s_PropertyName.size());
-		}
+		const uint32_t s_PropertyId = ReadPropertyId(s_JsonMsg["property"]);
 
 		Plugin()->SetEntityProperty(
 			ReadEntitySelector(s_JsonMsg["entity"]),
@@ -187,9 +399,169 @@ void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message) no
 		);
 	}
 	else if (s_Type == "listEntities") {
-		Plugin()->LockEntityTree();
-		SendEntityList(p_Socket, Plugin()->GetEntityTree(), s_MessageId);
-		Plugin()->UnlockEntityTree();
+		bool s_Stream = false;
+		size_t s_ChunkSize = c_DefaultEntityListChunkSize;
+		std::optional<uint32_t> s_MaxDepth;
+		ZEntityRef s_RootEntity;
+
+		if (auto s_StreamField = s_JsonMsg.find_field_unordered("stream"); s_StreamField.error() == simdjson::SUCCESS) {
+			s_Stream = bool(s_StreamField);
+		}
+
+		if (auto s_ChunkSizeField = s_JsonMsg.find_field_unordered("chunkSize"); s_ChunkSizeField.error() == simdjson::SUCCESS) {
+			s_ChunkSize = std::clamp<size_t>(uint64_t(s_ChunkSizeField), 1, c_MaxEntityListChunkSize);
+		}
+
+		if (auto s_DepthField = s_JsonMsg.find_field_unordered("depth"); s_DepthField.error() == simdjson::SUCCESS) {
+			s_MaxDepth = static_cast<uint32_t>(std::min<uint64_t>(uint64_t(s_DepthField), UINT32_MAX));
+		}
+
+		if (auto s_RootField = s_JsonMsg.find_field_unordered("root"); s_RootField.error() == simdjson::SUCCESS) {
+			s_RootEntity = Plugin()->FindEntity(ReadEntitySelector(s_RootField));
+
+			if (!s_RootEntity) {
+				throw std::runtime_error("Could not find entity for the given selector.");
+			}
+		}
+
+		auto s_TreeLock = Plugin()->LockEntityTree();
+
+		const auto s_Tree = Plugin()->GetEntityTree();
+		const EntityTreeNode* s_Root = s_Tree ? &s_Tree->GetRoot() : nullptr;
+
+		if (s_RootEntity) {
+			s_Root = s_Tree ? s_Tree->FindNode(s_RootEntity) : nullptr;
+
+			if (!s_Root) {
+				throw std::runtime_error("The given entity is not part of the entity tree.");
+			}
+		}
+
+		if (s_Stream) {
+			// Chunks lock the tree themselves as they are produced.
+			s_TreeLock.unlock();
+			StreamEntityList(p_Socket, s_Tree, s_Root, s_MaxDepth, s_ChunkSize, s_MessageId);
+		}
+		else {
+			SendEntityList(p_Socket, s_Tree, s_Root, s_MaxDepth, s_MessageId);
+		}
+	}
+	else if (s_Type == "queryEntities") {
+		EntityQuery s_Query;
+		size_t s_Offset = 0;
+		size_t s_Limit = c_DefaultEntityQueryLimit;
+
+		if (auto s_TypeField = s_JsonMsg.find_field_unordered("entityType"); s_TypeField.error() == simdjson::SUCCESS) {
+			s_Query.TypeName = std::string(std::string_view(s_TypeField));
+		}
+
+		if (auto s_NameField = s_JsonMsg.find_field_unordered("name"); s_NameField.error() == simdjson::SUCCESS) {
+			s_Query.NameContains = std::string(std::string_view(s_NameField));
+		}
+
+		if (auto s_PatternField = s_JsonMsg.find_field_unordered("namePattern"); s_PatternField.error() == simdjson::SUCCESS) {
+			const std::string_view s_Pattern = s_PatternField;
+
+			if (s_Pattern.size() > c_MaxEntityQueryPatternLength) {
+				throw std::runtime_error(std::format("Name patterns can be at most {} characters long.", c_MaxEntityQueryPatternLength));
+			}
+
+			s_Query.NamePattern = std::string(s_Pattern);
+		}
+
+		if (auto s_TbluField = s_JsonMsg.find_field_unordered("tblu"); s_TbluField.error() == simdjson::SUCCESS) {
+			s_Query.TBLU = ReadResourceId(s_TbluField);
+		}
+
+		if (auto s_BoundsField = s_JsonMsg.find_field_unordered("bounds"); s_BoundsField.error() == simdjson::SUCCESS) {
+			auto s_Bounds = s_BoundsField.get_object();
+
+			s_Query.Bounds = EntityQueryBounds {
+				.Min = ReadVector3(s_Bounds["min"]),
+				.Max = ReadVector3(s_Bounds["max"]),
+			};
+		}
+
+		if (auto s_OffsetField = s_JsonMsg.find_field_unordered("offset"); s_OffsetField.error() == simdjson::SUCCESS) {
+			s_Offset = uint64_t(s_OffsetField);
+		}
+
+		if (auto s_LimitField = s_JsonMsg.find_field_unordered("limit"); s_LimitField.error() == simdjson::SUCCESS) {
+			s_Limit = std::clamp<size_t>(uint64_t(s_LimitField), 1, c_MaxEntityQueryLimit);
+		}
+
+		const auto s_TreeLock = Plugin()->LockEntityTree();
+
+		if (!Plugin()->GetEntityTree()) {
+			throw std::runtime_error("The entity tree hasn't been built yet.");
+		}
+
+		SendEntityQueryResult(p_Socket, Plugin()->QueryEntities(s_Query), s_Offset, s_Limit, s_MessageId);
+	}
+	else if (s_Type == "batch") {
+		EditorCommandBatch s_Batch;
+		s_Batch.ClientId = p_Socket->getUserData()->ClientId;
+		s_Batch.MessageId = s_MessageId;
+
+		if (auto s_AtomicField = s_JsonMsg.find_field_unordered("atomic"); s_AtomicField.error() == simdjson::SUCCESS) {
+			s_Batch.Atomic = bool(s_AtomicField);
+		}
+
+		for (auto s_Command : s_JsonMsg["commands"].get_array()) {
+			if (s_Batch.Commands.size() == c_MaxBatchCommandCount) {
+				throw std::runtime_error(std::format("Batches can't have more than {} commands.", c_MaxBatchCommandCount));
+			}
+
+			s_Batch.Commands.push_back(ReadEditorCommand(s_Command.get_object()));
+		}
+
+		// Applied on the game thread at the start of the next frame. The result is sent back as a batchResult event.
+		Plugin()->QueueCommandBatch(std::move(s_Batch));
+	}
+	else if (s_Type == "saveSceneSnapshot") {
+		const std::string_view s_Path = s_JsonMsg["path"];
+
+		// Captured on the game thread at the start of the next frame, and written to disk in the background.
+		// The result is sent back as a sceneSnapshotSaved event.
+		Plugin()->QueueSceneSnapshot({
+			.Path = ResolveSceneSnapshotPath(s_Path),
+			.ClientId = p_Socket->getUserData()->ClientId,
+			.MessageId = s_MessageId,
+		});
+	}
+	else if (s_Type == "watchProperties") {
+		const auto s_Entity = Plugin()->FindEntity(ReadEntitySelector(s_JsonMsg["entity"]));
+
+		if (!s_Entity) {
+			throw std::runtime_error("Could not find entity for the given selector.");
+		}
+
+		std::vector<uint32_t> s_PropertyIds;
+
+		for (auto s_Property : s_JsonMsg["properties"].get_array()) {
+			s_PropertyIds.push_back(ReadPropertyId(s_Property.value()));
+		}
+
+		WatchProperties(p_Socket, s_Entity, s_PropertyIds);
+	}
+	else if (s_Type == "unwatchProperties") {
+		const auto s_Entity = Plugin()->FindEntity(ReadEntitySelector(s_JsonMsg["entity"]));
+
+		if (!s_Entity) {
+			throw std::runtime_error("Could not find entity for the given selector.");
+		}
+
+		std::optional<std::vector<uint32_t>> s_PropertyIds;
+
+		if (auto s_PropertiesField = s_JsonMsg.find_field_unordered("properties"); s_PropertiesField.error() == simdjson::SUCCESS) {
+			s_PropertyIds.emplace();
+
+			for (auto s_Property : s_PropertiesField.get_array()) {
+				s_PropertyIds->push_back(ReadPropertyId(s_Property.value()));
+			}
+		}
+
+		UnwatchProperties(p_Socket, s_Entity, std::move(s_PropertyIds));
 	}
 	else if (s_Type == "getEntityDetails") {
 		const auto s_Selector = ReadEntitySelector(s_JsonMsg["entity"]);
@@ -205,30 +577,89 @@ void EditorServer::OnMessage(WebSocket* p_Socket, std::string_view p_Message) no
 	else if (s_Type == "rebuildEntityTree") {
 		Plugin()->RebuildEntityTree();
 	}
+	else if (s_Type == "getServerStats") {
+		SendServerStats(p_Socket, s_MessageId);
+	}
 	else {
 		throw std::runtime_error(std::format("Unknown editor message type: {}", s_Type));
 	}
 }
 
+JsonWriter& EditorServer::GetEventWriter() {
+	// Events are only ever built on the server thread, so a single writer can be reused for every
+	// message and keeps its buffer around between them.
+	thread_local JsonWriter s_Writer;
+	s_Writer.Clear();
+	return s_Writer;
+}
+
+EditorBinaryProtocol::Writer& EditorServer::GetBinaryEventWriter() {
+	thread_local EditorBinaryProtocol::Writer s_Writer;
+	s_Writer.Clear();
+	return s_Writer;
+}
+
 void EditorServer::SendWelcome(EditorServer::WebSocket* p_Socket) {
 	Logger::Info(
 		"Client with identifier '{}' connected to the editor server. Sending welcome message.",
 		p_Socket->getUserData()->Identifier
 	);
 
+	const bool s_BinaryProtocol = p_Socket->getUserData()->BinaryProtocol;
+
 	// Subscribe the client to messages.
 	p_Socket->subscribe("all");
 	p_Socket->subscribe(p_Socket->getUserData()->ClientId);
 
-	// TODO: Ideally these json events would be streamed directly
-	// into the socket, but don't care at the moment.
-	std::ostringstream s_Event;
+	auto& s_Event = GetEventWriter();
+
+	s_Event.BeginObject();
+	s_Event.Key<"type">().Value("welcome");
+	s_Event.Key<"protocol">().Value(s_BinaryProtocol ? "binary" : "json");
+	s_Event.EndObject();
+
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
+}
+
+void EditorServer::SendServerStats(WebSocket* p_Socket, std::optional<int64_t> p_MessageId) {
+	PROCESS_MEMORY_COUNTERS_EX s_MemoryCounters {};
+	GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&s_MemoryCounters), sizeof(s_MemoryCounters));
+
+	size_t s_PendingEvents;
+	size_t s_PropertyWatches;
+
+	{
+		std::scoped_lock s_Lock(m_PendingEventsMutex);
+		s_PendingEvents = m_PendingEvents.size();
+	}
+
+	{
+		std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+		s_PropertyWatches = m_PropertyWatches.size();
+	}
+
+	const auto s_Compression = GetCompressionStats();
+
+	auto& s_Event = GetEventWriter();
+
+	s_Event.BeginObject();
+
+	if (p_MessageId) {
+		s_Event.Key<"msgId">().Value(*p_MessageId);
+	}
+
+	s_Event.Key<"type">().Value("serverStats");
+	s_Event.Key<"clients">().Value(static_cast<uint64_t>(m_Sockets.size()));
+	s_Event.Key<"workingSetBytes">().Value(static_cast<uint64_t>(s_MemoryCounters.WorkingSetSize));
+	s_Event.Key<"privateBytes">().Value(static_cast<uint64_t>(s_MemoryCounters.PrivateUsage));
+	s_Event.Key<"pendingEvents">().Value(static_cast<uint64_t>(s_PendingEvents));
+	s_Event.Key<"propertyWatches">().Value(static_cast<uint64_t>(s_PropertyWatches));
+	s_Event.Key<"compressedMessages">().Value(s_Compression.CompressedMessages);
+	s_Event.Key<"uncompressedMessages">().Value(s_Compression.UncompressedMessages);
 
-	s_Event << "{";
-	s_Event << write_json("type") << ":" << write_json("welcome");
-	s_Event << "}";
+	s_Event.EndObject();
 
-	p_Socket->send(s_Event.str(), uWS::OpCode::TEXT);
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
 }
 
 void EditorServer::SendHitmanEntity(WebSocket* p_Socket, std::optional<int64_t> p_MessageId) {
@@ -244,20 +675,30 @@ void EditorServer::SendHitmanEntity(WebSocket* p_Socket, std::optional<int64_t>
 		return;
 	}
 
-	std::ostringstream s_Event;
+	if (p_Socket->getUserData()->BinaryProtocol) {
+		auto& s_Event = GetBinaryEventWriter();
 
-	s_Event << "{";
+		s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::HitmanEntity, p_MessageId);
+		WriteEntityDetails(s_Event, s_LocalHitman.m_ref);
+
+		Send(p_Socket, s_Event.View(), uWS::OpCode::BINARY);
+		return;
+	}
+
+	auto& s_Event = GetEventWriter();
+
+	s_Event.BeginObject();
 
 	if (p_MessageId) {
-		s_Event << write_json("msgId") << ":" << write_json(*p_MessageId) << ",";
+		s_Event.Key<"msgId">().Value(*p_MessageId);
 	}
 
-	s_Event << write_json("type") << ":" << write_json("hitmanEntity") << ",";
-	s_Event << write_json("entity") << ":";
+	s_Event.Key<"type">().Value("hitmanEntity");
+	s_Event.Key<"entity">();
 	WriteEntityDetails(s_Event, s_LocalHitman.m_ref);
-	s_Event << "}";
+	s_Event.EndObject();
 
-	p_Socket->send(s_Event.str(), uWS::OpCode::TEXT);
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
 }
 
 void EditorServer::SendCameraEntity(WebSocket* p_Socket, std::optional<int64_t> p_MessageId) {
@@ -275,36 +716,46 @@ void EditorServer::SendCameraEntity(WebSocket* p_Socket, std::optional<int64_t>
 	ZEntityRef s_Ref;
 	s_CurrentCamera->GetID(&s_Ref);
 
-	std::ostringstream s_Event;
+	if (p_Socket->getUserData()->BinaryProtocol) {
+		auto& s_Event = GetBinaryEventWriter();
+
+		s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::CameraEntity, p_MessageId);
+		WriteEntityDetails(s_Event, s_Ref);
+
+		Send(p_Socket, s_Event.View(), uWS::OpCode::BINARY);
+		return;
+	}
+
+	auto& s_Event = GetEventWriter();
 
-	s_Event << "{";
+	s_Event.BeginObject();
 
 	if (p_MessageId) {
-		s_Event << write_json("msgId") << ":" << write_json(*p_MessageId) << ",";
+		s_Event.Key<"msgId">().Value(*p_MessageId);
 	}
 
-	s_Event << write_json("type") << ":" << write_json("cameraEntity") << ",";
-	s_Event << write_json("entity") << ":";
+	s_Event.Key<"type">().Value("cameraEntity");
+	s_Event.Key<"entity">();
 	WriteEntityDetails(s_Event, s_Ref);
-	s_Event << "}";
+	s_Event.EndObject();
 
-	p_Socket->send(s_Event.str(), uWS::OpCode::TEXT);
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
 }
 
 void EditorServer::SendError(EditorServer::WebSocket* p_Socket, std::string p_Message, std::optional<int64_t> p_MessageId) {
-	std::ostringstream s_Event;
+	auto& s_Event = GetEventWriter();
 
-	s_Event << "{";
+	s_Event.BeginObject();
 
 	if (p_MessageId) {
-		s_Event << write_json("msgId") << ":" << write_json(*p_MessageId) << ",";
+		s_Event.Key<"msgId">().Value(*p_MessageId);
 	}
 
-	s_Event << write_json("type") << ":" << write_json("error") << ",";
-	s_Event << write_json("message") << ":" << write_json(p_Message);
-	s_Event << "}";
+	s_Event.Key<"type">().Value("error");
+	s_Event.Key<"message">().Value(p_Message);
+	s_Event.EndObject();
 
-	p_Socket->send(s_Event.str(), uWS::OpCode::TEXT);
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
 }
 
 void EditorServer::OnEntitySelected(ZEntityRef p_Entity, std::optional<std::string> p_ByClient) {
@@ -321,22 +772,22 @@ void EditorServer::OnEntitySelected(ZEntityRef p_Entity, std::optional<std::stri
 			return;
 		}
 
-		std::ostringstream s_Event;
+		auto& s_Event = GetEventWriter();
 
-		s_Event << "{";
+		s_Event.BeginObject();
 
 		if (!p_Entity) {
-			s_Event << write_json("type") << ":" << write_json("entityDeselected");
+			s_Event.Key<"type">().Value("entityDeselected");
 		}
 		else {
-			s_Event << write_json("type") << ":" << write_json("entitySelected") << ",";
-			s_Event << write_json("entity") << ":";
+			s_Event.Key<"type">().Value("entitySelected");
+			s_Event.Key<"entity">();
 			WriteEntityDetails(s_Event, p_Entity);
 		}
 
-		s_Event << "}";
+		s_Event.EndObject();
 
-		PublishEvent(s_Event.str(), p_ByClient);
+		PublishEvent(s_Event.View(), p_ByClient);
 	});
 }
 
@@ -345,27 +796,8 @@ void EditorServer::OnEntityTransformChanged(ZEntityRef p_Entity, std::optional<s
 		Logger::Info("EditorServer disabled. Skipping OnEntityTransformChanged.");
 		return;
 	}
-	if (!m_Loop) {
-		return;
-	}
-
-	m_Loop->defer([this, p_Entity, p_ByClient](){
-		if (!m_App) {
-			return;
-		}
-
-		std::ostringstream s_Event;
-
-		s_Event << "{";
 
-		s_Event << write_json("type") << ":" << write_json("entityTransformUpdated") << ",";
-		s_Event << write_json("entity") << ":";
-		WriteEntityDetails(s_Event, p_Entity);
-
-		s_Event << "}";
-
-		PublishEvent(s_Event.str(), p_ByClient);
-	});
+	QueueEntityEvent({ p_Entity, EEntityEventKind::TransformChanged, 0, std::move(p_ByClient) });
 }
 
 void EditorServer::OnEntityNameChanged(ZEntityRef p_Entity, std::optional<std::string> p_ByClient) {
@@ -373,93 +805,480 @@ void EditorServer::OnEntityNameChanged(ZEntityRef p_Entity, std::optional<std::s
 		Logger::Info("EditorServer disabled. Skipping OnEntityNameChanged.");
 		return;
 	}
-	if (!m_Loop) {
+
+	QueueEntityEvent({ p_Entity, EEntityEventKind::NameChanged, 0, std::move(p_ByClient) });
+}
+
+void EditorServer::OnEntityPropertySet(ZEntityRef p_Entity, uint32_t p_PropertyId, std::optional<std::string> p_ByClient) {
+	if (!m_Enabled) {
+		Logger::Info("EditorServer disabled. Skipping OnEntityPropertySet.");
 		return;
 	}
 
-	m_Loop->defer([this, p_Entity, p_ByClient](){
-		if (!m_App) {
-			return;
-		}
+	QueueEntityEvent({ p_Entity, EEntityEventKind::PropertySet, p_PropertyId, std::move(p_ByClient) });
+}
 
-		std::ostringstream s_Event;
+void EditorServer::QueueEntityEvent(PendingEntityEvent p_Event) {
+	if (!m_Loop || !p_Event.Entity) {
+		return;
+	}
 
-		s_Event << "{";
+	std::scoped_lock s_Lock(m_PendingEventsMutex);
 
-		s_Event << write_json("type") << ":" << write_json("entityNameUpdated") << ",";
-		s_Event << write_json("entity") << ":";
-		WriteEntityDetails(s_Event, p_Entity);
+	const PendingEntityEventKey s_Key { p_Event.Entity, p_Event.Kind, p_Event.PropertyId };
+	const auto [s_It, s_Inserted] = m_PendingEventIndices.try_emplace(s_Key, m_PendingEvents.size());
+
+	if (s_Inserted) {
+		m_PendingEvents.push_back(std::move(p_Event));
+		return;
+	}
 
-		s_Event << "}";
+	// The event is already queued, and it will send the latest state anyway. If another client caused
+	// this change, the client that caused the previous one needs to get the update as well.
+	auto& s_Pending = m_PendingEvents[s_It->second];
 
-		PublishEvent(s_Event.str(), p_ByClient);
-	});
+	if (s_Pending.ByClient != p_Event.ByClient) {
+		s_Pending.ByClient = std::nullopt;
+	}
 }
 
-void EditorServer::OnEntityPropertySet(ZEntityRef p_Entity, uint32_t p_PropertyId, std::optional<std::string> p_ByClient) {
-	if (!m_Enabled) {
-		Logger::Info("EditorServer disabled. Skipping OnEntityPropertySet.");
-		return;
-	}
-	if (!m_Loop) {
+void EditorServer::FlushEvents() {
+	if (!m_Enabled || !m_Loop) {
 		return;
 	}
 
-	m_Loop->defer([this, p_Entity, p_PropertyId, p_ByClient](){
-		if (!m_App) {
-			return;
-		}
+	SamplePropertyWatches();
 
-		const auto s_EntityType = p_Entity->GetType();
+	{
+		std::scoped_lock s_Lock(m_PendingEventsMutex);
 
-		if (!s_EntityType) {
+		if (m_PendingEvents.empty() && !m_HasPendingTransforms) {
 			return;
 		}
+	}
+
+	// Don't pile up flushes if the server thread is falling behind the game.
+	if (m_FlushScheduled.exchange(true)) {
+		return;
+	}
 
-		const auto s_Property = s_EntityType->FindProperty(p_PropertyId);
+	m_Loop->defer([this](){
+		m_FlushScheduled = false;
 
-		if (!s_Property || !s_Property->m_pType) {
+		if (!m_App) {
 			return;
 		}
 
-		const auto s_PropertyInfo = s_Property->m_pType->getPropertyInfo();
+		SendPendingEvents();
+	});
+}
 
-		if (!s_PropertyInfo) {
-			return;
+void EditorServer::SendPendingEvents() {
+	std::vector<PendingEntityEvent> s_Events;
+
+	{
+		std::scoped_lock s_Lock(m_PendingEventsMutex);
+		s_Events.swap(m_PendingEvents);
+		m_PendingEventIndices.clear();
+	}
+
+	SendTransformUpdates(s_Events);
+
+	for (const auto& s_Event : s_Events) {
+		switch (s_Event.Kind) {
+			case EEntityEventKind::NameChanged:
+				SendEntityNameChanged(s_Event.Entity, s_Event.ByClient);
+				break;
+			case EEntityEventKind::PropertySet:
+				SendEntityPropertySet(s_Event.Entity, s_Event.PropertyId, s_Event.ByClient);
+				break;
+			case EEntityEventKind::TransformChanged:
+				break;
 		}
+	}
+}
 
-		std::ostringstream s_Event;
+void EditorServer::SendTransformUpdates(const std::vector<PendingEntityEvent>& p_Events) {
+	// Each update is encoded at most once per flavor, no matter how many clients it goes to.
+	struct EncodedTransformUpdate {
+		std::string Json;
+		std::string Binary;
+		std::string JsonTransformOnly;
+		std::string BinaryTransformOnly;
+	};
 
-		s_Event << "{";
+	std::unordered_map<ZEntityRef, EncodedTransformUpdate> s_EncodedUpdates;
 
-		s_Event << write_json("type") << ":" << write_json("entityPropertyChanged") << ",";
-		s_Event << write_json("entity") << ":";
-		WriteEntityDetails(s_Event, p_Entity);
-		s_Event << ",";
-		s_Event << write_json("property") << ":";
+	const auto s_Now = std::chrono::steady_clock::now();
+	bool s_HasPendingTransforms = false;
 
-		if (s_PropertyInfo->m_pType->typeInfo()->isResource() || s_PropertyInfo->m_nPropertyID != s_Property->m_nPropertyId) {
-			// Some properties don't have a name for some reason. Try to find using RL.
-			const auto s_PropertyName = HM3_GetPropertyName(s_Property->m_nPropertyId);
+	for (auto* s_Socket : m_Sockets) {
+		auto* s_Data = s_Socket->getUserData();
 
-			if (s_PropertyName.Size > 0) {
-				s_Event << write_json(std::string_view(s_PropertyName.Data, s_PropertyName.Size)) << ",";
-			} else {
-				s_Event << write_json(s_Property->m_nPropertyId) << ",";
-			}
-		} else {
-			s_Event << write_json(s_PropertyInfo->m_pName) << ",";
+		// Clients only get events once they've said hello.
+		if (!s_Socket->isSubscribed("all")) {
+			continue;
 		}
 
-		s_Event << write_json("value") << ":";
-		WriteProperty(s_Event, p_Entity, s_Property);
+		for (const auto& s_Event : p_Events) {
+			if (s_Event.Kind == EEntityEventKind::TransformChanged && s_Event.ByClient != s_Data->ClientId) {
+				s_Data->PendingTransforms.insert(s_Event.Entity);
+			}
+		}
+
+		if (s_Data->PendingTransforms.empty()) {
+			continue;
+		}
+
+		if (s_Now < s_Data->NextTransformUpdate || s_Socket->getBufferedAmount() > c_TransformUpdateMaxBufferedAmount) {
+			s_HasPendingTransforms = true;
+			continue;
+		}
+
+		for (const auto& s_Entity : s_Data->PendingTransforms) {
+			auto& s_Encoded = s_EncodedUpdates[s_Entity];
+
+			// Entities without a transform have nothing but their details to send.
+			const bool s_TransformOnly = s_Data->TransformOnlyUpdates && s_Entity.QueryInterface<ZSpatialEntity>();
+
+			if (s_Data->BinaryProtocol) {
+				auto& s_Message = s_TransformOnly ? s_Encoded.BinaryTransformOnly : s_Encoded.Binary;
+
+				if (s_Message.empty()) {
+					auto& s_Event = GetBinaryEventWriter();
+
+					if (s_TransformOnly) {
+						s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::EntityTransformOnlyUpdated, std::nullopt);
+						WriteEntityTransform(s_Event, s_Entity);
+					}
+					else {
+						s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::EntityTransformUpdated, std::nullopt);
+						WriteEntityDetails(s_Event, s_Entity);
+					}
+
+					s_Message = s_Event.View();
+				}
+
+				Send(s_Socket, s_Message, uWS::OpCode::BINARY);
+			}
+			else {
+				auto& s_Message = s_TransformOnly ? s_Encoded.JsonTransformOnly : s_Encoded.Json;
+
+				if (s_Message.empty()) {
+					auto& s_Event = GetEventWriter();
+
+					s_Event.BeginObject();
+					s_Event.Key<"type">().Value("entityTransformUpdated");
+					s_Event.Key<"entity">();
+
+					if (s_TransformOnly) {
+						WriteEntityTransform(s_Event, s_Entity);
+					}
+					else {
+						WriteEntityDetails(s_Event, s_Entity);
+					}
+
+					s_Event.EndObject();
+
+					s_Message = s_Event.View();
+				}
+
+				Send(s_Socket, s_Message, uWS::OpCode::TEXT);
+			}
+		}
+
+		s_Data->PendingTransforms.clear();
+		s_Data->NextTransformUpdate = s_Now + s_Data->MinTransformInterval;
+	}
+
+	m_HasPendingTransforms = s_HasPendingTransforms;
+}
+
+void EditorServer::SendEntityNameChanged(ZEntityRef p_Entity, const std::optional<std::string>& p_ByClient) {
+	auto& s_Event = GetEventWriter();
+
+	s_Event.BeginObject();
+
+	s_Event.Key<"type">().Value("entityNameUpdated");
+	s_Event.Key<"entity">();
+	WriteEntityDetails(s_Event, p_Entity);
+
+	s_Event.EndObject();
+
+	PublishEvent(s_Event.View(), p_ByClient);
+}
+
+void EditorServer::SendEntityPropertySet(ZEntityRef p_Entity, uint32_t p_PropertyId, const std::optional<std::string>& p_ByClient) {
+	const auto s_Metadata = m_TypeMetadata.Get(p_Entity->GetType());
+	const auto* s_Property = s_Metadata ? s_Metadata->FindProperty(p_PropertyId) : nullptr;
+
+	if (!s_Property) {
+		return;
+	}
+
+	auto& s_Event = GetEventWriter();
+
+	s_Event.BeginObject();
+
+	s_Event.Key<"type">().Value("entityPropertyChanged");
+	s_Event.Key<"entity">();
+	WriteEntityDetails(s_Event, p_Entity);
+	s_Event.Key<"property">().Value(s_Property->Name);
+	s_Event.Key<"value">();
+	WriteProperty(s_Event, p_Entity, *s_Property);
+
+	s_Event.EndObject();
+
+	PublishEvent(s_Event.View(), p_ByClient);
+}
+
+void EditorServer::WatchProperties(WebSocket* p_Socket, ZEntityRef p_Entity, const std::vector<uint32_t>& p_PropertyIds) {
+	const auto s_EntityType = p_Entity->GetType();
+	const auto s_Metadata = m_TypeMetadata.Get(s_EntityType);
+
+	// Look up every property before adding any, so a bad id doesn't leave the request half applied.
+	std::vector<const PropertyDescriptor*> s_Properties;
+	s_Properties.reserve(p_PropertyIds.size());
+
+	for (const auto s_PropertyId : p_PropertyIds) {
+		auto* s_Property = s_EntityType ? s_EntityType->FindProperty(s_PropertyId) : nullptr;
+
+		if (!s_Property || !s_Property->m_pType) {
+			throw std::runtime_error(std::format("Could not find property {} on the given entity.", s_PropertyId));
+		}
+
+		// Only properties with type information have a descriptor.
+		const auto* s_Descriptor = s_Metadata->FindProperty(s_PropertyId);
+
+		if (!s_Descriptor) {
+			throw std::runtime_error(std::format("Property {} has no type information and can't be watched.", s_PropertyId));
+		}
+
+		s_Properties.push_back(s_Descriptor);
+	}
+
+	auto* s_Data = p_Socket->getUserData();
+
+	std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+
+	for (size_t i = 0; i < s_Properties.size(); ++i) {
+		const PropertyWatchKey s_Key { p_Entity, p_PropertyIds[i] };
+
+		if (!s_Data->WatchedProperties.insert(s_Key).second) {
+			continue;
+		}
+
+		auto& s_Watch = m_PropertyWatches[s_Key];
+		s_Watch.Metadata = s_Metadata;
+		s_Watch.Property = s_Properties[i];
+		++s_Watch.Watchers;
+
+		// Resample from scratch so the new watcher gets the current value on the next frame.
+		// Clients that were already watching get it again as well.
+		s_Watch.HasValue = false;
+	}
+}
+
+void EditorServer::UnwatchProperties(WebSocket* p_Socket, ZEntityRef p_Entity, std::optional<std::vector<uint32_t>> p_PropertyIds) {
+	auto* s_Data = p_Socket->getUserData();
+
+	std::vector<PropertyWatchKey> s_Keys;
+
+	if (p_PropertyIds) {
+		for (const auto s_PropertyId : *p_PropertyIds) {
+			s_Keys.push_back({ p_Entity, s_PropertyId });
+		}
+	}
+	else {
+		for (const auto& s_Key : s_Data->WatchedProperties) {
+			if (s_Key.Entity == p_Entity) {
+				s_Keys.push_back(s_Key);
+			}
+		}
+	}
+
+	std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+
+	for (const auto& s_Key : s_Keys) {
+		if (!s_Data->WatchedProperties.erase(s_Key)) {
+			continue;
+		}
+
+		if (const auto it = m_PropertyWatches.find(s_Key); it != m_PropertyWatches.end() && --it->second.Watchers == 0) {
+			m_PropertyWatches.erase(it);
+		}
+	}
+}
+
+void EditorServer::ReleasePropertyWatches(SocketUserData* p_Data) {
+	std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+
+	for (const auto& s_Key : p_Data->WatchedProperties) {
+		if (const auto it = m_PropertyWatches.find(s_Key); it != m_PropertyWatches.end() && --it->second.Watchers == 0) {
+			m_PropertyWatches.erase(it);
+		}
+	}
+
+	p_Data->WatchedProperties.clear();
+}
+
+void EditorServer::ReleaseRemovedEntities(std::shared_ptr<const EntityTree> p_Tree) {
+	// The tree is immutable, so it can be searched without the lock for as long as it is kept alive.
+	ReleaseEntities([p_Tree = std::move(p_Tree)](ZEntityRef p_Entity) {
+		return !p_Tree->FindNode(p_Entity);
+	});
+}
+
+void EditorServer::ReleaseEntity(ZEntityRef p_Entity) {
+	ReleaseEntities([p_Entity](ZEntityRef p_Other) {
+		return p_Other == p_Entity;
+	});
+}
+
+void EditorServer::ReleaseEntities(std::function<bool(ZEntityRef)> p_IsReleased) {
+	if (!m_Enabled || !m_Loop) {
+		return;
+	}
+
+	// Sampled and queued on the game thread, so these have to be gone before the entities are.
+	{
+		std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+
+		std::erase_if(m_PropertyWatches, [&](const auto& p_Watch) {
+			return p_IsReleased(p_Watch.first.Entity);
+		});
+	}
+
+	{
+		std::scoped_lock s_Lock(m_PendingEventsMutex);
+
+		if (std::erase_if(m_PendingEvents, [&](const PendingEntityEvent& p_Event) { return p_IsReleased(p_Event.Entity); }) > 0) {
+			m_PendingEventIndices.clear();
+
+			for (size_t i = 0; i < m_PendingEvents.size(); ++i) {
+				const auto& s_Event = m_PendingEvents[i];
+				m_PendingEventIndices.emplace(PendingEntityEventKey { s_Event.Entity, s_Event.Kind, s_Event.PropertyId }, i);
+			}
+		}
+	}
+
+	// The watches and rate limited transform updates of each client are only used on the server thread.
+	m_Loop->defer([this, p_IsReleased = std::move(p_IsReleased)](){
+		if (!m_App) {
+			return;
+		}
+
+		for (auto* s_Socket : m_Sockets) {
+			auto* s_Data = s_Socket->getUserData();
+
+			std::erase_if(s_Data->PendingTransforms, p_IsReleased);
+			std::erase_if(s_Data->WatchedProperties, [&](const PropertyWatchKey& p_Key) {
+				return p_IsReleased(p_Key.Entity);
+			});
+		}
+	});
+}
+
+void EditorServer::SamplePropertyWatches() {
+	// Changed properties along with their encoded entry in an entityPropertiesChanged event.
+	// They're encoded here since their entities are only guaranteed to be alive on the game thread.
+	std::vector<std::pair<PropertyWatchKey, std::string>> s_Changes;
+
+	{
+		std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+
+		if (m_PropertyWatches.empty()) {
+			return;
+		}
+
+		thread_local JsonWriter s_Writer(1024);
+
+		for (auto& [s_Key, s_Watch] : m_PropertyWatches) {
+			const auto& s_Property = *s_Watch.Property;
+
+			// Properties with a getter have to be copied out first. Everything else is compared in place.
+			auto* s_Value = ReadPropertyData(s_Key.Entity, s_Property);
+
+			const auto* s_Bytes = static_cast<const char*>(s_Value);
+			const bool s_Changed = !s_Watch.HasValue || !std::equal(
+				s_Bytes, s_Bytes + s_Property.TypeSize, s_Watch.LastValue.begin(), s_Watch.LastValue.end()
+			);
+
+			if (s_Changed) {
+				s_Watch.LastValue.assign(s_Bytes, s_Bytes + s_Property.TypeSize);
+				s_Watch.HasValue = true;
+
+				s_Writer.Clear();
+				s_Writer.BeginObject();
+				s_Writer.Key<"entity">().BeginObject();
+				WriteEntitySelectorFields(s_Writer, s_Key.Entity);
+				s_Writer.EndObject();
+				s_Writer.Key<"property">().Value(s_Property.Name);
+				s_Writer.Key<"value">().BeginObject();
+				s_Writer.Key<"type">().Value(s_Property.TypeName);
+				s_Writer.Key<"data">();
+				WritePropertyData(s_Writer, s_Property, s_Value);
+				s_Writer.EndObject();
+				s_Writer.EndObject();
+			}
+
+			ReleasePropertyData(s_Property, s_Value);
+
+			if (!s_Changed) {
+				continue;
+			}
+
+			s_Changes.emplace_back(s_Key, std::string(s_Writer.View()));
+		}
+	}
 
-		s_Event << "}";
+	if (s_Changes.empty()) {
+		return;
+	}
+
+	m_Loop->defer([this, s_Changes = std::move(s_Changes)](){
+		if (!m_App) {
+			return;
+		}
 
-		PublishEvent(s_Event.str(), p_ByClient);
+		SendPropertyChanges(s_Changes);
 	});
 }
 
+void EditorServer::SendPropertyChanges(const std::vector<std::pair<PropertyWatchKey, std::string>>& p_Changes) {
+	auto& s_Event = GetEventWriter();
+
+	for (auto* s_Socket : m_Sockets) {
+		const auto& s_Watched = s_Socket->getUserData()->WatchedProperties;
+
+		if (s_Watched.empty()) {
+			continue;
+		}
+
+		s_Event.Clear();
+		s_Event.BeginObject();
+		s_Event.Key<"type">().Value("entityPropertiesChanged");
+		s_Event.Key<"changes">().BeginArray();
+
+		bool s_HasChanges = false;
+
+		for (const auto& [s_Key, s_Change] : p_Changes) {
+			// The client might have stopped watching the property since it was sampled.
+			if (s_Watched.contains(s_Key)) {
+				s_Event.RawValue(s_Change);
+				s_HasChanges = true;
+			}
+		}
+
+		s_Event.EndArray();
+		s_Event.EndObject();
+
+		if (s_HasChanges) {
+			Send(s_Socket, s_Event.View(), uWS::OpCode::TEXT);
+		}
+	}
+}
+
 void EditorServer::OnSceneLoading(const std::string& p_Scene, const std::vector<std::string>& p_Bricks) {
 	if (!m_Enabled) {
 		Logger::Info("EditorServer disabled. Skipping OnSceneLoading.");
@@ -474,31 +1293,23 @@ void EditorServer::OnSceneLoading(const std::string& p_Scene, const std::vector<
 			return;
 		}
 
-		std::ostringstream s_Event;
-
-		s_Event << "{";
+		auto& s_Event = GetEventWriter();
 
-		s_Event << write_json("type") << ":" << write_json("sceneLoading") << ",";
-		s_Event << write_json("scene") << ":" << write_json(p_Scene) << ",";
-		s_Event << write_json("bricks") << ":" << "[";
+		s_Event.BeginObject();
 
-		bool s_First = true;
+		s_Event.Key<"type">().Value("sceneLoading");
+		s_Event.Key<"scene">().Value(p_Scene);
+		s_Event.Key<"bricks">().BeginArray();
 
 		for (const auto& s_Brick : p_Bricks) {
-			if (!s_First) {
-				s_Event << ",";
-			}
-
-			s_Event << write_json(s_Brick);
-
-			s_First = false;
+			s_Event.Value(s_Brick);
 		}
 
-		s_Event << "]";
+		s_Event.EndArray();
 
-		s_Event << "}";
+		s_Event.EndObject();
 
-		m_App->publish("all", s_Event.str(), uWS::OpCode::TEXT);
+		Publish("all", s_Event.View(), uWS::OpCode::TEXT);
 	});
 }
 
@@ -511,21 +1322,42 @@ void EditorServer::OnSceneClearing(bool p_ForReload) {
 		return;
 	}
 
+	// The entities of queued events and watched properties are about to be destroyed, along with their types.
+	m_TypeMetadata.Clear();
+
+	{
+		std::scoped_lock s_Lock(m_PendingEventsMutex);
+		m_PendingEvents.clear();
+		m_PendingEventIndices.clear();
+	}
+
+	{
+		std::scoped_lock s_Lock(m_PropertyWatchesMutex);
+		m_PropertyWatches.clear();
+	}
+
 	m_Loop->defer([this, p_ForReload](){
 		if (!m_App) {
 			return;
 		}
 
-		std::ostringstream s_Event;
+		for (auto* s_Socket : m_Sockets) {
+			s_Socket->getUserData()->PendingTransforms.clear();
+			s_Socket->getUserData()->WatchedProperties.clear();
+		}
+
+		m_HasPendingTransforms = false;
 
-		s_Event << "{";
+		auto& s_Event = GetEventWriter();
 
-		s_Event << write_json("type") << ":" << write_json("sceneClearing") << ",";
-		s_Event << write_json("forReload") << ":" << write_json(p_ForReload);
+		s_Event.BeginObject();
 
-		s_Event << "}";
+		s_Event.Key<"type">().Value("sceneClearing");
+		s_Event.Key<"forReload">().Value(p_ForReload);
 
-		m_App->publish("all", s_Event.str(), uWS::OpCode::TEXT);
+		s_Event.EndObject();
+
+		Publish("all", s_Event.View(), uWS::OpCode::TEXT);
 	});
 }
 
@@ -543,13 +1375,176 @@ void EditorServer::OnEntityTreeRebuilt() {
 			return;
 		}
 
-		std::ostringstream s_Event;
+		auto& s_Event = GetEventWriter();
+
+		s_Event.BeginObject();
+		s_Event.Key<"type">().Value("entityTreeRebuilt");
+		s_Event.EndObject();
+
+		Publish("all", s_Event.View(), uWS::OpCode::TEXT);
+	});
+}
+
+void EditorServer::OnCommandBatchApplied(const std::string& p_ClientId, std::optional<int64_t> p_MessageId, EditorCommandBatchResult p_Result) {
+	if (!m_Loop) {
+		return;
+	}
+
+	m_Loop->defer([this, p_ClientId, p_MessageId, p_Result = std::move(p_Result)](){
+		if (!m_App) {
+			return;
+		}
+
+		auto& s_Event = GetEventWriter();
+
+		s_Event.BeginObject();
+
+		s_Event.Key<"type">().Value("batchResult");
+
+		if (p_MessageId) {
+			s_Event.Key<"msgId">().Value(*p_MessageId);
+		}
+
+		s_Event.Key<"applied">().Value(static_cast<uint64_t>(p_Result.Applied));
+		s_Event.Key<"rolledBack">().Value(p_Result.RolledBack);
+
+		s_Event.Key<"errors">().BeginArray();
+
+		for (const auto& [s_Index, s_Message] : p_Result.Errors) {
+			s_Event.BeginObject();
+			s_Event.Key<"index">().Value(static_cast<uint64_t>(s_Index));
+			s_Event.Key<"message">().Value(s_Message);
+			s_Event.EndObject();
+		}
+
+		s_Event.EndArray();
+
+		s_Event.EndObject();
+
+		// Only the client that sent the batch gets the result. Everyone else gets the coalesced entity events.
+		Publish(p_ClientId, s_Event.View(), uWS::OpCode::TEXT);
+	});
+}
+
+void EditorServer::OnSceneSnapshotSaved(const SceneSnapshotRequest& p_Request, SceneSnapshotResult p_Result) {
+	if (!p_Request.ClientId || !m_Loop) {
+		return;
+	}
+
+	m_Loop->defer([this, p_Request, p_Result = std::move(p_Result)](){
+		if (!m_App) {
+			return;
+		}
+
+		auto& s_Event = GetEventWriter();
+
+		s_Event.BeginObject();
+
+		if (p_Request.MessageId) {
+			s_Event.Key<"msgId">().Value(*p_Request.MessageId);
+		}
+
+		if (p_Result.Error) {
+			s_Event.Key<"type">().Value("error");
+			s_Event.Key<"message">().Value(*p_Result.Error);
+		}
+		else {
+			const auto s_Path = p_Request.Path.u8string();
+
+			s_Event.Key<"type">().Value("sceneSnapshotSaved");
+			s_Event.Key<"path">().Value(std::string_view(reinterpret_cast<const char*>(s_Path.data()), s_Path.size()));
+			s_Event.Key<"entities">().Value(p_Result.Entities);
+			s_Event.Key<"bytes">().Value(p_Result.Bytes);
+		}
+
+		s_Event.EndObject();
+
+		Publish(*p_Request.ClientId, s_Event.View(), uWS::OpCode::TEXT);
+	});
+}
+
+void EditorServer::OnEntityTreeChanged(const EntityTreeDelta& p_Delta, size_t p_TreeSize) {
+	if (!m_Enabled) {
+		Logger::Info("EditorServer disabled. Skipping OnEntityTreeChanged.");
+		return;
+	}
+	if (!m_Loop) {
+		return;
+	}
+
+	if (p_Delta.Size() == 0) {
+		return;
+	}
+
+	if (p_Delta.Size() > (std::max)(c_EntityTreeDeltaMinSize, p_TreeSize / c_EntityTreeDeltaMaxTreeFraction)) {
+		OnEntityTreeRebuilt();
+		return;
+	}
+
+	// The added nodes are written here rather than on the server thread since their entities are only
+	// guaranteed to be alive while the tree they came from is current.
+	JsonWriter s_Event(4 * 1024);
+
+	s_Event.BeginObject();
+
+	s_Event.Key<"type">().Value("entityTreeDelta");
+
+	s_Event.Key<"added">().BeginArray();
+
+	for (const auto& s_Entry : p_Delta.Added) {
+		s_Event.BeginObject();
+		s_Event.Key<"entity">();
+		WriteEntityListEntry(s_Event, *s_Entry.Node, false);
+		s_Event.Key<"parent">();
+
+		if (s_Entry.Parent) {
+			WriteEntityTreeKey(s_Event, *s_Entry.Parent);
+		}
+		else {
+			s_Event.Null();
+		}
+
+		s_Event.EndObject();
+	}
+
+	s_Event.EndArray();
+
+	s_Event.Key<"removed">().BeginArray();
+
+	for (const auto& s_Key : p_Delta.Removed) {
+		WriteEntityTreeKey(s_Event, s_Key);
+	}
+
+	s_Event.EndArray();
+
+	s_Event.Key<"reparented">().BeginArray();
+
+	for (const auto& s_Entry : p_Delta.Reparented) {
+		s_Event.BeginObject();
+		s_Event.Key<"entity">();
+		WriteEntityTreeKey(s_Event, s_Entry.Key);
+		s_Event.Key<"parent">();
+
+		if (s_Entry.Parent) {
+			WriteEntityTreeKey(s_Event, *s_Entry.Parent);
+		}
+		else {
+			s_Event.Null();
+		}
+
+		s_Event.EndObject();
+	}
+
+	s_Event.EndArray();
+
+	s_Event.EndObject();
 
-		s_Event << "{";
-		s_Event << write_json("type") << ":" << write_json("entityTreeRebuilt");
-		s_Event << "}";
+	m_Loop->defer([this, s_Event = std::string(s_Event.View())](){
+		if (!m_App) {
+			return;
+		}
 
-		m_App->publish("all", s_Event.str(), uWS::OpCode::TEXT);
+		Publish("all", s_Event, uWS::OpCode::TEXT);
 	});
 }
 
@@ -567,78 +1562,246 @@ bool EditorServer::GetEnabled() {
 }
 
 
-void EditorServer::SendEntityList(EditorServer::WebSocket* p_Socket, std::shared_ptr<EntityTreeNode> p_Tree, std::optional<int64_t> p_MessageId) {
+void EditorServer::SendEntityList(
+	EditorServer::WebSocket* p_Socket,
+	std::shared_ptr<const EntityTree> p_Tree,
+	const EntityTreeNode* p_Root,
+	std::optional<uint32_t> p_MaxDepth,
+	std::optional<int64_t> p_MessageId
+) {
 	if (!m_Enabled) {
 		Logger::Info("EditorServer disabled. Skipping SendEntityList.");
 		return;
 	}
-	std::ostringstream s_EventStream;
 
-	s_EventStream << "{";
+	EntityListCursor s_Cursor {
+		.Tree = std::move(p_Tree),
+		.MaxDepth = p_MaxDepth,
+	};
+
+	if (p_Root) {
+		s_Cursor.Nodes.emplace(p_Root, 0);
+	}
+
+	if (p_Socket->getUserData()->BinaryProtocol) {
+		auto& s_Event = GetBinaryEventWriter();
+
+		s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::EntityList, p_MessageId);
+
+		const auto s_CountOffset = s_Event.ReserveU32();
+		s_Event.PatchU32(s_CountOffset, WriteEntityList(s_Event, s_Cursor, SIZE_MAX));
+
+		Send(p_Socket, s_Event.View(), uWS::OpCode::BINARY);
+		return;
+	}
+
+	auto& s_Event = GetEventWriter();
+
+	s_Event.BeginObject();
 
 	if (p_MessageId) {
-		s_EventStream << write_json("msgId") << ":" << write_json(*p_MessageId) << ",";
+		s_Event.Key<"msgId">().Value(*p_MessageId);
 	}
 
-	s_EventStream << write_json("type") << ":" << write_json("entityList") << ",";
-	s_EventStream << write_json("entities") << ":" << "[";
+	s_Event.Key<"type">().Value("entityList");
+	s_Event.Key<"entities">().BeginArray();
+	WriteEntityList(s_Event, s_Cursor, SIZE_MAX);
+	s_Event.EndArray();
+
+	s_Event.EndObject();
+
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
+}
+
+void EditorServer::SendEntityQueryResult(
+	WebSocket* p_Socket,
+	const std::vector<const EntityTreeNode*>& p_Nodes,
+	size_t p_Offset,
+	size_t p_Limit,
+	std::optional<int64_t> p_MessageId
+) {
+	auto& s_Event = GetEventWriter();
 
-	std::queue<std::shared_ptr<EntityTreeNode>> s_NodeQueue;
+	s_Event.BeginObject();
 
-	if (p_Tree) {
-		s_NodeQueue.push(p_Tree);
+	if (p_MessageId) {
+		s_Event.Key<"msgId">().Value(*p_MessageId);
 	}
 
-	bool s_First = true;
+	s_Event.Key<"type">().Value("entityQueryResult");
+	s_Event.Key<"total">().Value(static_cast<uint64_t>(p_Nodes.size()));
+	s_Event.Key<"offset">().Value(static_cast<uint64_t>(p_Offset));
+	s_Event.Key<"entities">().BeginArray();
+
+	for (size_t i = p_Offset; i < p_Nodes.size() && i - p_Offset < p_Limit; ++i) {
+		WriteEntityListEntry(s_Event, *p_Nodes[i], true);
+	}
 
-	while (!s_NodeQueue.empty()) {
-		auto s_Node = s_NodeQueue.front();
-		s_NodeQueue.pop();
+	s_Event.EndArray();
+	s_Event.EndObject();
 
-		if (!s_Node->Entity) {
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
+}
+
+void EditorServer::StreamEntityList(
+	EditorServer::WebSocket* p_Socket,
+	std::shared_ptr<const EntityTree> p_Tree,
+	const EntityTreeNode* p_Root,
+	std::optional<uint32_t> p_MaxDepth,
+	size_t p_ChunkSize,
+	std::optional<int64_t> p_MessageId
+) {
+	if (!m_Enabled) {
+		Logger::Info("EditorServer disabled. Skipping StreamEntityList.");
+		return;
+	}
+
+	auto s_Cursor = std::make_unique<EntityListCursor>(EntityListCursor {
+		.Tree = std::move(p_Tree),
+		.MaxDepth = p_MaxDepth,
+		.MessageId = p_MessageId,
+		.ChunkSize = p_ChunkSize,
+	});
+
+	if (p_Root) {
+		s_Cursor->Nodes.emplace(p_Root, 0);
+	}
+
+	// A new request replaces any list that is still being streamed to this client.
+	p_Socket->getUserData()->PendingEntityList = std::move(s_Cursor);
+
+	ContinueEntityListStream(p_Socket);
+}
+
+void EditorServer::ContinueEntityListStream(EditorServer::WebSocket* p_Socket) {
+	auto* s_UserData = p_Socket->getUserData();
+
+	while (s_UserData->PendingEntityList && p_Socket->getBufferedAmount() < c_EntityListMaxBufferedAmount) {
+		auto& s_Cursor = *s_UserData->PendingEntityList;
+
+		auto s_TreeLock = Plugin()->LockEntityTree();
+
+		// The remaining nodes point to entities from the tree we started with, which might be gone
+		// if the tree has been rebuilt or cleared since.
+		if (Plugin()->GetEntityTree() != s_Cursor.Tree) {
+			s_TreeLock.unlock();
+
+			const auto s_MessageId = s_Cursor.MessageId;
+			s_UserData->PendingEntityList.reset();
+
+			SendError(p_Socket, "The entity tree changed while the entity list was being streamed.", s_MessageId);
+			return;
+		}
+
+		if (s_UserData->BinaryProtocol) {
+			auto& s_Event = GetBinaryEventWriter();
+
+			s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::EntityListChunk, s_Cursor.MessageId);
+			s_Event.WriteU32(s_Cursor.ChunkIndex++);
+
+			const auto s_DoneOffset = s_Event.ReserveU8();
+			const auto s_CountOffset = s_Event.ReserveU32();
+
+			s_Event.PatchU32(s_CountOffset, WriteEntityList(s_Event, s_Cursor, s_Cursor.ChunkSize));
+
+			s_TreeLock.unlock();
+
+			const bool s_Done = s_Cursor.Nodes.empty();
+
+			s_Event.PatchU8(s_DoneOffset, s_Done);
+
+			if (s_Done) {
+				s_UserData->PendingEntityList.reset();
+			}
+
+			Send(p_Socket, s_Event.View(), uWS::OpCode::BINARY);
 			continue;
 		}
 
-		if (!s_First) {
-			s_EventStream << ",";
+		auto& s_Event = GetEventWriter();
+
+		s_Event.BeginObject();
+
+		if (s_Cursor.MessageId) {
+			s_Event.Key<"msgId">().Value(*s_Cursor.MessageId);
 		}
 
-		s_First = false;
+		s_Event.Key<"type">().Value("entityListChunk");
+		s_Event.Key<"chunk">().Value(s_Cursor.ChunkIndex++);
+		s_Event.Key<"entities">().BeginArray();
+		WriteEntityList(s_Event, s_Cursor, s_Cursor.ChunkSize);
+		s_Event.EndArray();
 
-		auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_Node->Entity.GetBlueprintFactory());
+		s_TreeLock.unlock();
 
-		if (s_Node->Entity.GetOwningEntity()) {
-			s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_Node->Entity.GetOwningEntity().GetBlueprintFactory());
+		const bool s_Done = s_Cursor.Nodes.empty();
+
+		s_Event.Key<"done">().Value(s_Done);
+		s_Event.EndObject();
+
+		if (s_Done) {
+			s_UserData->PendingEntityList.reset();
 		}
 
-		s_EventStream << "{";
-		s_EventStream << write_json("id") << ":" << write_json(std::format("{:016x}", s_Node->EntityId)) << ",";
-		s_EventStream << write_json("source") << ":" << write_json("game") << ",";
-		s_EventStream << write_json("tblu") << ":" << write_json(std::format("{:016X}", s_Node->TBLU.GetID())) << ",";
-		s_EventStream << write_json("type") << ":" << write_json((*s_Node->Entity->GetType()->m_pInterfaces)[0].m_pTypeId->typeInfo()->m_pTypeName);
+		Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
+	}
+}
+
+template <typename T>
+uint32_t EditorServer::WriteEntityList(T& p_Writer, EntityListCursor& p_Cursor, size_t p_MaxEntities) {
+	uint32_t s_EntityCount = 0;
 
-		if (s_Factory) {
-			// This is also probably wrong.
-			auto s_Index = s_Factory->GetSubEntityIndex(s_Node->Entity->GetType()->m_nEntityId);
+	while (!p_Cursor.Nodes.empty() && s_EntityCount < p_MaxEntities) {
+		const auto [s_Node, s_Depth] = p_Cursor.Nodes.front();
+		p_Cursor.Nodes.pop();
 
-			if (s_Index != -1) {
-				const auto s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
-				s_EventStream << "," << write_json("name") << ":" << write_json(s_Name);
-			}
+		if (!s_Node->Entity) {
+			continue;
 		}
 
-		s_EventStream << "}";
+		WriteEntityListEntry(p_Writer, *s_Node, p_Cursor.MaxDepth.has_value());
+		++s_EntityCount;
 
-		for (auto& childPair : s_Node->Children) {
-			s_NodeQueue.push(childPair.second);
+		if (p_Cursor.MaxDepth && s_Depth >= *p_Cursor.MaxDepth) {
+			continue;
+		}
+
+		for (const auto s_Child : p_Cursor.Tree->GetChildren(*s_Node)) {
+			p_Cursor.Nodes.emplace(&p_Cursor.Tree->GetNode(s_Child), s_Depth + 1);
 		}
 	}
 
-	s_EventStream << "]";
+	return s_EntityCount;
+}
+
+void EditorServer::WriteEntityListEntry(JsonWriter& p_Writer, const EntityTreeNode& p_Node, bool p_IncludeChildCount) {
+	auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Node.Entity.GetBlueprintFactory());
+
+	if (p_Node.Entity.GetOwningEntity()) {
+		s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Node.Entity.GetOwningEntity().GetBlueprintFactory());
+	}
+
+	p_Writer.BeginObject();
+	p_Writer.Key<"id">().HexValue(p_Node.EntityId);
+	p_Writer.Key<"source">().Value("game");
+	p_Writer.Key<"tblu">().HexValue(p_Node.TBLU.GetID(), true);
+	p_Writer.Key<"type">().Value((*p_Node.Entity->GetType()->m_pInterfaces)[0].m_pTypeId->typeInfo()->m_pTypeName);
+
+	if (s_Factory) {
+		// This is also probably wrong.
+		auto s_Index = s_Factory->GetSubEntityIndex(p_Node.Entity->GetType()->m_nEntityId);
+
+		if (s_Index != -1) {
+			const auto& s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
+			p_Writer.Key<"name">().Value(s_Name);
+		}
+	}
 
-	s_EventStream << "}";
+	if (p_IncludeChildCount) {
+		p_Writer.Key<"childCount">().Value(p_Node.ChildCount);
+	}
 
-	p_Socket->send(s_EventStream.str(), uWS::OpCode::TEXT);
+	p_Writer.EndObject();
 }
 
 void EditorServer::SendEntityDetails(WebSocket* p_Socket, ZEntityRef p_Entity, std::optional<int64_t> p_MessageId) {
@@ -650,32 +1813,50 @@ void EditorServer::SendEntityDetails(WebSocket* p_Socket, ZEntityRef p_Entity, s
 		throw std::runtime_error("Could not find entity for the given selector.");
 	}
 
-	std::ostringstream s_Event;
+	if (p_Socket->getUserData()->BinaryProtocol) {
+		auto& s_Event = GetBinaryEventWriter();
+
+		s_Event.WriteHeader(EditorBinaryProtocol::EMessageType::EntityDetails, p_MessageId);
+		WriteEntityDetails(s_Event, p_Entity);
+
+		Send(p_Socket, s_Event.View(), uWS::OpCode::BINARY);
+		return;
+	}
+
+	auto& s_Event = GetEventWriter();
 
-	s_Event << "{";
+	s_Event.BeginObject();
 
 	if (p_MessageId) {
-		s_Event << write_json("msgId") << ":" << write_json(*p_MessageId) << ",";
+		s_Event.Key<"msgId">().Value(*p_MessageId);
 	}
 
-	s_Event << write_json("type") << ":" << write_json("entityDetails") << ",";
-	s_Event << write_json("entity") << ":";
+	s_Event.Key<"type">().Value("entityDetails");
+	s_Event.Key<"entity">();
 	WriteEntityDetails(s_Event, p_Entity);
 
-	s_Event << "}";
+	s_Event.EndObject();
+
+	Send(p_Socket, s_Event.View(), uWS::OpCode::TEXT);
+}
 
-	p_Socket->send(s_Event.str(), uWS::OpCode::TEXT);
+void EditorServer::WriteEntityTreeKey(JsonWriter& p_Writer, const EntityTreeKey& p_Key) {
+	p_Writer.BeginObject();
+	p_Writer.Key<"id">().HexValue(p_Key.EntityId);
+	p_Writer.Key<"source">().Value("game");
+	p_Writer.Key<"tblu">().HexValue(p_Key.TBLU, true);
+	p_Writer.EndObject();
 }
 
-void EditorServer::WriteEntityDetails(std::ostream& p_Stream, ZEntityRef p_Entity) {
+void EditorServer::WriteEntityDetails(JsonWriter& p_Writer, ZEntityRef p_Entity) {
 	if (!p_Entity) {
-		p_Stream << "null";
+		p_Writer.Null();
 		return;
 	}
 
-	p_Stream << "{";
+	p_Writer.BeginObject();
 
-	p_Stream << write_json("id") << ":" << write_json(std::format("{:016x}", p_Entity->GetType()->m_nEntityId)) << ",";
+	p_Writer.Key<"id">().HexValue(p_Entity->GetType()->m_nEntityId);
 
 	auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetBlueprintFactory());
 
@@ -688,255 +1869,446 @@ void EditorServer::WriteEntityDetails(std::ostream& p_Stream, ZEntityRef p_Entit
 		auto s_Index = s_Factory->GetSubEntityIndex(p_Entity->GetType()->m_nEntityId);
 
 		if (s_Index != -1) {
-			const auto s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
-			p_Stream << write_json("name") << ":" << write_json(s_Name) << ",";
+			const auto& s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
+			p_Writer.Key<"name">().Value(s_Name);
 		}
 
-		p_Stream << write_json("source") << ":" << write_json("game") << ",";
+		p_Writer.Key<"source">().Value("game");
 
-		p_Stream << write_json("tblu") << ":" << write_json(std::format("{:016X}", s_Factory->m_ridResource.GetID())) << ",";
+		p_Writer.Key<"tblu">().HexValue(s_Factory->m_ridResource.GetID(), true);
 	}
 	else {
 		// TODO: Name.
-		p_Stream << write_json("source") << ":" << write_json("editor") << ",";
+		p_Writer.Key<"source">().Value("editor");
 	}
 
 	// Write type and interfaces.
-	auto s_Interfaces = (*p_Entity->GetType()->m_pInterfaces);
+	const auto s_Metadata = m_TypeMetadata.Get(p_Entity->GetType());
 
-	p_Stream << write_json("type") << ":" << write_json(s_Interfaces[0].m_pTypeId->typeInfo()->m_pTypeName) << ",";
+	if (!s_Metadata->Interfaces.empty()) {
+		p_Writer.Key<"type">().Value(s_Metadata->Interfaces[0]);
+	}
 
-	p_Stream << write_json("interfaces") << ":" << "[";
-	bool s_FirstInterface = true;
+	p_Writer.Key<"interfaces">().BeginArray();
 
-	for (auto& s_Interface : s_Interfaces) {
-		if (!s_Interface.m_pTypeId) {
-			continue;
-		}
+	for (const auto* s_Interface : s_Metadata->Interfaces) {
+		p_Writer.Value(s_Interface);
+	}
 
-		const auto* s_TypeInfo = s_Interface.m_pTypeId->typeInfo();
+	p_Writer.EndArray();
 
-		if (!s_TypeInfo || !s_TypeInfo->m_pTypeName) {
-			continue;
-		}
+	// Write transform.
+	if (const auto s_Spatial = p_Entity.QueryInterface<ZSpatialEntity>()) {
+		const auto s_Trans = s_Spatial->GetWorldMatrix();
+
+		p_Writer.Key<"transform">();
+		WriteTransform(p_Writer, s_Trans);
 
-		if (!s_FirstInterface) {
-			p_Stream << ",";
+		if (const auto s_LocalTrans = GetRelativeTransform(p_Entity, s_Spatial)) {
+			p_Writer.Key<"relativeTransform">();
+			WriteTransform(p_Writer, *s_LocalTrans);
 		}
+	}
 
-		s_FirstInterface = false;
+	// Write properties.
+	p_Writer.Key<"properties">().BeginObject();
 
-		p_Stream << write_json(s_TypeInfo->m_pTypeName);
+	for (const auto& s_Property : s_Metadata->Properties) {
+		p_Writer.Key(s_Property.Name);
+		WriteProperty(p_Writer, p_Entity, s_Property);
 	}
 
-	p_Stream << "],";
+	p_Writer.EndObject();
 
-	// Write transform.
-	if (const auto s_Spatial = p_Entity.QueryInterface<ZSpatialEntity>()) {
-		const auto s_Trans = s_Spatial->GetWorldMatrix();
+	p_Writer.EndObject();
+}
 
-		p_Stream << write_json("transform") << ":";
-		WriteTransform(p_Stream, s_Spatial->GetWorldMatrix());
-		p_Stream << ",";
+void EditorServer::WriteEntityTransform(JsonWriter& p_Writer, ZEntityRef p_Entity) {
+	p_Writer.BeginObject();
 
-		SMatrix s_ParentTrans;
+	WriteEntitySelectorFields(p_Writer, p_Entity);
 
-		bool s_DoesntHaveParent = false;
+	if (const auto s_Spatial = p_Entity.QueryInterface<ZSpatialEntity>()) {
+		p_Writer.Key<"transform">();
+		WriteTransform(p_Writer, s_Spatial->GetWorldMatrix());
 
-		// Get parent entity.
-		if (s_Spatial->m_eidParent.m_pInterfaceRef) {
-			s_ParentTrans = s_Spatial->m_eidParent.m_pInterfaceRef->GetWorldMatrix();
-		} else if (p_Entity.GetLogicalParent() && p_Entity.GetLogicalParent().QueryInterface<ZSpatialEntity>()) {
-			s_ParentTrans = p_Entity.GetLogicalParent().QueryInterface<ZSpatialEntity>()->GetWorldMatrix();
-		} else if (p_Entity.GetOwningEntity() && p_Entity.GetOwningEntity().QueryInterface<ZSpatialEntity>()) {
-			s_ParentTrans = p_Entity.GetOwningEntity().QueryInterface<ZSpatialEntity>()->GetWorldMatrix();
-		} else {
-			s_DoesntHaveParent = true;
+		if (const auto s_LocalTrans = GetRelativeTransform(p_Entity, s_Spatial)) {
+			p_Writer.Key<"relativeTransform">();
+			WriteTransform(p_Writer, *s_LocalTrans);
 		}
+	}
 
-		if (!s_DoesntHaveParent) {
-			const auto s_ParentTransInv = s_ParentTrans.Inverse();
+	p_Writer.EndObject();
+}
 
-			auto s_LocalTrans = s_ParentTransInv * s_Trans;
-			s_LocalTrans.Trans = s_Trans.Trans - s_ParentTrans.Trans;
-			s_LocalTrans.Trans.w = 1.f;
+void EditorServer::WriteEntitySelectorFields(JsonWriter& p_Writer, ZEntityRef p_Entity) {
+	p_Writer.Key<"id">().HexValue(p_Entity->GetType()->m_nEntityId);
 
-			p_Stream << write_json("relativeTransform") << ":";
-			WriteTransform(p_Stream, s_LocalTrans);
-			p_Stream << ",";
-		}
+	if (const auto s_Tblu = GetEntityTblu(p_Entity)) {
+		p_Writer.Key<"source">().Value("game");
+		p_Writer.Key<"tblu">().HexValue(s_Tblu->GetID(), true);
 	}
+	else {
+		p_Writer.Key<"source">().Value("editor");
+	}
+}
 
-	// Write properties.
-	p_Stream << write_json("properties") << ":" << "{";
+void EditorServer::WriteVector3(JsonWriter& p_Writer, double p_X, double p_Y, double p_Z) {
+	p_Writer.BeginObject();
+	p_Writer.Key<"x">().Value(p_X);
+	p_Writer.Key<"y">().Value(p_Y);
+	p_Writer.Key<"z">().Value(p_Z);
+	p_Writer.EndObject();
+}
 
-	const auto s_EntityType = p_Entity->GetType();
-	bool s_FirstProperty = true;
+void EditorServer::WriteRotation(JsonWriter& p_Writer, double p_Yaw, double p_Pitch, double p_Roll) {
+	p_Writer.BeginObject();
+	p_Writer.Key<"yaw">().Value(p_Yaw);
+	p_Writer.Key<"pitch">().Value(p_Pitch);
+	p_Writer.Key<"roll">().Value(p_Roll);
+	p_Writer.EndObject();
+}
+
+void EditorServer::WriteTransform(JsonWriter& p_Writer, SMatrix p_Transform) {
+	const auto s_Decomposed = p_Transform.Decompose();
+	const auto s_Euler = s_Decomposed.Quaternion.ToEuler();
 
-	if (s_EntityType && s_EntityType->m_pProperties01) {
-		for (uint32_t i = 0; i < s_EntityType->m_pProperties01->size(); ++i) {
-			ZEntityProperty* s_Property = &s_EntityType->m_pProperties01->operator[](i);
-			const auto* s_PropertyInfo = s_Property->m_pType->getPropertyInfo();
+	p_Writer.BeginObject();
 
-			if (!s_PropertyInfo || !s_PropertyInfo->m_pType || !s_PropertyInfo->m_pType->typeInfo()) {
-				continue;
-			}
+	p_Writer.Key<"position">();
+	WriteVector3(p_Writer, s_Decomposed.Position.x, s_Decomposed.Position.y, s_Decomposed.Position.z);
 
-			if (!s_FirstProperty) {
-				p_Stream << ",";
-			}
+	p_Writer.Key<"rotation">();
+	WriteRotation(p_Writer, s_Euler.yaw, s_Euler.pitch, s_Euler.roll);
 
-			s_FirstProperty = false;
+	p_Writer.Key<"scale">();
+	WriteVector3(p_Writer, s_Decomposed.Scale.x, s_Decomposed.Scale.y, s_Decomposed.Scale.z);
 
-			WritePropertyName(p_Stream, s_Property);
-			p_Stream << ":";
-			WriteProperty(p_Stream, p_Entity, s_Property);
-		}
-	}
+	p_Writer.EndObject();
+}
 
-	p_Stream << "}";
+void EditorServer::WriteProperty(JsonWriter& p_Writer, ZEntityRef p_Entity, const PropertyDescriptor& p_Property) {
+	p_Writer.BeginObject();
+	p_Writer.Key<"type">().Value(p_Property.TypeName);
+	p_Writer.Key<"data">();
 
-	p_Stream << "}";
+	auto* s_Data = ReadPropertyData(p_Entity, p_Property);
+	WritePropertyData(p_Writer, p_Property, s_Data);
+	ReleasePropertyData(p_Property, s_Data);
+
+	p_Writer.EndObject();
 }
 
-void EditorServer::WriteVector3(std::ostream& p_Stream, double p_X, double p_Y, double p_Z) {
-	p_Stream << "{";
-	p_Stream << write_json("x") << ":" << write_json(p_X) << ",";
-	p_Stream << write_json("y") << ":" << write_json(p_Y) << ",";
-	p_Stream << write_json("z") << ":" << write_json(p_Z);
-	p_Stream << "}";
+void* EditorServer::ReadPropertyData(ZEntityRef p_Entity, const PropertyDescriptor& p_Property) {
+	auto* s_PropertyAddress = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(p_Entity.m_pEntity) + p_Property.Property->m_nOffset);
+
+	// Plain properties are read where they are. Only properties with a getter need a copy.
+	if (!p_Property.HasGetter) {
+		return s_PropertyAddress;
+	}
+
+	auto* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(p_Property.TypeSize, p_Property.TypeAlignment);
+	p_Property.Info->get(s_PropertyAddress, s_Data, p_Property.Info->m_nOffset);
+
+	return s_Data;
 }
 
-void EditorServer::WriteRotation(std::ostream& p_Stream, double p_Yaw, double p_Pitch, double p_Roll) {
-	p_Stream << "{";
-	p_Stream << write_json("yaw") << ":" << write_json(p_Yaw) << ",";
-	p_Stream << write_json("pitch") << ":" << write_json(p_Pitch) << ",";
-	p_Stream << write_json("roll") << ":" << write_json(p_Roll);
-	p_Stream << "}";
+void EditorServer::ReleasePropertyData(const PropertyDescriptor& p_Property, void* p_Data) {
+	if (p_Property.HasGetter) {
+		(*Globals::MemoryManager)->m_pNormalAllocator->Free(p_Data);
+	}
 }
 
-void EditorServer::WriteTransform(std::ostream& p_Stream, SMatrix p_Transform) {
-	const auto s_Decomposed = p_Transform.Decompose();
-	const auto s_Euler = s_Decomposed.Quaternion.ToEuler();
+bool EditorServer::WritePropertyData(JsonWriter& p_Writer, const PropertyDescriptor& p_Property, void* p_Data) {
+	if (p_Property.WriteValue) {
+		p_Property.WriteValue(p_Writer, p_Data);
+		return true;
+	}
+
+	if (p_Property.IsEntity) {
+		auto* s_EntityData = static_cast<TEntityRef<ZEntityImpl>*>(p_Data);
+
+		if (!*s_EntityData) {
+			p_Writer.Null();
+			return false;
+		}
 
-	p_Stream << "{";
+		WriteEntityReference(p_Writer, s_EntityData->m_ref);
+		return true;
+	}
 
-	p_Stream << write_json("position") << ":";
-	WriteVector3(p_Stream, s_Decomposed.Position.x, s_Decomposed.Position.y, s_Decomposed.Position.z);
-	p_Stream << ",";
+	const auto s_JsonProperty = HM3_GameStructToJson(p_Property.TypeName, p_Data, p_Property.TypeSize);
 
-	p_Stream << write_json("rotation") << ":";
-	WriteRotation(p_Stream, s_Euler.yaw, s_Euler.pitch, s_Euler.roll);
-	p_Stream << ",";
+	if (!s_JsonProperty) {
+		p_Writer.Null();
+		return false;
+	}
 
-	p_Stream << write_json("scale") << ":";
-	WriteVector3(p_Stream, s_Decomposed.Scale.x, s_Decomposed.Scale.y, s_Decomposed.Scale.z);
+	p_Writer.RawValue(std::string_view(s_JsonProperty->JsonData, s_JsonProperty->StrSize));
+	HM3_FreeJsonString(s_JsonProperty);
 
-	p_Stream << "}";
+	return true;
 }
 
-void EditorServer::WritePropertyName(std::ostream& p_Stream, ZEntityProperty* p_Property) {
-	const auto* s_PropertyInfo = p_Property->m_pType->getPropertyInfo();
+void EditorServer::WriteEntityReference(JsonWriter& p_Writer, ZEntityRef p_Entity) {
+	p_Writer.BeginObject();
+	p_Writer.Key<"id">().HexValue(p_Entity->GetType()->m_nEntityId);
 
-	if (s_PropertyInfo->m_pType->typeInfo()->isResource() || s_PropertyInfo->m_nPropertyID != p_Property->m_nPropertyId) {
-		// Some properties don't have a name for some reason. Try to find using RL.
-		const auto s_PropertyName = HM3_GetPropertyName(p_Property->m_nPropertyId);
+	auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetBlueprintFactory());
 
-		if (s_PropertyName.Size > 0) {
-			p_Stream << write_json(std::string_view(s_PropertyName.Data, s_PropertyName.Size));
-		} else {
-			p_Stream << write_json(std::format("~{:08x}", p_Property->m_nPropertyId));
-		}
+	if (p_Entity.GetOwningEntity()) {
+		s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetOwningEntity().GetBlueprintFactory());
 	}
-	else if (s_PropertyInfo->m_pName) {
-		p_Stream << write_json(s_PropertyInfo->m_pName);
+
+	if (s_Factory) {
+		// This is also probably wrong.
+		auto s_Index = s_Factory->GetSubEntityIndex(p_Entity->GetType()->m_nEntityId);
+
+		if (s_Index != -1) {
+			const auto& s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
+			p_Writer.Key<"name">().Value(s_Name);
+		}
+
+		p_Writer.Key<"source">().Value("game");
+
+		p_Writer.Key<"tblu">().HexValue(s_Factory->m_ridResource.GetID(), true);
 	}
 	else {
-		p_Stream << write_json(std::format("~{:08x}", p_Property->m_nPropertyId));
+		// TODO: Name.
+		p_Writer.Key<"source">().Value("editor");
+	}
+
+	// Write type.
+	const auto s_Metadata = m_TypeMetadata.Get(p_Entity->GetType());
+
+	if (!s_Metadata->Interfaces.empty()) {
+		p_Writer.Key<"type">().Value(s_Metadata->Interfaces[0]);
+	}
+
+	p_Writer.EndObject();
+}
+
+std::optional<SMatrix> EditorServer::GetRelativeTransform(ZEntityRef p_Entity, ZSpatialEntity* p_Spatial) {
+	const auto s_Trans = p_Spatial->GetWorldMatrix();
+
+	SMatrix s_ParentTrans;
+
+	// Get parent entity.
+	if (p_Spatial->m_eidParent.m_pInterfaceRef) {
+		s_ParentTrans = p_Spatial->m_eidParent.m_pInterfaceRef->GetWorldMatrix();
+	} else if (p_Entity.GetLogicalParent() && p_Entity.GetLogicalParent().QueryInterface<ZSpatialEntity>()) {
+		s_ParentTrans = p_Entity.GetLogicalParent().QueryInterface<ZSpatialEntity>()->GetWorldMatrix();
+	} else if (p_Entity.GetOwningEntity() && p_Entity.GetOwningEntity().QueryInterface<ZSpatialEntity>()) {
+		s_ParentTrans = p_Entity.GetOwningEntity().QueryInterface<ZSpatialEntity>()->GetWorldMatrix();
+	} else {
+		return std::nullopt;
 	}
+
+	const auto s_ParentTransInv = s_ParentTrans.Inverse();
+
+	auto s_LocalTrans = s_ParentTransInv * s_Trans;
+	s_LocalTrans.Trans = s_Trans.Trans - s_ParentTrans.Trans;
+	s_LocalTrans.Trans.w = 1.f;
+
+	return s_LocalTrans;
 }
 
-void EditorServer::WriteProperty(std::ostream& p_Stream, ZEntityRef p_Entity, ZEntityProperty* p_Property) {
-	p_Stream << "{" << write_json("type") << ":";
+EditorBinaryProtocol::Transform EditorServer::GetBinaryTransform(SMatrix p_Transform) {
+	const auto s_Decomposed = p_Transform.Decompose();
+	const auto s_Euler = s_Decomposed.Quaternion.ToEuler();
 
-	const auto* s_PropertyInfo = p_Property->m_pType->getPropertyInfo();
+	return {
+		.Position = { s_Decomposed.Position.x, s_Decomposed.Position.y, s_Decomposed.Position.z },
+		.Rotation = { static_cast<float>(s_Euler.yaw), static_cast<float>(s_Euler.pitch), static_cast<float>(s_Euler.roll) },
+		.Scale = { s_Decomposed.Scale.x, s_Decomposed.Scale.y, s_Decomposed.Scale.z },
+	};
+}
 
-	if (!s_PropertyInfo || !s_PropertyInfo->m_pType) {
-		p_Stream << write_json("unknown") << ",";
-		p_Stream << write_json("data") << ":" << "null" << "}";
-		return;
+std::optional<ZRuntimeResourceID> EditorServer::GetEntityTblu(ZEntityRef p_Entity) {
+	auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetBlueprintFactory());
+
+	if (p_Entity.GetOwningEntity()) {
+		s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetOwningEntity().GetBlueprintFactory());
 	}
 
-	const auto s_PropertyAddress = reinterpret_cast<uintptr_t>(p_Entity.m_pEntity) + p_Property->m_nOffset;
-	const uint16_t s_TypeSize = s_PropertyInfo->m_pType->typeInfo()->m_nTypeSize;
-	const uint16_t s_TypeAlignment = s_PropertyInfo->m_pType->typeInfo()->m_nTypeAlignment;
-	const std::string s_TypeName = s_PropertyInfo->m_pType->typeInfo()->m_pTypeName;
+	if (!s_Factory) {
+		return std::nullopt;
+	}
 
-	p_Stream << write_json(s_TypeName) << ",";
-	p_Stream << write_json("data") << ":";
+	return s_Factory->m_ridResource;
+}
 
-	// Get the value of the property.
-	auto* s_Data = (*Globals::MemoryManager)->m_pNormalAllocator->AllocateAligned(s_TypeSize, s_TypeAlignment);
+EditorBinaryProtocol::Entity EditorServer::GetBinaryEntity(ZEntityRef p_Entity) {
+	EditorBinaryProtocol::Entity s_Entity {};
 
-	if (s_PropertyInfo->m_nFlags & EPropertyInfoFlags::E_HAS_GETTER_SETTER)
-		s_PropertyInfo->get(reinterpret_cast<void*>(s_PropertyAddress), s_Data, s_PropertyInfo->m_nOffset);
-	else
-		s_PropertyInfo->m_pType->typeInfo()->m_pTypeFunctions->copyConstruct(s_Data, reinterpret_cast<void*>(s_PropertyAddress));
+	s_Entity.Id = p_Entity->GetType()->m_nEntityId;
+	s_Entity.Type = (*p_Entity->GetType()->m_pInterfaces)[0].m_pTypeId->typeInfo()->m_pTypeName;
 
-	if (s_PropertyInfo->m_pType->typeInfo() && s_PropertyInfo->m_pType->typeInfo()->isEntity()) {
-		auto* s_EntityData = reinterpret_cast<TEntityRef<ZEntityImpl>*>(s_Data);
+	auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetBlueprintFactory());
 
-		if (!s_EntityData || !*s_EntityData) {
-			(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
-			p_Stream << "null" << "}";
-			return;
+	if (p_Entity.GetOwningEntity()) {
+		s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(p_Entity.GetOwningEntity().GetBlueprintFactory());
+	}
+
+	if (s_Factory) {
+		s_Entity.Tblu = s_Factory->m_ridResource.GetID();
+
+		// This is also probably wrong.
+		auto s_Index = s_Factory->GetSubEntityIndex(s_Entity.Id);
+
+		if (s_Index != -1) {
+			const auto& s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
+			s_Entity.Name = std::string_view(s_Name.c_str(), s_Name.size());
 		}
+	}
+
+	return s_Entity;
+}
+
+void EditorServer::WriteEntityListEntry(EditorBinaryProtocol::Writer& p_Writer, const EntityTreeNode& p_Node, bool p_IncludeChildCount) {
+	auto s_Entity = GetBinaryEntity(p_Node.Entity);
+
+	// Like in JSON lists, entries are identified by their tree node.
+	s_Entity.Id = p_Node.EntityId;
+	s_Entity.Tblu = p_Node.TBLU.GetID();
+
+	if (p_IncludeChildCount) {
+		s_Entity.ChildCount = p_Node.ChildCount;
+	}
+
+	p_Writer.WriteEntity(s_Entity);
+}
+
+void EditorServer::WriteEntityDetails(EditorBinaryProtocol::Writer& p_Writer, ZEntityRef p_Entity) {
+	if (!p_Entity) {
+		throw std::runtime_error("Cannot encode the details of a null entity.");
+	}
+
+	// Where the JSON of a property ends up in s_JsonValues. Views are only taken once all values are written,
+	// since the buffer can move while it grows.
+	struct JsonValueRange {
+		size_t Property;
+		size_t Offset;
+		size_t Size;
+	};
+
+	// The details only hold views, so these keep the values they point to alive until they're written.
+	// They're reused between calls so they stop allocating once they've grown.
+	thread_local EditorBinaryProtocol::EntityDetails s_Details;
+	thread_local JsonWriter s_JsonValues;
+	thread_local std::vector<JsonValueRange> s_JsonValueRanges;
+
+	// Keeps the property names alive.
+	const auto s_Metadata = m_TypeMetadata.Get(p_Entity->GetType());
 
-		p_Stream << "{" << write_json("id") << ":" << write_json(std::format("{:016x}", s_EntityData->m_ref->GetType()->m_nEntityId)) << ",";
+	s_Details.Base = GetBinaryEntity(p_Entity);
+	s_Details.Interfaces.assign(s_Metadata->Interfaces.begin(), s_Metadata->Interfaces.end());
+	s_Details.WorldTransform.reset();
+	s_Details.RelativeTransform.reset();
+	s_Details.Properties.clear();
+	s_JsonValues.Clear();
+	s_JsonValueRanges.clear();
 
-		auto s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_EntityData->m_ref.GetBlueprintFactory());
+	if (const auto s_Spatial = p_Entity.QueryInterface<ZSpatialEntity>()) {
+		s_Details.WorldTransform = GetBinaryTransform(s_Spatial->GetWorldMatrix());
 
-		if (s_EntityData->m_ref.GetOwningEntity()) {
-			s_Factory = reinterpret_cast<ZTemplateEntityBlueprintFactory*>(s_EntityData->m_ref.GetOwningEntity().GetBlueprintFactory());
+		if (const auto s_LocalTrans = GetRelativeTransform(p_Entity, s_Spatial)) {
+			s_Details.RelativeTransform = GetBinaryTransform(*s_LocalTrans);
 		}
+	}
 
-		if (s_Factory) {
-			// This is also probably wrong.
-			auto s_Index = s_Factory->GetSubEntityIndex( s_EntityData->m_ref->GetType()->m_nEntityId);
+	for (const auto& s_Property : s_Metadata->Properties) {
+		auto& s_Value = s_Details.Properties.emplace_back();
+		s_Value.Name = s_Property.Name;
+		s_Value.Type = s_Property.TypeName;
 
-			if (s_Index != -1) {
-				const auto s_Name = s_Factory->m_pTemplateEntityBlueprint->subEntities[s_Index].entityName;
-				p_Stream << write_json("name") << ":" << write_json(s_Name) << ",";
-			}
+		auto* s_Data = ReadPropertyData(p_Entity, s_Property);
 
-			p_Stream << write_json("source") << ":" << write_json("game") << ",";
+		if (s_Property.IsEntity) {
+			auto* s_EntityData = static_cast<TEntityRef<ZEntityImpl>*>(s_Data);
 
-			p_Stream << write_json("tblu") << ":" << write_json(std::format("{:016X}", s_Factory->m_ridResource.GetID())) << ",";
+			if (*s_EntityData) {
+				s_Value.Kind = EditorBinaryProtocol::EPropertyValueKind::Entity;
+				s_Value.EntityValue = GetBinaryEntity(s_EntityData->m_ref);
+			}
 		}
 		else {
-			// TODO: Name.
-			p_Stream << write_json("source") << ":" << write_json("editor") << ",";
+			const size_t s_Offset = s_JsonValues.Size();
+
+			if (WritePropertyData(s_JsonValues, s_Property, s_Data)) {
+				s_Value.Kind = EditorBinaryProtocol::EPropertyValueKind::Json;
+				s_JsonValueRanges.push_back({ s_Details.Properties.size() - 1, s_Offset, s_JsonValues.Size() - s_Offset });
+			}
 		}
 
-		// Write type and interfaces.
-		auto s_Interfaces = (*s_EntityData->m_ref->GetType()->m_pInterfaces);
+		ReleasePropertyData(s_Property, s_Data);
+	}
+
+	for (const auto& s_Range : s_JsonValueRanges) {
+		s_Details.Properties[s_Range.Property].JsonValue = s_JsonValues.View().substr(s_Range.Offset, s_Range.Size);
+	}
+
+	p_Writer.WriteEntityDetails(s_Details);
+}
+
+void EditorServer::CaptureSnapshotEntity(const EntityTreeNode& p_Node, SceneSnapshot::Entity& p_Entity) {
+	thread_local JsonWriter s_JsonValue;
 
-		p_Stream << write_json("type") << ":" << write_json(s_Interfaces[0].m_pTypeId->typeInfo()->m_pTypeName) << "}}";
+	p_Entity.Id = p_Node.EntityId;
+	p_Entity.Tblu = p_Node.TBLU.GetID();
+	p_Entity.Name = p_Node.Name;
+	p_Entity.Type = p_Node.TypeName;
+	p_Entity.Transform.reset();
+	p_Entity.Properties.clear();
 
-		(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
+	if (const auto s_Spatial = p_Node.Entity.QueryInterface<ZSpatialEntity>()) {
+		p_Entity.Transform = GetBinaryTransform(s_Spatial->GetWorldMatrix());
 	}
-	else {
-		auto s_JsonProperty = HM3_GameStructToJson(s_TypeName.c_str(), s_Data, s_TypeSize);
-		(*Globals::MemoryManager)->m_pNormalAllocator->Free(s_Data);
 
-		if (!s_JsonProperty) {
-			p_Stream << "null" << "}";
-			return;
-		}
+	const auto s_Metadata = m_TypeMetadata.Get(p_Node.Entity->GetType());
+	p_Entity.Properties.reserve(s_Metadata->Properties.size());
+
+	for (const auto& s_Property : s_Metadata->Properties) {
+		auto* s_Data = ReadPropertyData(p_Node.Entity, s_Property);
 
-		p_Stream << std::string_view(s_JsonProperty->JsonData, s_JsonProperty->StrSize) << "}";
-		HM3_FreeJsonString(s_JsonProperty);
+		s_JsonValue.Clear();
+		WritePropertyData(s_JsonValue, s_Property, s_Data);
+
+		ReleasePropertyData(s_Property, s_Data);
+
+		p_Entity.Properties.push_back({
+			.Id = s_Property.PropertyId,
+			.Name = s_Property.Name,
+			.Type = s_Property.TypeName,
+			.JsonValue = std::string(s_JsonValue.View()),
+		});
+	}
+
+	// Snapshots store properties by id, so they can be matched up when diffing.
+	std::ranges::sort(p_Entity.Properties, {}, &SceneSnapshot::Property::Id);
+}
+
+void EditorServer::WriteEntityTransform(EditorBinaryProtocol::Writer& p_Writer, ZEntityRef p_Entity) {
+	const auto s_Spatial = p_Entity.QueryInterface<ZSpatialEntity>();
+
+	if (!s_Spatial) {
+		throw std::runtime_error("Cannot encode the transform of a non-spatial entity.");
 	}
+
+	EditorBinaryProtocol::EntityTransform s_Transform {};
+
+	s_Transform.Id = p_Entity->GetType()->m_nEntityId;
+	s_Transform.WorldTransform = GetBinaryTransform(s_Spatial->GetWorldMatrix());
+
+	if (const auto s_Tblu = GetEntityTblu(p_Entity)) {
+		s_Transform.Tblu = s_Tblu->GetID();
+	}
+
+	if (const auto s_LocalTrans = GetRelativeTransform(p_Entity, s_Spatial)) {
+		s_Transform.RelativeTransform = GetBinaryTransform(*s_LocalTrans);
+	}
+
+	p_Writer.WriteEntityTransform(s_Transform);
 }
 
 EntitySelector EditorServer::ReadEntitySelector(simdjson::ondemand::value p_Selector) {
@@ -1005,16 +2377,53 @@ uint64_t EditorServer::ReadEntityId(simdjson::ondemand::value p_EntityId) {
 	return std::stoull(std::string(s_IdString), nullptr, 16);
 }
 
-void EditorServer::PublishEvent(const std::string& p_Event, std::optional<std::string> p_IgnoreClient) {
-	if (!p_IgnoreClient) {
-		m_App->publish("all", p_Event, uWS::OpCode::TEXT);
+EditorCommand EditorServer::ReadEditorCommand(simdjson::ondemand::object p_Command) {
+	EditorCommand s_Command {};
+
+	const std::string_view s_Type = p_Command["type"];
+
+	if (s_Type == "setEntityTransform") {
+		s_Command.Kind = EEditorCommandKind::SetEntityTransform;
+		s_Command.Entity = ReadEntitySelector(p_Command["entity"]);
+		s_Command.Transform = ReadTransform(p_Command["transform"]);
+		s_Command.Relative = bool(p_Command["relative"]);
+	}
+	else if (s_Type == "setEntityName") {
+		s_Command.Kind = EEditorCommandKind::SetEntityName;
+		s_Command.Entity = ReadEntitySelector(p_Command["entity"]);
+		s_Command.Name = std::string_view(p_Command["name"]);
+	}
+	else if (s_Type == "setEntityProperty") {
+		s_Command.Kind = EEditorCommandKind::SetEntityProperty;
+		s_Command.Entity = ReadEntitySelector(p_Command["entity"]);
+		s_Command.PropertyId = ReadPropertyId(p_Command["property"]);
+		s_Command.JsonValue = std::string_view(simdjson::to_json_string(p_Command["value"]));
 	}
 	else {
-		// Send to all but the client that triggered the event.
-		for (auto& s_Socket : m_SocketUserDatas) {
-			if (s_Socket->ClientId != *p_IgnoreClient) {
-				m_App->publish(s_Socket->ClientId, p_Event, uWS::OpCode::TEXT);
-			}
-		}
+		throw std::runtime_error(std::format("Unsupported batch command type: {}", s_Type));
+	}
+
+	return s_Command;
+}
+
+uint32_t EditorServer::ReadPropertyId(simdjson::ondemand::value p_Property) {
+	if (p_Property.type() == simdjson::ondemand::json_type::number) {
+		return static_cast<uint32_t>(int64_t(p_Property));
+	}
+
+	const std::string_view s_PropertyName = p_Property;
+	return Hash::Crc32(s_PropertyName.data(), s_PropertyName.size());
+}
+
+void EditorServer::PublishEvent(std::string_view p_Event, std::optional<std::string> p_IgnoreClient) {
+	const auto s_Sender = p_IgnoreClient ? m_SocketsByClientId.find(*p_IgnoreClient) : m_SocketsByClientId.end();
+
+	// Send to all but the client that triggered the event. Publishing as that client copies and compresses
+	// the message once for all recipients, instead of once per client topic.
+	// Clients can only publish to topics they are subscribed to, which they aren't until they've said hello.
+	// They don't get anything published to the topic then, so it can be published as the server instead.
+	if (s_Sender == m_SocketsByClientId.end() || !s_Sender->second->isSubscribed("all") ||
+		!Publish(s_Sender->second, "all", p_Event, uWS::OpCode::TEXT)) {
+		Publish("all", p_Event, uWS::OpCode::TEXT);
 	}
 }
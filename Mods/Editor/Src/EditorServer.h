@@ -1,10 +1,23 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <expected>
+#include <filesystem>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <cstdint>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "EntityTreeNode.h"
+#include "EditorBinaryProtocol.h"
+#include "EntityTreeDelta.h"
+#include "EntityTypeMetadata.h"
+#include "JsonHelpers.h"
+#include "SceneSnapshot.h"
 
 #include "uwebsockets/App.h"
 #include <Glacier/ZMath.h>
@@ -13,16 +26,149 @@
 
 #include <simdjson.h>
 
+class ZSpatialEntity;
+
 struct EntitySelector {
 	uint64_t EntityId;
 	std::optional<ZRuntimeResourceID> TbluHash;
 };
 
+enum class EEditorCommandKind : uint8_t {
+	SetEntityTransform,
+	SetEntityName,
+	SetEntityProperty,
+};
+
+// A command of a batch message. Only the fields used by its kind are set.
+struct EditorCommand {
+	EEditorCommandKind Kind;
+	EntitySelector Entity;
+	SMatrix Transform;
+	bool Relative = false;
+	std::string Name;
+	uint32_t PropertyId = 0;
+	std::string JsonValue;
+};
+
+// Commands that are applied together on the game thread, within a single frame.
+struct EditorCommandBatch {
+	std::vector<EditorCommand> Commands;
+
+	// When set, either all commands are applied or none of them are.
+	bool Atomic = false;
+
+	std::string ClientId;
+	std::optional<int64_t> MessageId;
+};
+
+struct EditorCommandBatchResult {
+	size_t Applied = 0;
+
+	// The index of each command that failed, and why.
+	std::vector<std::pair<size_t, std::string>> Errors;
+
+	// Set when an atomic batch failed after some of its commands were applied, and those were undone.
+	bool RolledBack = false;
+};
+
+// A snapshot of the scene to write to disk, requested by a client or from the UI.
+struct SceneSnapshotRequest {
+	std::filesystem::path Path;
+
+	// Not set for snapshots requested from the UI.
+	std::optional<std::string> ClientId;
+	std::optional<int64_t> MessageId;
+};
+
+struct SceneSnapshotResult {
+	uint64_t Entities = 0;
+	uint64_t Bytes = 0;
+
+	// Set when the snapshot couldn't be written.
+	std::optional<std::string> Error;
+};
+
+// Position of an entity list response within the entity tree.
+// Streamed responses keep this around between chunks.
+struct EntityListCursor {
+	// The tree the list was requested from. Used to detect rebuilds while streaming, and keeps the nodes alive.
+	std::shared_ptr<const EntityTree> Tree;
+	std::queue<std::pair<const EntityTreeNode*, uint32_t>> Nodes;
+	std::optional<uint32_t> MaxDepth;
+	std::optional<int64_t> MessageId;
+	size_t ChunkSize = 0;
+	uint32_t ChunkIndex = 0;
+};
+
+// Entity events that are coalesced until the end of the frame, so only the latest state is sent.
+enum class EEntityEventKind : uint8_t {
+	TransformChanged,
+	NameChanged,
+	PropertySet,
+};
+
+struct PendingEntityEvent {
+	ZEntityRef Entity;
+	EEntityEventKind Kind;
+	uint32_t PropertyId = 0;
+	std::optional<std::string> ByClient;
+};
+
+// A property of an entity that clients have asked to be told about when its value changes.
+struct PropertyWatchKey {
+	ZEntityRef Entity;
+	uint32_t PropertyId = 0;
+
+	bool operator==(const PropertyWatchKey& p_Other) const = default;
+
+	struct Hasher {
+		size_t operator()(const PropertyWatchKey& p_Key) const {
+			return std::hash<ZEntityRef>()(p_Key.Entity) ^ (static_cast<size_t>(p_Key.PropertyId) << 1);
+		}
+	};
+};
+
+// Counters for outgoing messages that were sent with permessage-deflate.
+struct EditorServerCompressionStats {
+	uint64_t CompressedMessages = 0;
+	uint64_t UncompressedMessages = 0;
+
+	// Total size of the compressed messages before compression.
+	uint64_t CompressedInputBytes = 0;
+
+	// Estimated compression ratio, from re-compressing a sample of the compressed messages with zlib.
+	double EstimatedRatio = 0.0;
+
+	// Time spent sending compressed messages, which is dominated by compressing them.
+	std::chrono::nanoseconds CompressionTime {};
+};
+
 class EditorServer {
 public:
 	struct SocketUserData {
 		std::string ClientId;
 		std::string Identifier;
+		std::unique_ptr<EntityListCursor> PendingEntityList;
+
+		// Reused for every message from this client, so parsing stops allocating once both have grown.
+		simdjson::ondemand::parser Parser;
+		std::vector<char> MessageBuffer;
+
+		// Set from the hello message. Binary clients get the high-volume events as binary frames.
+		bool BinaryProtocol = false;
+
+		// Set from the hello message. Transform updates then only carry the id and transforms of the entity.
+		bool TransformOnlyUpdates = false;
+
+		// Transform updates are rate limited per client. Entities that change while a client is limited
+		// are collected here, and their latest state is sent once it may receive updates again.
+		// Entities are removed from it when they leave the entity tree, so it never refers to destroyed ones.
+		std::unordered_set<ZEntityRef> PendingTransforms;
+		std::chrono::steady_clock::duration MinTransformInterval {};
+		std::chrono::steady_clock::time_point NextTransformUpdate {};
+
+		// The properties this client gets entityPropertiesChanged events for.
+		std::unordered_set<PropertyWatchKey, PropertyWatchKey::Hasher> WatchedProperties;
 	};
 
 	using WebSocket = uWS::WebSocket<false, true, SocketUserData>;
@@ -30,6 +176,13 @@ public:
 	EditorServer();
 	~EditorServer();
 
+	/**
+	 * Starts the server thread.
+	 * @param p_Compression The permessage-deflate compressor to offer to clients, or uWS::DISABLED.
+	 * @param p_CompressionThreshold Only messages of at least this many bytes are compressed.
+	 */
+	void Start(uWS::CompressOptions p_Compression, size_t p_CompressionThreshold);
+
 	void OnEntitySelected(ZEntityRef p_Entity, std::optional<std::string> p_ByClient);
 	void OnEntityTransformChanged(ZEntityRef p_Entity, std::optional<std::string> p_ByClient);
 	void OnEntityNameChanged(ZEntityRef p_Entity, std::optional<std::string> p_ByClient);
@@ -37,25 +190,95 @@ public:
 	void OnSceneLoading(const std::string& p_Scene, const std::vector<std::string>& p_Bricks);
 	void OnSceneClearing(bool p_ForReload);
 	void OnEntityTreeRebuilt();
+	void OnEntityTreeChanged(const EntityTreeDelta& p_Delta, size_t p_TreeSize);
+	void OnCommandBatchApplied(const std::string& p_ClientId, std::optional<int64_t> p_MessageId, EditorCommandBatchResult p_Result);
+	void OnSceneSnapshotSaved(const SceneSnapshotRequest& p_Request, SceneSnapshotResult p_Result);
+
+	// Stops sampling and sending updates for the entities that aren't in the tree anymore. Called with the tree locked.
+	void ReleaseRemovedEntities(std::shared_ptr<const EntityTree> p_Tree);
+
+	// Stops sampling and sending updates for an entity that is about to be destroyed.
+	void ReleaseEntity(ZEntityRef p_Entity);
+
+	// Copies the state of the entity of a node into a snapshot entity. Called on the game thread.
+	static void CaptureSnapshotEntity(const EntityTreeNode& p_Node, SceneSnapshot::Entity& p_Entity);
+
+	// Samples the watched properties and sends the entity events queued since the last call.
+	// Called once per frame on the game thread.
+	void FlushEvents();
+
 	void SetEnabled(bool p_Enabled);
 	bool GetEnabled();
+	EditorServerCompressionStats GetCompressionStats() const;
 
 private:
-	static void OnMessage(WebSocket* p_Socket, std::string_view p_Message) noexcept(false);
+	void OnMessage(WebSocket* p_Socket, std::string_view p_Message) noexcept(false);
+
+	// All outgoing messages go through these, so large ones can be compressed.
+	static void Send(WebSocket* p_Socket, std::string_view p_Message, uWS::OpCode p_OpCode);
+	void Publish(std::string_view p_Topic, std::string_view p_Message, uWS::OpCode p_OpCode);
+
+	// Publishes on behalf of a client. Every subscriber of the topic except that client receives the message.
+	// Returns false if the client couldn't publish it, in which case nobody received it.
+	static bool Publish(WebSocket* p_Sender, std::string_view p_Topic, std::string_view p_Message, uWS::OpCode p_OpCode);
+	static bool ShouldCompress(std::string_view p_Message);
+	static void RecordCompressedMessage(std::string_view p_Message, std::chrono::nanoseconds p_Time);
 
 	static void SendWelcome(WebSocket* p_Socket);
 	static void SendHitmanEntity(WebSocket* p_Socket, std::optional<int64_t> p_MessageId);
 	static void SendCameraEntity(WebSocket* p_Socket, std::optional<int64_t> p_MessageId);
 	static void SendError(WebSocket* p_Socket, std::string p_Message, std::optional<int64_t> p_MessageId);
-	static void SendEntityList(WebSocket* p_Socket, std::shared_ptr<EntityTreeNode> p_Tree, std::optional<int64_t> p_MessageId);
+	static void SendEntityList(WebSocket* p_Socket, std::shared_ptr<const EntityTree> p_Tree, const EntityTreeNode* p_Root, std::optional<uint32_t> p_MaxDepth, std::optional<int64_t> p_MessageId);
+	static void StreamEntityList(WebSocket* p_Socket, std::shared_ptr<const EntityTree> p_Tree, const EntityTreeNode* p_Root, std::optional<uint32_t> p_MaxDepth, size_t p_ChunkSize, std::optional<int64_t> p_MessageId);
+	static void ContinueEntityListStream(WebSocket* p_Socket);
+	static void SendEntityQueryResult(WebSocket* p_Socket, const std::vector<const EntityTreeNode*>& p_Nodes, size_t p_Offset, size_t p_Limit, std::optional<int64_t> p_MessageId);
 	static void SendEntityDetails(WebSocket* p_Socket, ZEntityRef p_Entity, std::optional<int64_t> p_MessageId);
+	void SendServerStats(WebSocket* p_Socket, std::optional<int64_t> p_MessageId);
+
+	void QueueEntityEvent(PendingEntityEvent p_Event);
+	void SendPendingEvents();
+	void SendTransformUpdates(const std::vector<PendingEntityEvent>& p_Events);
+	void SendEntityNameChanged(ZEntityRef p_Entity, const std::optional<std::string>& p_ByClient);
+	void SendEntityPropertySet(ZEntityRef p_Entity, uint32_t p_PropertyId, const std::optional<std::string>& p_ByClient);
+
+	void WatchProperties(WebSocket* p_Socket, ZEntityRef p_Entity, const std::vector<uint32_t>& p_PropertyIds);
+	void UnwatchProperties(WebSocket* p_Socket, ZEntityRef p_Entity, std::optional<std::vector<uint32_t>> p_PropertyIds);
+	void ReleasePropertyWatches(SocketUserData* p_Data);
+	void ReleaseEntities(std::function<bool(ZEntityRef)> p_IsReleased);
+	void SamplePropertyWatches();
+	void SendPropertyChanges(const std::vector<std::pair<PropertyWatchKey, std::string>>& p_Changes);
+
+	static JsonWriter& GetEventWriter();
+	static EditorBinaryProtocol::Writer& GetBinaryEventWriter();
+
+	template <typename T>
+	static uint32_t WriteEntityList(T& p_Writer, EntityListCursor& p_Cursor, size_t p_MaxEntities);
+	static void WriteEntityListEntry(JsonWriter& p_Writer, const EntityTreeNode& p_Node, bool p_IncludeChildCount);
+	static void WriteEntityTreeKey(JsonWriter& p_Writer, const EntityTreeKey& p_Key);
+	static void WriteEntityDetails(JsonWriter& p_Writer, ZEntityRef p_Entity);
+	static void WriteEntityTransform(JsonWriter& p_Writer, ZEntityRef p_Entity);
+	static void WriteEntitySelectorFields(JsonWriter& p_Writer, ZEntityRef p_Entity);
+	static void WriteVector3(JsonWriter& p_Writer, double p_X, double p_Y, double p_Z);
+	static void WriteRotation(JsonWriter& p_Writer, double p_Yaw, double p_Pitch, double p_Roll);
+	static void WriteTransform(JsonWriter& p_Writer, SMatrix p_Transform);
+	static void WriteProperty(JsonWriter& p_Writer, ZEntityRef p_Entity, const PropertyDescriptor& p_Property);
+
+	// Returns a pointer to the value of a property, which has to be released with ReleasePropertyData.
+	static void* ReadPropertyData(ZEntityRef p_Entity, const PropertyDescriptor& p_Property);
+	static void ReleasePropertyData(const PropertyDescriptor& p_Property, void* p_Data);
+
+	// Writes only the value of a property, without its type. Returns false if it couldn't be serialized and null was written instead.
+	static bool WritePropertyData(JsonWriter& p_Writer, const PropertyDescriptor& p_Property, void* p_Data);
+	static void WriteEntityReference(JsonWriter& p_Writer, ZEntityRef p_Entity);
 
-	static void WriteEntityDetails(std::ostream& p_Stream, ZEntityRef p_Entity);
-	static void WriteVector3(std::ostream& p_Stream, double p_X, double p_Y, double p_Z);
-	static void WriteRotation(std::ostream& p_Stream, double p_Yaw, double p_Pitch, double p_Roll);
-	static void WriteTransform(std::ostream& p_Stream, SMatrix p_Transform);
-	static void WritePropertyName(std::ostream& p_Stream, ZEntityProperty* p_Property);
-	static void WriteProperty(std::ostream& p_Stream, ZEntityRef p_Entity, ZEntityProperty* p_Property);
+	static void WriteEntityListEntry(EditorBinaryProtocol::Writer& p_Writer, const EntityTreeNode& p_Node, bool p_IncludeChildCount);
+	static void WriteEntityDetails(EditorBinaryProtocol::Writer& p_Writer, ZEntityRef p_Entity);
+	static void WriteEntityTransform(EditorBinaryProtocol::Writer& p_Writer, ZEntityRef p_Entity);
+
+	static std::optional<ZRuntimeResourceID> GetEntityTblu(ZEntityRef p_Entity);
+	static EditorBinaryProtocol::Entity GetBinaryEntity(ZEntityRef p_Entity);
+	static EditorBinaryProtocol::Transform GetBinaryTransform(SMatrix p_Transform);
+	static std::optional<SMatrix> GetRelativeTransform(ZEntityRef p_Entity, ZSpatialEntity* p_Spatial);
 
 public:
 	static EntitySelector ReadEntitySelector(simdjson::ondemand::value p_Selector);
@@ -64,15 +287,76 @@ public:
 	static SMatrix ReadTransform(simdjson::ondemand::value p_Transform);
 	static ZRuntimeResourceID ReadResourceId(simdjson::ondemand::value p_ResourceId);
 	static uint64_t ReadEntityId(simdjson::ondemand::value p_EntityId);
+	static uint32_t ReadPropertyId(simdjson::ondemand::value p_Property);
+	static EditorCommand ReadEditorCommand(simdjson::ondemand::object p_Command);
 
 private:
-	void PublishEvent(const std::string& p_Event, std::optional<std::string> p_IgnoreClient);
+	void PublishEvent(std::string_view p_Event, std::optional<std::string> p_IgnoreClient);
 
 private:
 	uint64_t m_LastClientId = 0;
-	uWS::App* m_App;
-	uWS::Loop* m_Loop;
-	std::vector<SocketUserData*> m_SocketUserDatas;
+	uWS::App* m_App = nullptr;
+	uWS::Loop* m_Loop = nullptr;
+
+	// Connected clients. Only used on the server thread, from uWS callbacks and tasks deferred to its loop,
+	// so they need no locking. Other threads must go through m_Loop->defer.
+	std::vector<WebSocket*> m_Sockets;
+	std::unordered_map<std::string, WebSocket*> m_SocketsByClientId;
+
+	struct PendingEntityEventKey {
+		ZEntityRef Entity;
+		EEntityEventKind Kind;
+		uint32_t PropertyId;
+
+		bool operator==(const PendingEntityEventKey& p_Other) const = default;
+
+		struct Hasher {
+			size_t operator()(const PendingEntityEventKey& p_Key) const {
+				return std::hash<ZEntityRef>()(p_Key.Entity) ^ (static_cast<size_t>(p_Key.PropertyId) << 2 | static_cast<size_t>(p_Key.Kind));
+			}
+		};
+	};
+
+	// Entity events queued since the last flush, in the order they were first queued.
+	std::mutex m_PendingEventsMutex;
+	std::vector<PendingEntityEvent> m_PendingEvents;
+	std::unordered_map<PendingEntityEventKey, size_t, PendingEntityEventKey::Hasher> m_PendingEventIndices;
+	std::atomic_bool m_FlushScheduled = false;
+	std::atomic_bool m_HasPendingTransforms = false;
+
+	struct PropertyWatch {
+		// Keeps the descriptor alive.
+		std::shared_ptr<const EntityTypeMetadata> Metadata;
+		const PropertyDescriptor* Property = nullptr;
+
+		// The number of clients watching the property.
+		uint32_t Watchers = 0;
+
+		// The bytes of the property as of the last time it was sent.
+		std::vector<char> LastValue;
+		bool HasValue = false;
+	};
+
+	// Written on the server thread, and sampled on the game thread once per frame.
+	std::mutex m_PropertyWatchesMutex;
+	std::unordered_map<PropertyWatchKey, PropertyWatch, PropertyWatchKey::Hasher> m_PropertyWatches;
+
+	// Declared after everything its socket callbacks use, so it is joined before they are destroyed.
 	std::jthread m_ServerThread;
+
 	static bool m_Enabled;
+
+	static uWS::CompressOptions m_Compression;
+	static size_t m_CompressionThreshold;
+
+	// Written on the server thread and read by the UI.
+	static std::atomic<uint64_t> m_CompressedMessages;
+	static std::atomic<uint64_t> m_UncompressedMessages;
+	static std::atomic<uint64_t> m_CompressedInputBytes;
+	static std::atomic<uint64_t> m_SampledInputBytes;
+	static std::atomic<uint64_t> m_SampledOutputBytes;
+	static std::atomic<int64_t> m_CompressionTimeNs;
+
+	// Property metadata of the entity types in the scene, shared by everything that serializes properties.
+	static EntityTypeMetadataCache m_TypeMetadata;
 };
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "EntityTreeDelta.h"
+
+#include <algorithm>
+#include <queue>
+
+static bool SnapshotEntryLess(const EntityTreeSnapshotEntry& p_Left, const EntityTreeSnapshotEntry& p_Right) {
+	if (p_Left.Key != p_Right.Key) {
+		return p_Left.Key < p_Right.Key;
+	}
+
+	return p_Left.Parent < p_Right.Parent;
+}
+
+EntityTreeSnapshot BuildEntityTreeSnapshot(const EntityTree& p_Tree) {
+	EntityTreeSnapshot s_Snapshot;
+	std::queue<std::pair<const EntityTreeNode*, std::optional<EntityTreeKey>>> s_NodeQueue;
+
+	s_Snapshot.reserve(p_Tree.Size());
+	s_NodeQueue.emplace(&p_Tree.GetRoot(), std::nullopt);
+
+	// Walk the tree the same way entity lists do, so the snapshot covers exactly the listed nodes.
+	while (!s_NodeQueue.empty()) {
+		const auto [s_Node, s_Parent] = s_NodeQueue.front();
+		s_NodeQueue.pop();
+
+		if (!s_Node->Entity) {
+			continue;
+		}
+
+		const EntityTreeKey s_Key { s_Node->EntityId, s_Node->TBLU.GetID() };
+
+		for (const auto s_Child : p_Tree.GetChildren(*s_Node)) {
+			s_NodeQueue.emplace(&p_Tree.GetNode(s_Child), s_Key);
+		}
+
+		s_Snapshot.push_back({ s_Key, s_Parent, s_Node, s_Snapshot.size() });
+	}
+
+	std::sort(s_Snapshot.begin(), s_Snapshot.end(), SnapshotEntryLess);
+
+	return s_Snapshot;
+}
+
+EntityTreeDelta DiffEntityTreeSnapshots(const EntityTreeSnapshot& p_Old, const EntityTreeSnapshot& p_New) {
+	// First find the (key, parent) pairs that are only in one of the snapshots. Keys aren't unique
+	// (the same blueprint can be instantiated more than once), so this is a multiset difference.
+	std::vector<const EntityTreeSnapshotEntry*> s_OldOnly;
+	std::vector<const EntityTreeSnapshotEntry*> s_NewOnly;
+
+	auto s_OldIt = p_Old.begin();
+	auto s_NewIt = p_New.begin();
+
+	while (s_OldIt != p_Old.end() && s_NewIt != p_New.end()) {
+		if (SnapshotEntryLess(*s_OldIt, *s_NewIt)) {
+			s_OldOnly.push_back(&*s_OldIt++);
+		}
+		else if (SnapshotEntryLess(*s_NewIt, *s_OldIt)) {
+			s_NewOnly.push_back(&*s_NewIt++);
+		}
+		else {
+			++s_OldIt;
+			++s_NewIt;
+		}
+	}
+
+	for (; s_OldIt != p_Old.end(); ++s_OldIt) {
+		s_OldOnly.push_back(&*s_OldIt);
+	}
+
+	for (; s_NewIt != p_New.end(); ++s_NewIt) {
+		s_NewOnly.push_back(&*s_NewIt);
+	}
+
+	// Then a key that disappeared from one parent and appeared under another was moved.
+	EntityTreeDelta s_Delta;
+
+	auto s_RemovedIt = s_OldOnly.begin();
+	auto s_AddedIt = s_NewOnly.begin();
+
+	while (s_RemovedIt != s_OldOnly.end() || s_AddedIt != s_NewOnly.end()) {
+		if (s_AddedIt == s_NewOnly.end() || (s_RemovedIt != s_OldOnly.end() && (*s_RemovedIt)->Key < (*s_AddedIt)->Key)) {
+			s_Delta.Removed.push_back((*s_RemovedIt++)->Key);
+		}
+		else if (s_RemovedIt == s_OldOnly.end() || (*s_AddedIt)->Key < (*s_RemovedIt)->Key) {
+			s_Delta.Added.push_back(**s_AddedIt++);
+		}
+		else {
+			s_Delta.Reparented.push_back(**s_AddedIt++);
+			++s_RemovedIt;
+		}
+	}
+
+	const auto s_IndexLess = [](const EntityTreeSnapshotEntry& p_Left, const EntityTreeSnapshotEntry& p_Right) {
+		return p_Left.Index < p_Right.Index;
+	};
+
+	std::sort(s_Delta.Added.begin(), s_Delta.Added.end(), s_IndexLess);
+	std::sort(s_Delta.Reparented.begin(), s_Delta.Reparented.end(), s_IndexLess);
+
+	return s_Delta;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "EntityTreeNode.h"
+
+// Identifies a node of the entity tree across rebuilds.
+struct EntityTreeKey {
+	uint64_t EntityId = 0;
+	uint64_t TBLU = 0;
+
+	auto operator<=>(const EntityTreeKey&) const = default;
+};
+
+struct EntityTreeSnapshotEntry {
+	EntityTreeKey Key;
+
+	// The key of the parent node, or nullopt for the root of the tree.
+	std::optional<EntityTreeKey> Parent;
+
+	// Points into the tree the snapshot was built from. Only used to write out nodes added to the current tree,
+	// since older trees and their entities might not exist anymore.
+	const EntityTreeNode* Node = nullptr;
+
+	// Breadth-first position of the node in its tree.
+	size_t Index = 0;
+};
+
+// The nodes of an entity tree, sorted by key and then by parent key.
+using EntityTreeSnapshot = std::vector<EntityTreeSnapshotEntry>;
+
+// Added and reparented nodes are in breadth-first order, so parents come before their children.
+struct EntityTreeDelta {
+	std::vector<EntityTreeSnapshotEntry> Added;
+	std::vector<EntityTreeKey> Removed;
+
+	// Nodes that are still in the tree but have a different parent. Holds the new parent.
+	std::vector<EntityTreeSnapshotEntry> Reparented;
+
+	size_t Size() const {
+		return Added.size() + Removed.size() + Reparented.size();
+	}
+};
+
+EntityTreeSnapshot BuildEntityTreeSnapshot(const EntityTree& p_Tree);
+EntityTreeDelta DiffEntityTreeSnapshots(const EntityTreeSnapshot& p_Old, const EntityTreeSnapshot& p_New);
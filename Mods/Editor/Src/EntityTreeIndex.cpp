@@ -0,0 +1,345 @@
+#include "EntityTreeIndex.h"
+
+#include <Glacier/EntityFactory.h>
+#include <Glacier/ZSpatialEntity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+// Size of a cell of the spatial grid, in meters.
+constexpr float c_SpatialGridCellSize = 32.f;
+
+// Names shorter than a trigram can't use the name index and are matched against every node instead.
+constexpr size_t c_TrigramSize = 3;
+
+static char ToLowerAscii(char p_Char) {
+	return p_Char >= 'A' && p_Char <= 'Z' ? static_cast<char>(p_Char - 'A' + 'a') : p_Char;
+}
+
+static uint32_t GetTrigram(std::string_view p_String, size_t p_Offset) {
+	return static_cast<uint8_t>(ToLowerAscii(p_String[p_Offset])) |
+		static_cast<uint8_t>(ToLowerAscii(p_String[p_Offset + 1])) << 8 |
+		static_cast<uint8_t>(ToLowerAscii(p_String[p_Offset + 2])) << 16;
+}
+
+static int32_t GetCellCoordinate(float p_Position) {
+	// Clamped to what fits in the 21 bits each axis gets in a cell key.
+	const auto s_Cell = std::floor(p_Position / c_SpatialGridCellSize);
+	return static_cast<int32_t>(std::clamp(s_Cell, -1048576.f, 1048575.f));
+}
+
+static uint64_t GetCellKey(int32_t p_X, int32_t p_Y, int32_t p_Z) {
+	constexpr uint64_t c_AxisMask = (1ull << 21) - 1;
+
+	return (static_cast<uint64_t>(p_X) & c_AxisMask) |
+		(static_cast<uint64_t>(p_Y) & c_AxisMask) << 21 |
+		(static_cast<uint64_t>(p_Z) & c_AxisMask) << 42;
+}
+
+static bool ContainsCaseInsensitive(std::string_view p_String, std::string_view p_Substring) {
+	if (p_Substring.empty()) {
+		return true;
+	}
+
+	return !std::ranges::search(p_String, p_Substring, [](char p_Left, char p_Right) {
+		return ToLowerAscii(p_Left) == ToLowerAscii(p_Right);
+	}).empty();
+}
+
+// Patterns come from clients, so unlike a regex this never takes more than pattern size times string size steps:
+// a mismatch only ever backtracks to just after the last star.
+static bool MatchesWildcardCaseInsensitive(std::string_view p_String, std::string_view p_Pattern) {
+	size_t s_StringPos = 0;
+	size_t s_PatternPos = 0;
+	size_t s_StarPatternPos = std::string_view::npos;
+	size_t s_StarStringPos = 0;
+
+	while (s_StringPos < p_String.size()) {
+		if (s_PatternPos < p_Pattern.size() && p_Pattern[s_PatternPos] == '*') {
+			s_StarPatternPos = s_PatternPos++;
+			s_StarStringPos = s_StringPos;
+		} else if (s_PatternPos < p_Pattern.size() &&
+			(p_Pattern[s_PatternPos] == '?' || ToLowerAscii(p_Pattern[s_PatternPos]) == ToLowerAscii(p_String[s_StringPos]))) {
+			++s_PatternPos;
+			++s_StringPos;
+		} else if (s_StarPatternPos != std::string_view::npos) {
+			// Let the last star match one more character and try again from there.
+			s_PatternPos = s_StarPatternPos + 1;
+			s_StringPos = ++s_StarStringPos;
+		} else {
+			return false;
+		}
+	}
+
+	while (s_PatternPos < p_Pattern.size() && p_Pattern[s_PatternPos] == '*') {
+		++s_PatternPos;
+	}
+
+	return s_PatternPos == p_Pattern.size();
+}
+
+void EntityTreeIndex::Build(const EntityTree& p_Tree) {
+	Clear();
+
+	m_NodesByKey.reserve(p_Tree.Size());
+	m_NodesById.reserve(p_Tree.Size());
+	m_Nodes.reserve(p_Tree.Size());
+	m_Positions.reserve(p_Tree.Size());
+
+	std::queue<const EntityTreeNode*> s_NodeQueue;
+	s_NodeQueue.push(&p_Tree.GetRoot());
+
+	// Same order as the tree walk selectors used to resolve with, so the same node wins when several match.
+	while (!s_NodeQueue.empty()) {
+		const auto s_Node = s_NodeQueue.front();
+		s_NodeQueue.pop();
+
+		for (const auto s_Child : p_Tree.GetChildren(*s_Node)) {
+			s_NodeQueue.push(&p_Tree.GetNode(s_Child));
+		}
+
+		m_NodesByKey.try_emplace({ s_Node->EntityId, s_Node->TBLU.GetID() }, s_Node);
+
+		if (s_Node->Entity) {
+			const auto s_OwningEntity = s_Node->Entity.GetOwningEntity();
+
+			if (s_OwningEntity && s_OwningEntity.GetBlueprintFactory()) {
+				m_NodesByKey.try_emplace(
+					{ s_Node->EntityId, s_OwningEntity.GetBlueprintFactory()->m_ridResource.GetID() }, s_Node
+				);
+			}
+
+			if (const auto s_Factory = s_Node->Entity.GetBlueprintFactory()) {
+				m_NodesByKey.try_emplace({ s_Node->EntityId, s_Factory->m_ridResource.GetID() }, s_Node);
+			}
+		}
+
+		m_NodesById[s_Node->EntityId] = s_Node;
+
+		const auto s_Index = static_cast<uint32_t>(m_Nodes.size());
+		m_Nodes.push_back(s_Node);
+
+		m_NodesByType[s_Node->TypeName].push_back(s_Index);
+		m_NodesByTblu[s_Node->TBLU.GetID()].push_back(s_Index);
+		AddNameTrigrams(s_Index, s_Node->Name);
+
+		auto& s_Position = m_Positions.emplace_back();
+
+		if (s_Node->Entity) {
+			if (const auto s_Spatial = s_Node->Entity.QueryInterface<ZSpatialEntity>()) {
+				const auto s_Trans = s_Spatial->GetWorldMatrix().Trans;
+				s_Position = SVector3(s_Trans.x, s_Trans.y, s_Trans.z);
+
+				m_NodesByCell[GetCellKey(
+					GetCellCoordinate(s_Trans.x), GetCellCoordinate(s_Trans.y), GetCellCoordinate(s_Trans.z)
+				)].push_back(s_Index);
+			}
+		}
+	}
+}
+
+void EntityTreeIndex::AddNameTrigrams(uint32_t p_Node, std::string_view p_Name) {
+	for (size_t i = 0; i + c_TrigramSize <= p_Name.size(); ++i) {
+		auto& s_Nodes = m_NodesByNameTrigram[GetTrigram(p_Name, i)];
+
+		// Names can contain the same trigram more than once.
+		if (s_Nodes.empty() || s_Nodes.back() != p_Node) {
+			s_Nodes.push_back(p_Node);
+		}
+	}
+}
+
+void EntityTreeIndex::Clear() {
+	m_NodesByKey.clear();
+	m_NodesById.clear();
+	m_Nodes.clear();
+	m_NodesByType.clear();
+	m_NodesByTblu.clear();
+	m_NodesByNameTrigram.clear();
+	m_Positions.clear();
+	m_NodesByCell.clear();
+}
+
+const EntityTreeNode* EntityTreeIndex::Find(uint64_t p_EntityId, ZRuntimeResourceID p_TBLU) const {
+	if (const auto it = m_NodesByKey.find({ p_EntityId, p_TBLU.GetID() }); it != m_NodesByKey.end()) {
+		return it->second;
+	}
+
+	if (const auto it = m_NodesById.find(p_EntityId); it != m_NodesById.end()) {
+		return it->second;
+	}
+
+	return nullptr;
+}
+
+std::vector<const EntityTreeNode*> EntityTreeIndex::Query(const EntityQuery& p_Query) const {
+	// Every indexed filter narrows the query down to a sorted list of candidates. Their intersection is
+	// then checked against all filters, since trigrams and grid cells only approximate what they match.
+	std::vector<const NodeList*> s_Candidates;
+
+	if (p_Query.TypeName) {
+		const auto it = m_NodesByType.find(*p_Query.TypeName);
+
+		if (it == m_NodesByType.end()) {
+			return {};
+		}
+
+		s_Candidates.push_back(&it->second);
+	}
+
+	if (p_Query.TBLU) {
+		const auto it = m_NodesByTblu.find(p_Query.TBLU->GetID());
+
+		if (it == m_NodesByTblu.end()) {
+			return {};
+		}
+
+		s_Candidates.push_back(&it->second);
+	}
+
+	if (p_Query.NameContains) {
+		const std::string_view s_Name = *p_Query.NameContains;
+
+		for (size_t i = 0; i + c_TrigramSize <= s_Name.size(); ++i) {
+			const auto it = m_NodesByNameTrigram.find(GetTrigram(s_Name, i));
+
+			if (it == m_NodesByNameTrigram.end()) {
+				return {};
+			}
+
+			s_Candidates.push_back(&it->second);
+		}
+	}
+
+	if (p_Query.NamePattern) {
+		const std::string_view s_Pattern = *p_Query.NamePattern;
+
+		// Every run of characters between wildcards has to be in the name.
+		for (size_t s_RunStart = 0; s_RunStart < s_Pattern.size();) {
+			const size_t s_RunEnd = (std::min)(s_Pattern.find_first_of("*?", s_RunStart), s_Pattern.size());
+
+			for (size_t i = s_RunStart; i + c_TrigramSize <= s_RunEnd; ++i) {
+				const auto it = m_NodesByNameTrigram.find(GetTrigram(s_Pattern, i));
+
+				if (it == m_NodesByNameTrigram.end()) {
+					return {};
+				}
+
+				s_Candidates.push_back(&it->second);
+			}
+
+			s_RunStart = s_RunEnd + 1;
+		}
+	}
+
+	NodeList s_NodesInBounds;
+
+	if (p_Query.Bounds) {
+		const auto& s_Min = p_Query.Bounds->Min;
+		const auto& s_Max = p_Query.Bounds->Max;
+
+		const int32_t s_MinX = GetCellCoordinate(s_Min.x), s_MaxX = GetCellCoordinate(s_Max.x);
+		const int32_t s_MinY = GetCellCoordinate(s_Min.y), s_MaxY = GetCellCoordinate(s_Max.y);
+		const int32_t s_MinZ = GetCellCoordinate(s_Min.z), s_MaxZ = GetCellCoordinate(s_Max.z);
+
+		const auto s_CellCount =
+			(std::max)(0.0, double(s_MaxX) - s_MinX + 1) *
+			(std::max)(0.0, double(s_MaxY) - s_MinY + 1) *
+			(std::max)(0.0, double(s_MaxZ) - s_MinZ + 1);
+
+		const auto s_AddCell = [&](const NodeList& p_Nodes) {
+			s_NodesInBounds.insert(s_NodesInBounds.end(), p_Nodes.begin(), p_Nodes.end());
+		};
+
+		// Large boxes cover more cells than there are occupied ones, so walk those instead.
+		if (s_CellCount <= static_cast<double>(m_NodesByCell.size())) {
+			for (int32_t x = s_MinX; x <= s_MaxX; ++x) {
+				for (int32_t y = s_MinY; y <= s_MaxY; ++y) {
+					for (int32_t z = s_MinZ; z <= s_MaxZ; ++z) {
+						if (const auto it = m_NodesByCell.find(GetCellKey(x, y, z)); it != m_NodesByCell.end()) {
+							s_AddCell(it->second);
+						}
+					}
+				}
+			}
+		}
+		else {
+			for (const auto& [s_Cell, s_Nodes] : m_NodesByCell) {
+				const auto& s_Position = *m_Positions[s_Nodes.front()];
+				const int32_t s_X = GetCellCoordinate(s_Position.x);
+				const int32_t s_Y = GetCellCoordinate(s_Position.y);
+				const int32_t s_Z = GetCellCoordinate(s_Position.z);
+
+				if (s_X >= s_MinX && s_X <= s_MaxX && s_Y >= s_MinY && s_Y <= s_MaxY && s_Z >= s_MinZ && s_Z <= s_MaxZ) {
+					s_AddCell(s_Nodes);
+				}
+			}
+		}
+
+		// Every node is in a single cell, so this only needs sorting.
+		std::ranges::sort(s_NodesInBounds);
+		s_Candidates.push_back(&s_NodesInBounds);
+	}
+
+	std::vector<const EntityTreeNode*> s_Results;
+
+	if (s_Candidates.empty()) {
+		for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+			if (Matches(i, p_Query)) {
+				s_Results.push_back(m_Nodes[i]);
+			}
+		}
+
+		return s_Results;
+	}
+
+	// Start from the shortest list and look its nodes up in the others.
+	std::ranges::sort(s_Candidates, {}, [](const NodeList* p_Nodes) { return p_Nodes->size(); });
+
+	for (const auto s_Node : *s_Candidates[0]) {
+		const bool s_InAll = std::all_of(s_Candidates.begin() + 1, s_Candidates.end(), [s_Node](const NodeList* p_Nodes) {
+			return std::ranges::binary_search(*p_Nodes, s_Node);
+		});
+
+		if (s_InAll && Matches(s_Node, p_Query)) {
+			s_Results.push_back(m_Nodes[s_Node]);
+		}
+	}
+
+	return s_Results;
+}
+
+bool EntityTreeIndex::Matches(uint32_t p_Node, const EntityQuery& p_Query) const {
+	const auto* s_Node = m_Nodes[p_Node];
+
+	if (p_Query.TypeName && s_Node->TypeName != *p_Query.TypeName) {
+		return false;
+	}
+
+	if (p_Query.TBLU && s_Node->TBLU.GetID() != p_Query.TBLU->GetID()) {
+		return false;
+	}
+
+	if (p_Query.NameContains && !ContainsCaseInsensitive(s_Node->Name, *p_Query.NameContains)) {
+		return false;
+	}
+
+	if (p_Query.NamePattern && !MatchesWildcardCaseInsensitive(s_Node->Name, *p_Query.NamePattern)) {
+		return false;
+	}
+
+	if (p_Query.Bounds) {
+		const auto& s_Position = m_Positions[p_Node];
+		const auto& s_Min = p_Query.Bounds->Min;
+		const auto& s_Max = p_Query.Bounds->Max;
+
+		if (!s_Position ||
+			s_Position->x < s_Min.x || s_Position->y < s_Min.y || s_Position->z < s_Min.z ||
+			s_Position->x > s_Max.x || s_Position->y > s_Max.y || s_Position->z > s_Max.z) {
+			return false;
+		}
+	}
+
+	return true;
+}
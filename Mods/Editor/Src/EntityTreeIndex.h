@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Glacier/ZMath.h>
+
+#include "EntityTreeDelta.h"
+#include "EntityTreeNode.h"
+
+struct EntityTreeKeyHash {
+	size_t operator()(const EntityTreeKey& p_Key) const {
+		return std::hash<uint64_t>()(p_Key.EntityId) ^ (std::hash<uint64_t>()(p_Key.TBLU) * 0x9e3779b97f4a7c15ull);
+	}
+};
+
+// An axis-aligned box in world space.
+struct EntityQueryBounds {
+	SVector3 Min;
+	SVector3 Max;
+};
+
+// Filters of an entity query. Entities have to match all of the filters that are set.
+struct EntityQuery {
+	// The type of the entity, matched exactly.
+	std::optional<std::string> TypeName;
+
+	// Matched case-insensitively anywhere in the name of the entity.
+	std::optional<std::string> NameContains;
+
+	// Matched case-insensitively against the whole name of the entity. `*` matches any number of
+	// characters and `?` a single one.
+	std::optional<std::string> NamePattern;
+
+	std::optional<ZRuntimeResourceID> TBLU;
+
+	// Matched against where spatial entities were when the tree was built, since entities move between builds.
+	std::optional<EntityQueryBounds> Bounds;
+};
+
+// Lookup tables for resolving entity selectors and queries without walking the entity tree.
+// Built alongside the tree and replaced together with it, since it points into the tree.
+class EntityTreeIndex {
+public:
+	void Build(const EntityTree& p_Tree);
+	void Clear();
+
+	// Finds the node for a game entity selector, matching the blueprint against the node itself,
+	// its owning entity's factory, or its own factory. Falls back to the last node with the same
+	// id when none of these match.
+	[[nodiscard]] const EntityTreeNode* Find(uint64_t p_EntityId, ZRuntimeResourceID p_TBLU) const;
+
+	// Finds the nodes that match a query, in breadth-first order.
+	[[nodiscard]] std::vector<const EntityTreeNode*> Query(const EntityQuery& p_Query) const;
+
+private:
+	// Nodes are referred to by their position in breadth-first order in the query indexes,
+	// which keeps every posting list sorted as it is built.
+	using NodeList = std::vector<uint32_t>;
+
+	[[nodiscard]] bool Matches(uint32_t p_Node, const EntityQuery& p_Query) const;
+	void AddNameTrigrams(uint32_t p_Node, std::string_view p_Name);
+
+	// Keyed by every blueprint a node can be selected with. The first node in breadth-first order wins.
+	std::unordered_map<EntityTreeKey, const EntityTreeNode*, EntityTreeKeyHash> m_NodesByKey;
+
+	// The last node in breadth-first order with each entity id.
+	std::unordered_map<uint64_t, const EntityTreeNode*> m_NodesById;
+
+	std::vector<const EntityTreeNode*> m_Nodes;
+	std::unordered_map<std::string_view, NodeList> m_NodesByType;
+	std::unordered_map<uint64_t, NodeList> m_NodesByTblu;
+
+	// Keyed by lowercase trigrams of the node names.
+	std::unordered_map<uint32_t, NodeList> m_NodesByNameTrigram;
+
+	// Positions of spatial entities at build time, bucketed into a uniform grid.
+	std::vector<std::optional<SVector3>> m_Positions;
+	std::unordered_map<uint64_t, NodeList> m_NodesByCell;
+};
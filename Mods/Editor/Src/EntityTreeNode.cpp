@@ -0,0 +1,140 @@
+#include "EntityTreeNode.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+// Roughly what a node's interned names take up on average, used to size the arena up front.
+constexpr size_t c_ExpectedNameBytesPerNode = 16;
+
+EntityTree::EntityTree(size_t p_ExpectedNodeCount) :
+	m_Arena(p_ExpectedNodeCount * c_ExpectedNameBytesPerNode + 1) {
+	m_Nodes.reserve(p_ExpectedNodeCount);
+	m_LogicalParents.reserve(p_ExpectedNodeCount);
+	m_NodesByEntity.reserve(p_ExpectedNodeCount);
+}
+
+std::string_view EntityTree::Intern(std::string_view p_String) {
+	if (p_String.empty()) {
+		return {};
+	}
+
+	if (const auto it = m_InternedStrings.find(p_String); it != m_InternedStrings.end()) {
+		return *it;
+	}
+
+	auto* s_Data = static_cast<char*>(m_Arena.allocate(p_String.size(), alignof(char)));
+	memcpy(s_Data, p_String.data(), p_String.size());
+
+	const std::string_view s_Interned(s_Data, p_String.size());
+	m_InternedStrings.insert(s_Interned);
+
+	return s_Interned;
+}
+
+std::optional<uint32_t> EntityTree::AddNode(const EntityTreeNodeInfo& p_Info) {
+	const auto s_Index = static_cast<uint32_t>(m_Nodes.size());
+
+	if (!m_NodesByEntity.try_emplace(p_Info.Entity, s_Index).second) {
+		return std::nullopt;
+	}
+
+	m_Nodes.push_back({
+		.Name = Intern(p_Info.Name),
+		.TypeName = Intern(p_Info.TypeName),
+		.EntityId = p_Info.EntityId,
+		.TBLU = p_Info.TBLU,
+		.Entity = p_Info.Entity,
+		.Parent = c_NoNode,
+	});
+
+	m_LogicalParents.push_back(p_Info.LogicalParent);
+
+	return s_Index;
+}
+
+void EntityTree::LinkNodes() {
+	// Count the children of every node first, so they can be laid out next to each other.
+	for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+		if (!m_LogicalParents[i]) {
+			continue;
+		}
+
+		const auto s_Parent = m_NodesByEntity.find(m_LogicalParents[i]);
+
+		if (s_Parent == m_NodesByEntity.end() || s_Parent->second == i) {
+			continue;
+		}
+
+		m_Nodes[i].Parent = s_Parent->second;
+		++m_Nodes[s_Parent->second].ChildCount;
+	}
+
+	uint32_t s_Offset = 0;
+
+	for (auto& s_Node : m_Nodes) {
+		s_Node.FirstChild = s_Offset;
+		s_Offset += s_Node.ChildCount;
+		s_Node.ChildCount = 0;
+	}
+
+	m_Children.resize(s_Offset);
+
+	for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+		if (m_Nodes[i].Parent == c_NoNode) {
+			continue;
+		}
+
+		auto& s_Parent = m_Nodes[m_Nodes[i].Parent];
+		m_Children[s_Parent.FirstChild + s_Parent.ChildCount++] = i;
+	}
+
+	const auto s_NameLess = [this](uint32_t p_Left, uint32_t p_Right) {
+		const auto& s_Left = m_Nodes[p_Left];
+		const auto& s_Right = m_Nodes[p_Right];
+
+		return std::tie(s_Left.Name, s_Left.TypeName, s_Left.EntityId, p_Left) <
+			std::tie(s_Right.Name, s_Right.TypeName, s_Right.EntityId, p_Right);
+	};
+
+	for (const auto& s_Node : m_Nodes) {
+		const auto s_First = m_Children.begin() + s_Node.FirstChild;
+		std::sort(s_First, s_First + s_Node.ChildCount, s_NameLess);
+	}
+
+	// Nodes that aren't reachable from the root aren't part of the tree as far as lookups are concerned.
+	std::vector<bool> s_Reachable(m_Nodes.size());
+	std::vector<uint32_t> s_NodeStack { c_Root };
+
+	s_Reachable[c_Root] = true;
+
+	while (!s_NodeStack.empty()) {
+		const auto s_Node = s_NodeStack.back();
+		s_NodeStack.pop_back();
+
+		for (const auto s_Child : GetChildren(m_Nodes[s_Node])) {
+			if (!s_Reachable[s_Child]) {
+				s_Reachable[s_Child] = true;
+				s_NodeStack.push_back(s_Child);
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+		if (!s_Reachable[i]) {
+			m_NodesByEntity.erase(m_Nodes[i].Entity);
+		}
+	}
+
+	m_LogicalParents = {};
+	m_InternedStrings = {};
+}
+
+const EntityTreeNode* EntityTree::FindNode(ZEntityRef p_Entity) const {
+	if (const auto it = m_NodesByEntity.find(p_Entity); it != m_NodesByEntity.end()) {
+		return &m_Nodes[it->second];
+	}
+
+	return nullptr;
+}
@@ -1,17 +1,102 @@
 #pragma once
 
-#include <map>
-#include <string>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include <Glacier/ZResourceID.h>
 #include <Glacier/ZEntity.h>
 
 struct EntityTreeNode {
-	std::string Name;
+	// Interned in the arena of the tree. The root has no type name.
+	std::string_view Name;
+	std::string_view TypeName;
+
 	uint64_t EntityId;
 	ZRuntimeResourceID TBLU;
 	ZEntityRef Entity;
-	std::multimap<std::string, std::shared_ptr<EntityTreeNode>> Children;
 
-	EntityTreeNode(const std::string& p_Name, uint64_t p_EntityId, ZRuntimeResourceID p_TBLU, ZEntityRef p_Ref)
-		: Name(p_Name), EntityId(p_EntityId), TBLU(p_TBLU), Entity(p_Ref) {}
-};
\ No newline at end of file
+	// Index of the parent node, or EntityTree::c_NoNode for the root and nodes whose parent isn't in the tree.
+	uint32_t Parent;
+
+	// The children are stored contiguously in the child list of the tree, sorted by name.
+	uint32_t FirstChild = 0;
+	uint32_t ChildCount = 0;
+};
+
+// What is known about an entity before it is added to the tree. The names only need to stay alive until it is added.
+struct EntityTreeNodeInfo {
+	std::string_view Name;
+	std::string_view TypeName;
+	uint64_t EntityId;
+	ZRuntimeResourceID TBLU;
+	ZEntityRef Entity;
+	ZEntityRef LogicalParent;
+};
+
+/**
+ * The entity tree of the current scene, stored as a flat array of nodes linked by index.
+ * Names are interned in an arena owned by the tree, so the whole tree is freed with a handful of deallocations.
+ * Trees are built once with AddNode and LinkNodes, and are immutable after that.
+ */
+class EntityTree {
+public:
+	static constexpr uint32_t c_NoNode = UINT32_MAX;
+
+	// The root node is always the first one added.
+	static constexpr uint32_t c_Root = 0;
+
+	explicit EntityTree(size_t p_ExpectedNodeCount);
+
+	EntityTree(const EntityTree&) = delete;
+	EntityTree& operator=(const EntityTree&) = delete;
+
+	/**
+	 * Adds a node for an entity, unless the entity already is in the tree.
+	 * @return The index of the new node, or nullopt if the entity was already added.
+	 */
+	std::optional<uint32_t> AddNode(const EntityTreeNodeInfo& p_Info);
+
+	/**
+	 * Links every node to the node of its logical parent, if that is in the tree, and sorts children by name.
+	 * Nodes whose parent isn't in the tree stay in the node array but can't be reached from the root.
+	 * Must be called once after all nodes have been added.
+	 */
+	void LinkNodes();
+
+	[[nodiscard]] const EntityTreeNode& GetRoot() const {
+		return m_Nodes[c_Root];
+	}
+
+	[[nodiscard]] const EntityTreeNode& GetNode(uint32_t p_Index) const {
+		return m_Nodes[p_Index];
+	}
+
+	[[nodiscard]] std::span<const uint32_t> GetChildren(const EntityTreeNode& p_Node) const {
+		return { m_Children.data() + p_Node.FirstChild, p_Node.ChildCount };
+	}
+
+	[[nodiscard]] size_t Size() const {
+		return m_Nodes.size();
+	}
+
+	// Finds the node of an entity. Returns nullptr for entities that aren't reachable from the root.
+	[[nodiscard]] const EntityTreeNode* FindNode(ZEntityRef p_Entity) const;
+
+private:
+	std::string_view Intern(std::string_view p_String);
+
+	std::pmr::monotonic_buffer_resource m_Arena;
+	std::vector<EntityTreeNode> m_Nodes;
+	std::vector<uint32_t> m_Children;
+	std::unordered_map<ZEntityRef, uint32_t> m_NodesByEntity;
+
+	// Only needed while building.
+	std::vector<ZEntityRef> m_LogicalParents;
+	std::unordered_set<std::string_view> m_InternedStrings;
+};
@@ -0,0 +1,176 @@
+#include "EntityTypeMetadata.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <mutex>
+#include <type_traits>
+
+#include <Glacier/ZString.h>
+
+#include <ResourceLib_HM3.h>
+
+#include "JsonHelpers.h"
+
+template <typename T>
+static void WritePrimitiveValue(JsonWriter& p_Writer, const void* p_Data) {
+	T s_Value;
+	memcpy(&s_Value, p_Data, sizeof(T));
+
+	if constexpr (std::is_same_v<T, bool>) {
+		p_Writer.Value(s_Value);
+	}
+	else if constexpr (std::is_signed_v<T>) {
+		p_Writer.Value(static_cast<int64_t>(s_Value));
+	}
+	else {
+		p_Writer.Value(static_cast<uint64_t>(s_Value));
+	}
+}
+
+static void WriteStringValue(JsonWriter& p_Writer, const void* p_Data) {
+	p_Writer.Value(*static_cast<const ZString*>(p_Data));
+}
+
+struct PrimitiveWriter {
+	std::string_view TypeName;
+	uint16_t TypeSize;
+	void (*WriteValue)(JsonWriter& p_Writer, const void* p_Data);
+};
+
+// Types that are cheap to write directly. Floats still go through ResourceLib so their formatting doesn't change.
+static constexpr PrimitiveWriter c_PrimitiveWriters[] = {
+	{ "bool", sizeof(bool), WritePrimitiveValue<bool> },
+	{ "int8", sizeof(int8_t), WritePrimitiveValue<int8_t> },
+	{ "uint8", sizeof(uint8_t), WritePrimitiveValue<uint8_t> },
+	{ "int16", sizeof(int16_t), WritePrimitiveValue<int16_t> },
+	{ "uint16", sizeof(uint16_t), WritePrimitiveValue<uint16_t> },
+	{ "int32", sizeof(int32_t), WritePrimitiveValue<int32_t> },
+	{ "uint32", sizeof(uint32_t), WritePrimitiveValue<uint32_t> },
+	{ "int64", sizeof(int64_t), WritePrimitiveValue<int64_t> },
+	{ "uint64", sizeof(uint64_t), WritePrimitiveValue<uint64_t> },
+	{ "ZString", sizeof(ZString), WriteStringValue },
+};
+
+const PropertyDescriptor* EntityTypeMetadata::FindProperty(uint32_t p_PropertyId) const {
+	for (const auto& s_Property : Properties) {
+		if (s_Property.PropertyId == p_PropertyId) {
+			return &s_Property;
+		}
+	}
+
+	return nullptr;
+}
+
+std::shared_ptr<const EntityTypeMetadata> EntityTypeMetadataCache::Get(ZEntityType* p_Type) {
+	if (!p_Type) {
+		return nullptr;
+	}
+
+	const auto s_IsCurrent = [p_Type](const EntityTypeMetadata& p_Metadata) {
+		return p_Metadata.SourceProperties == p_Type->m_pProperties01 &&
+			p_Metadata.SourcePropertyCount == (p_Type->m_pProperties01 ? p_Type->m_pProperties01->size() : 0);
+	};
+
+	{
+		std::shared_lock s_Lock(m_Mutex);
+
+		if (const auto it = m_Types.find(p_Type); it != m_Types.end() && s_IsCurrent(*it->second)) {
+			return it->second;
+		}
+	}
+
+	// Built outside the lock, since resolving names through ResourceLib is slow. If two threads race to
+	// build the same type, both results are equivalent and the last one wins.
+	auto s_Metadata = Build(p_Type);
+
+	std::unique_lock s_Lock(m_Mutex);
+	m_Types[p_Type] = s_Metadata;
+
+	return s_Metadata;
+}
+
+void EntityTypeMetadataCache::Clear() {
+	std::unique_lock s_Lock(m_Mutex);
+	m_Types.clear();
+}
+
+std::string EntityTypeMetadataCache::GetPropertyName(ZEntityProperty* p_Property) {
+	const auto* s_PropertyInfo = p_Property->m_pType->getPropertyInfo();
+
+	if (s_PropertyInfo->m_pType->typeInfo()->isResource() || s_PropertyInfo->m_nPropertyID != p_Property->m_nPropertyId) {
+		// Some properties don't have a name for some reason. Try to find using RL.
+		const auto s_PropertyName = HM3_GetPropertyName(p_Property->m_nPropertyId);
+
+		if (s_PropertyName.Size > 0) {
+			return { s_PropertyName.Data, s_PropertyName.Size };
+		}
+	}
+	else if (s_PropertyInfo->m_pName) {
+		return s_PropertyInfo->m_pName;
+	}
+
+	return std::format("~{:08x}", p_Property->m_nPropertyId);
+}
+
+std::shared_ptr<const EntityTypeMetadata> EntityTypeMetadataCache::Build(ZEntityType* p_Type) {
+	auto s_Metadata = std::make_shared<EntityTypeMetadata>();
+
+	if (p_Type->m_pInterfaces) {
+		for (auto& s_Interface : *p_Type->m_pInterfaces) {
+			if (!s_Interface.m_pTypeId) {
+				continue;
+			}
+
+			const auto* s_TypeInfo = s_Interface.m_pTypeId->typeInfo();
+
+			if (!s_TypeInfo || !s_TypeInfo->m_pTypeName) {
+				continue;
+			}
+
+			s_Metadata->Interfaces.push_back(s_TypeInfo->m_pTypeName);
+		}
+	}
+
+	s_Metadata->SourceProperties = p_Type->m_pProperties01;
+
+	if (!p_Type->m_pProperties01) {
+		return s_Metadata;
+	}
+
+	s_Metadata->SourcePropertyCount = p_Type->m_pProperties01->size();
+	s_Metadata->Properties.reserve(s_Metadata->SourcePropertyCount);
+
+	for (auto& s_Property : *p_Type->m_pProperties01) {
+		auto* s_PropertyInfo = s_Property.m_pType->getPropertyInfo();
+
+		if (!s_PropertyInfo || !s_PropertyInfo->m_pType || !s_PropertyInfo->m_pType->typeInfo()) {
+			continue;
+		}
+
+		const auto* s_TypeInfo = s_PropertyInfo->m_pType->typeInfo();
+
+		auto& s_Descriptor = s_Metadata->Properties.emplace_back();
+		s_Descriptor.Property = &s_Property;
+		s_Descriptor.Info = s_PropertyInfo;
+		s_Descriptor.PropertyId = s_Property.m_nPropertyId;
+		s_Descriptor.Name = GetPropertyName(&s_Property);
+		s_Descriptor.TypeName = s_TypeInfo->m_pTypeName;
+		s_Descriptor.TypeSize = s_TypeInfo->m_nTypeSize;
+		s_Descriptor.TypeAlignment = s_TypeInfo->m_nTypeAlignment;
+		s_Descriptor.HasGetter = s_PropertyInfo->m_nFlags & EPropertyInfoFlags::E_HAS_GETTER_SETTER;
+		s_Descriptor.IsEntity = s_TypeInfo->isEntity();
+
+		if (!s_Descriptor.TypeName) {
+			continue;
+		}
+
+		const auto s_Writer = std::ranges::find(c_PrimitiveWriters, std::string_view(s_Descriptor.TypeName), &PrimitiveWriter::TypeName);
+
+		if (s_Writer != std::end(c_PrimitiveWriters) && s_Writer->TypeSize == s_Descriptor.TypeSize) {
+			s_Descriptor.WriteValue = s_Writer->WriteValue;
+		}
+	}
+
+	return s_Metadata;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Glacier/Reflection.h>
+#include <Glacier/ZEntity.h>
+
+class JsonWriter;
+
+// Everything needed to serialize a property, resolved once per entity type.
+struct PropertyDescriptor {
+	ZEntityProperty* Property = nullptr;
+	ZClassProperty* Info = nullptr;
+	uint32_t PropertyId = 0;
+
+	// The name the game or ResourceLib knows the property by, or its id formatted as "~%08x".
+	std::string Name;
+	const char* TypeName = nullptr;
+	uint16_t TypeSize = 0;
+	uint16_t TypeAlignment = 0;
+
+	// Properties with a getter have to be copied out of the entity before they can be read.
+	bool HasGetter = false;
+	bool IsEntity = false;
+
+	// Writes the value of the property for types that don't need to go through ResourceLib. Null otherwise.
+	void (*WriteValue)(JsonWriter& p_Writer, const void* p_Data) = nullptr;
+};
+
+struct EntityTypeMetadata {
+	// Only properties with type information are included, in the order of the entity type.
+	std::vector<PropertyDescriptor> Properties;
+
+	// Type names of the interfaces, the first one being the type of the entity.
+	std::vector<const char*> Interfaces;
+
+	// What the metadata was built from, to detect a type that got freed and had its address reused.
+	TArray<ZEntityProperty>* SourceProperties = nullptr;
+	size_t SourcePropertyCount = 0;
+
+	[[nodiscard]] const PropertyDescriptor* FindProperty(uint32_t p_PropertyId) const;
+};
+
+/**
+ * Caches the property metadata of entity types, so serializing an entity doesn't have to look up
+ * type information and property names again for every property.
+ * Safe to use from the game and server threads. Metadata stays alive while it is referenced,
+ * even if the cache is cleared in the meantime.
+ */
+class EntityTypeMetadataCache {
+public:
+	[[nodiscard]] std::shared_ptr<const EntityTypeMetadata> Get(ZEntityType* p_Type);
+
+	// Forgets every entity type. Called when the scene is cleared, since its types are freed with it.
+	void Clear();
+
+	[[nodiscard]] static std::string GetPropertyName(ZEntityProperty* p_Property);
+
+private:
+	static std::shared_ptr<const EntityTypeMetadata> Build(ZEntityType* p_Type);
+
+	std::shared_mutex m_Mutex;
+	std::unordered_map<ZEntityType*, std::shared_ptr<const EntityTypeMetadata>> m_Types;
+};
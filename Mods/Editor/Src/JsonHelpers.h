@@ -1,88 +1,318 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <Glacier/ZMath.h>
 #include <Glacier/ZString.h>
 #include <simdjson.h>
 
-inline std::string write_json(int64_t p_Value)
+/**
+ * A JSON object key known at compile time, stored pre-quoted and followed by a colon
+ * so it can be appended to a JsonWriter with a single copy.
+ */
+template <size_t N>
+struct JsonKeyLiteral
 {
-	char s_NumberBuffer[24];
-	char* s_BufferEnd = simdjson::fast_itoa(s_NumberBuffer, p_Value);
-	return std::string(s_NumberBuffer, s_BufferEnd);
-}
+	consteval JsonKeyLiteral(const char (&p_Key)[N])
+	{
+		m_Data[0] = '"';
 
-inline std::string write_json(uint64_t p_Value)
-{
-	char s_NumberBuffer[24];
-	char* s_BufferEnd = simdjson::fast_itoa(s_NumberBuffer, p_Value);
-	return std::string(s_NumberBuffer, s_BufferEnd);
-}
+		for (size_t i = 0; i < N - 1; ++i)
+		{
+			// Keys are written verbatim, so they can't contain anything that would need escaping.
+			if (p_Key[i] == '"' || p_Key[i] == '\\' || static_cast<unsigned char>(p_Key[i]) < 0x20)
+			{
+				throw "JSON key literals can't contain characters that need escaping.";
+			}
 
-inline std::string write_json(int8_t p_Value)
-{
-	return write_json(static_cast<int64_t>(p_Value));
-}
+			m_Data[i + 1] = p_Key[i];
+		}
 
-inline std::string write_json(uint8_t p_Value)
-{
-	return write_json(static_cast<uint64_t>(p_Value));
-}
+		m_Data[N] = '"';
+		m_Data[N + 1] = ':';
+	}
 
-inline std::string write_json(int16_t p_Value)
-{
-	return write_json(static_cast<int64_t>(p_Value));
-}
+	constexpr std::string_view View() const
+	{
+		return { m_Data, N + 2 };
+	}
 
-inline std::string write_json(uint16_t p_Value)
-{
-	return write_json(static_cast<uint64_t>(p_Value));
-}
+	char m_Data[N + 2] {};
+};
 
-inline std::string write_json(int32_t p_Value)
+/**
+ * Append-only JSON builder writing straight into a reusable buffer.
+ * Commas between object members and array elements are inserted automatically.
+ * Clearing the writer keeps its capacity, so a long-lived writer stops allocating once warmed up.
+ */
+class JsonWriter
 {
-	return write_json(static_cast<int64_t>(p_Value));
-}
+public:
+	explicit JsonWriter(size_t p_ReserveSize = 16 * 1024)
+	{
+		m_Buffer.reserve(p_ReserveSize);
+		m_NeedsComma.reserve(32);
+	}
 
-inline std::string write_json(uint32_t p_Value)
-{
-	return write_json(static_cast<uint64_t>(p_Value));
-}
+	void Clear()
+	{
+		m_Buffer.clear();
+		m_NeedsComma.clear();
+		m_AfterKey = false;
+	}
 
-inline std::string write_json(double p_Value)
-{
-	char s_NumberBuffer[24];
-	char* s_BufferEnd = simdjson::internal::to_chars(s_NumberBuffer, nullptr, p_Value);
-	return std::string(s_NumberBuffer, s_BufferEnd);
-}
+	[[nodiscard]] std::string_view View() const
+	{
+		return m_Buffer;
+	}
 
-inline std::string write_json(float p_Value)
-{
-	return write_json(static_cast<double>(p_Value));
-}
+	[[nodiscard]] size_t Size() const
+	{
+		return m_Buffer.size();
+	}
 
-inline std::string write_json(std::string_view p_Value)
-{
-	simdjson::internal::mini_formatter s_Formatter;
-	s_Formatter.string(p_Value);
-	return std::string(s_Formatter.str());
-}
+	JsonWriter& BeginObject()
+	{
+		BeginValue();
+		m_Buffer.push_back('{');
+		m_NeedsComma.push_back(false);
+		return *this;
+	}
 
-inline std::string write_json(const char* p_Value)
-{
-	return write_json(std::string_view(p_Value));
-}
+	JsonWriter& EndObject()
+	{
+		m_Buffer.push_back('}');
+		m_NeedsComma.pop_back();
+		return *this;
+	}
 
-inline std::string write_json(const std::string& p_Value)
-{
-	return write_json(std::string_view(p_Value));
-}
+	JsonWriter& BeginArray()
+	{
+		BeginValue();
+		m_Buffer.push_back('[');
+		m_NeedsComma.push_back(false);
+		return *this;
+	}
 
-inline std::string write_json(const ZString& p_Value)
-{
-	return write_json(std::string_view(p_Value));
-}
+	JsonWriter& EndArray()
+	{
+		m_Buffer.push_back(']');
+		m_NeedsComma.pop_back();
+		return *this;
+	}
 
-inline std::string write_json(bool p_Value)
-{
-	return p_Value ? "true" : "false";
-}
+	template <JsonKeyLiteral t_Key>
+	JsonWriter& Key()
+	{
+		BeginValue();
+		m_Buffer.append(t_Key.View());
+		m_AfterKey = true;
+		return *this;
+	}
+
+	JsonWriter& Key(std::string_view p_Key)
+	{
+		BeginValue();
+		AppendEscaped(p_Key);
+		m_Buffer.push_back(':');
+		m_AfterKey = true;
+		return *this;
+	}
+
+	JsonWriter& Value(int64_t p_Value)
+	{
+		BeginValue();
+		char s_NumberBuffer[24];
+		char* s_BufferEnd = simdjson::fast_itoa(s_NumberBuffer, p_Value);
+		m_Buffer.append(s_NumberBuffer, s_BufferEnd);
+		return *this;
+	}
+
+	JsonWriter& Value(uint64_t p_Value)
+	{
+		BeginValue();
+		char s_NumberBuffer[24];
+		char* s_BufferEnd = simdjson::fast_itoa(s_NumberBuffer, p_Value);
+		m_Buffer.append(s_NumberBuffer, s_BufferEnd);
+		return *this;
+	}
+
+	JsonWriter& Value(int32_t p_Value)
+	{
+		return Value(static_cast<int64_t>(p_Value));
+	}
+
+	JsonWriter& Value(uint32_t p_Value)
+	{
+		return Value(static_cast<uint64_t>(p_Value));
+	}
+
+	JsonWriter& Value(double p_Value)
+	{
+		BeginValue();
+		char s_NumberBuffer[32];
+		char* s_BufferEnd = simdjson::internal::to_chars(s_NumberBuffer, nullptr, p_Value);
+		m_Buffer.append(s_NumberBuffer, s_BufferEnd);
+		return *this;
+	}
+
+	JsonWriter& Value(float p_Value)
+	{
+		return Value(static_cast<double>(p_Value));
+	}
+
+	JsonWriter& Value(bool p_Value)
+	{
+		BeginValue();
+		m_Buffer.append(p_Value ? "true" : "false");
+		return *this;
+	}
+
+	JsonWriter& Value(std::string_view p_Value)
+	{
+		BeginValue();
+		AppendEscaped(p_Value);
+		return *this;
+	}
+
+	JsonWriter& Value(const char* p_Value)
+	{
+		return Value(std::string_view(p_Value));
+	}
+
+	JsonWriter& Value(const std::string& p_Value)
+	{
+		return Value(std::string_view(p_Value));
+	}
+
+	JsonWriter& Value(const ZString& p_Value)
+	{
+		return Value(std::string_view(p_Value.c_str(), p_Value.size()));
+	}
+
+	JsonWriter& Null()
+	{
+		BeginValue();
+		m_Buffer.append("null");
+		return *this;
+	}
+
+	/**
+	 * Writes a 64-bit id as a quoted, zero-padded 16 digit hex string.
+	 */
+	JsonWriter& HexValue(uint64_t p_Value, bool p_Uppercase = false)
+	{
+		BeginValue();
+
+		const char* s_Digits = p_Uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+		char s_HexBuffer[18];
+
+		s_HexBuffer[0] = '"';
+
+		for (int i = 0; i < 16; ++i)
+		{
+			s_HexBuffer[16 - i] = s_Digits[(p_Value >> (i * 4)) & 0xF];
+		}
+
+		s_HexBuffer[17] = '"';
+
+		m_Buffer.append(s_HexBuffer, sizeof(s_HexBuffer));
+		return *this;
+	}
+
+	/**
+	 * Writes an already serialized JSON value verbatim.
+	 */
+	JsonWriter& RawValue(std::string_view p_Json)
+	{
+		BeginValue();
+		m_Buffer.append(p_Json);
+		return *this;
+	}
+
+private:
+	void BeginValue()
+	{
+		if (m_AfterKey)
+		{
+			m_AfterKey = false;
+			return;
+		}
+
+		if (m_NeedsComma.empty())
+		{
+			return;
+		}
+
+		if (m_NeedsComma.back())
+		{
+			m_Buffer.push_back(',');
+		}
+
+		m_NeedsComma.back() = true;
+	}
+
+	void AppendEscaped(std::string_view p_Value)
+	{
+		static constexpr std::array<bool, 256> c_NeedsEscaping = []
+		{
+			std::array<bool, 256> s_Table {};
+
+			for (size_t i = 0; i < 0x20; ++i)
+			{
+				s_Table[i] = true;
+			}
+
+			s_Table['"'] = true;
+			s_Table['\\'] = true;
+
+			return s_Table;
+		}();
+
+		m_Buffer.push_back('"');
+
+		size_t s_RunStart = 0;
+
+		for (size_t i = 0; i < p_Value.size(); ++i)
+		{
+			const auto s_Char = static_cast<unsigned char>(p_Value[i]);
+
+			if (!c_NeedsEscaping[s_Char])
+			{
+				continue;
+			}
+
+			m_Buffer.append(p_Value.data() + s_RunStart, i - s_RunStart);
+			s_RunStart = i + 1;
+
+			switch (s_Char)
+			{
+				case '"': m_Buffer.append("\\\""); break;
+				case '\\': m_Buffer.append("\\\\"); break;
+				case '\b': m_Buffer.append("\\b"); break;
+				case '\f': m_Buffer.append("\\f"); break;
+				case '\n': m_Buffer.append("\\n"); break;
+				case '\r': m_Buffer.append("\\r"); break;
+				case '\t': m_Buffer.append("\\t"); break;
+				default:
+				{
+					const char* s_Digits = "0123456789abcdef";
+					const char s_Escape[6] = { '\\', 'u', '0', '0', s_Digits[s_Char >> 4], s_Digits[s_Char & 0xF] };
+					m_Buffer.append(s_Escape, sizeof(s_Escape));
+					break;
+				}
+			}
+		}
+
+		m_Buffer.append(p_Value.data() + s_RunStart, p_Value.size() - s_RunStart);
+		m_Buffer.push_back('"');
+	}
+
+	std::string m_Buffer;
+	std::vector<bool> m_NeedsComma;
+	bool m_AfterKey = false;
+};
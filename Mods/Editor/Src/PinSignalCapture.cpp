@@ -0,0 +1,146 @@
+#include "PinSignalCapture.h"
+
+#include <algorithm>
+
+#include <intrin.h>
+
+static std::atomic<uint64_t> s_NextCaptureId = 1;
+
+PinSignalCapture::PinSignalCapture() :
+	m_Id(s_NextCaptureId.fetch_add(1, std::memory_order_relaxed)),
+	m_StartTimestamp(Now()),
+	m_StartTime(std::chrono::steady_clock::now()) {
+}
+
+void PinSignalCapture::Record(ZEntityRef p_Entity, uint32_t p_PinId, EPinDirection p_Direction, STypeID* p_PayloadType) {
+	auto* s_Ring = GetThreadRing();
+
+	// Announces the epoch before loading the filter, so SetFilter knows this thread may be testing any filter
+	// that was current at that epoch or later. Both are sequentially consistent so they are ordered with
+	// SetFilter replacing the filter and reading the epochs back.
+	s_Ring->FilterEpoch.store(m_FilterEpoch.load());
+	const auto* s_Filter = m_Filter.load();
+	const bool s_Matches = !s_Filter || s_Filter->Matches(p_Entity, p_PinId);
+	s_Ring->FilterEpoch.store(0, std::memory_order_release);
+
+	if (!s_Matches) {
+		return;
+	}
+
+	// Only this thread moves the head, so it can be read relaxed.
+	const uint32_t s_Head = s_Ring->Head.load(std::memory_order_relaxed);
+
+	if (s_Head - s_Ring->Tail.load(std::memory_order_acquire) == c_RingSize) {
+		s_Ring->Dropped.store(s_Ring->Dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		return;
+	}
+
+	s_Ring->Signals[s_Head % c_RingSize] = PinSignal {
+		.Entity = p_Entity,
+		.PayloadType = p_PayloadType,
+		.Timestamp = Now(),
+		.PinId = p_PinId,
+		.Direction = p_Direction,
+	};
+
+	s_Ring->Head.store(s_Head + 1, std::memory_order_release);
+}
+
+uint64_t PinSignalCapture::Drain(std::vector<PinSignal>& p_Signals) {
+	uint64_t s_Dropped = 0;
+
+	std::scoped_lock s_Lock(m_RingsMutex);
+
+	for (const auto& s_Ring : m_Rings) {
+		const uint32_t s_Head = s_Ring->Head.load(std::memory_order_acquire);
+		const uint32_t s_Tail = s_Ring->Tail.load(std::memory_order_relaxed);
+
+		for (uint32_t i = s_Tail; i != s_Head; ++i) {
+			p_Signals.push_back(s_Ring->Signals[i % c_RingSize]);
+		}
+
+		// Hands the slots back to the producer once they've been copied.
+		s_Ring->Tail.store(s_Head, std::memory_order_release);
+
+		const uint64_t s_RingDropped = s_Ring->Dropped.load(std::memory_order_relaxed);
+		s_Dropped += s_RingDropped - s_Ring->DrainedDropped;
+		s_Ring->DrainedDropped = s_RingDropped;
+	}
+
+	// Filters are usually replaced while signals are being tested, so retry destroying them here.
+	DestroyRetiredFilters();
+
+	return s_Dropped;
+}
+
+void PinSignalCapture::SetFilter(std::unique_ptr<const PinSignalFilter> p_Filter) {
+	std::scoped_lock s_Lock(m_RingsMutex);
+
+	m_Filter.store(p_Filter.get());
+
+	// Producers that announce the new epoch load the filter after it was replaced, so they can't see the previous one.
+	const uint64_t s_Epoch = m_FilterEpoch.fetch_add(1);
+
+	if (m_OwnedFilter) {
+		m_RetiredFilters.push_back({ s_Epoch, std::move(m_OwnedFilter) });
+	}
+
+	m_OwnedFilter = std::move(p_Filter);
+
+	DestroyRetiredFilters();
+}
+
+uint64_t PinSignalCapture::Now() {
+	return __rdtsc();
+}
+
+double PinSignalCapture::GetTicksPerSecond() const {
+	const std::chrono::duration<double> s_Elapsed = std::chrono::steady_clock::now() - m_StartTime;
+	const uint64_t s_Ticks = Now() - m_StartTimestamp;
+
+	if (s_Elapsed.count() <= 0.0 || s_Ticks == 0) {
+		return 1.0;
+	}
+
+	return static_cast<double>(s_Ticks) / s_Elapsed.count();
+}
+
+void PinSignalCapture::DestroyRetiredFilters() {
+	if (m_RetiredFilters.empty()) {
+		return;
+	}
+
+	uint64_t s_OldestEpoch = UINT64_MAX;
+
+	for (const auto& s_Ring : m_Rings) {
+		if (const uint64_t s_Epoch = s_Ring->FilterEpoch.load(); s_Epoch != 0) {
+			s_OldestEpoch = (std::min)(s_OldestEpoch, s_Epoch);
+		}
+	}
+
+	// A filter retired at an epoch can only be in use by producers that announced that epoch or an earlier one.
+	std::erase_if(m_RetiredFilters, [&](const RetiredFilter& p_Filter) {
+		return p_Filter.Epoch < s_OldestEpoch;
+	});
+}
+
+PinSignalCapture::Ring* PinSignalCapture::GetThreadRing() {
+	struct ThreadRing {
+		uint64_t CaptureId = 0;
+		Ring* Buffer = nullptr;
+	};
+
+	thread_local ThreadRing s_ThreadRing;
+
+	if (s_ThreadRing.CaptureId == m_Id) {
+		return s_ThreadRing.Buffer;
+	}
+
+	// First signal from this thread. Rings are kept until the capture is destroyed, even if their thread exits.
+	std::scoped_lock s_Lock(m_RingsMutex);
+
+	s_ThreadRing.CaptureId = m_Id;
+	s_ThreadRing.Buffer = m_Rings.emplace_back(std::make_unique<Ring>()).get();
+
+	return s_ThreadRing.Buffer;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Glacier/ZEntity.h>
+
+#include "PinSignalFilter.h"
+
+class STypeID;
+
+enum class EPinDirection : uint8_t {
+	Input,
+	Output,
+};
+
+// A pin that was signalled, as recorded by the pin detours.
+struct PinSignal {
+	ZEntityRef Entity;
+	STypeID* PayloadType = nullptr;
+
+	// Time stamp counter of the CPU at the time of the signal. Convert with PinSignalCapture::GetTicksPerSecond.
+	uint64_t Timestamp = 0;
+
+	uint32_t PinId = 0;
+	EPinDirection Direction = EPinDirection::Input;
+};
+
+/**
+ * Records pin signals from the pin detours, which run on any engine thread, for the UI thread to read.
+ * Every signalling thread gets its own single-producer single-consumer ring buffer, so recording a signal
+ * takes no locks and doesn't allocate. When a ring is full because it isn't drained fast enough,
+ * new signals are dropped and counted.
+ * Signals can be filtered, in which case only the ones matching the filter are recorded.
+ */
+class PinSignalCapture {
+public:
+	PinSignalCapture();
+
+	PinSignalCapture(const PinSignalCapture&) = delete;
+	PinSignalCapture& operator=(const PinSignalCapture&) = delete;
+
+	// Called from the pin detours.
+	void Record(ZEntityRef p_Entity, uint32_t p_PinId, EPinDirection p_Direction, STypeID* p_PayloadType);
+
+	/**
+	 * Replaces the filter that signals are tested against. Pass null to record every signal.
+	 * The previous filter is destroyed once no pin detour can still be testing it.
+	 */
+	void SetFilter(std::unique_ptr<const PinSignalFilter> p_Filter);
+
+	/**
+	 * Moves the signals recorded since the last call to the end of the given vector.
+	 * Signals are in order per thread, but not across threads. Must only be called from one thread at a time.
+	 * @return The number of signals that were dropped since the last call.
+	 */
+	uint64_t Drain(std::vector<PinSignal>& p_Signals);
+
+	[[nodiscard]] static uint64_t Now();
+
+	// Estimated from how far the time stamp counter advanced since the capture was created.
+	[[nodiscard]] double GetTicksPerSecond() const;
+
+private:
+	// Fits in 128 KiB per thread. Drained every frame, so it only fills up on threads that signal
+	// more than this many pins in a frame.
+	static constexpr uint32_t c_RingSize = 4096;
+
+	struct Ring {
+		std::array<PinSignal, c_RingSize> Signals;
+
+		// Written by the producer and consumer respectively, on separate cache lines so they don't contend.
+		alignas(64) std::atomic<uint32_t> Head = 0;
+		std::atomic<uint64_t> Dropped = 0;
+
+		// The filter epoch the producer saw before it loaded the filter, while it is testing a signal, or 0.
+		std::atomic<uint64_t> FilterEpoch = 0;
+		alignas(64) std::atomic<uint32_t> Tail = 0;
+		uint64_t DrainedDropped = 0;
+	};
+
+	// A filter that was replaced while it was at the given epoch.
+	struct RetiredFilter {
+		uint64_t Epoch;
+		std::unique_ptr<const PinSignalFilter> Filter;
+	};
+
+	Ring* GetThreadRing();
+
+	// Destroys the retired filters that no producer can still be using. Must be called with the rings locked.
+	void DestroyRetiredFilters();
+
+	// Identifies this capture in the cached ring of each thread, since captures can be destroyed and
+	// recreated while the threads that signalled pins live on.
+	const uint64_t m_Id;
+
+	std::mutex m_RingsMutex;
+	std::vector<std::unique_ptr<Ring>> m_Rings;
+
+	// Read by the producers without locking. The filter is owned by m_OwnedFilter, and is only replaced
+	// with the rings locked. Replacing it advances the epoch.
+	std::atomic<const PinSignalFilter*> m_Filter = nullptr;
+	std::atomic<uint64_t> m_FilterEpoch = 1;
+	std::unique_ptr<const PinSignalFilter> m_OwnedFilter;
+	std::vector<RetiredFilter> m_RetiredFilters;
+
+	const uint64_t m_StartTimestamp;
+	const std::chrono::steady_clock::time_point m_StartTime;
+};
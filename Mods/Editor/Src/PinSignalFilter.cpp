@@ -0,0 +1,29 @@
+#include "PinSignalFilter.h"
+
+#include <vector>
+
+void PinSignalFilter::AddPin(uint32_t p_PinId) {
+	m_FilterPins = true;
+	m_PinBits.set(p_PinId % c_PinBits);
+	m_Pins.insert(p_PinId);
+}
+
+void PinSignalFilter::AddEntity(ZEntityRef p_Entity) {
+	m_FilterEntities = true;
+	m_Entities.insert(p_Entity.m_pEntity);
+}
+
+void PinSignalFilter::AddSubtree(const EntityTree& p_Tree, const EntityTreeNode& p_Node) {
+	std::vector<const EntityTreeNode*> s_Nodes { &p_Node };
+
+	while (!s_Nodes.empty()) {
+		const auto s_Node = s_Nodes.back();
+		s_Nodes.pop_back();
+
+		AddEntity(s_Node->Entity);
+
+		for (const auto s_Child : p_Tree.GetChildren(*s_Node)) {
+			s_Nodes.push_back(&p_Tree.GetNode(s_Child));
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <unordered_set>
+
+#include <Glacier/ZEntity.h>
+
+#include "EntityTreeNode.h"
+
+/**
+ * Decides which pin signals a PinSignalCapture records, so tracing costs as much as what is being watched
+ * rather than as much as all pin traffic. Filters are built on one thread and are immutable once they are
+ * published, so the pin detours can test them on any thread without locking.
+ */
+class PinSignalFilter {
+public:
+	// Once a pin is added, only signals of added pins match.
+	void AddPin(uint32_t p_PinId);
+
+	// Once an entity is added, only signals of added entities match.
+	void AddEntity(ZEntityRef p_Entity);
+
+	// Adds the entity of a node and of every node below it. The subtree is flattened into the entity set,
+	// so testing membership doesn't walk the tree, which may have been replaced since.
+	void AddSubtree(const EntityTree& p_Tree, const EntityTreeNode& p_Node);
+
+	[[nodiscard]] bool Matches(ZEntityRef p_Entity, uint32_t p_PinId) const {
+		if (m_FilterPins) {
+			// Pin ids are CRC32s, so their low bits make a good enough hash for a single-hash bloom filter.
+			// Most pins are rejected by it without touching the set.
+			if (!m_PinBits.test(p_PinId % c_PinBits) || !m_Pins.contains(p_PinId)) {
+				return false;
+			}
+		}
+
+		return !m_FilterEntities || m_Entities.contains(p_Entity.m_pEntity);
+	}
+
+private:
+	// 512 bytes, so the bloom filter stays in the cache of threads that signal many pins.
+	static constexpr size_t c_PinBits = 4096;
+
+	bool m_FilterPins = false;
+	std::bitset<c_PinBits> m_PinBits;
+	std::unordered_set<uint32_t> m_Pins;
+
+	bool m_FilterEntities = false;
+	std::unordered_set<ZEntityType**> m_Entities;
+};
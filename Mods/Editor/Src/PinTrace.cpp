@@ -0,0 +1,276 @@
+#include "PinTrace.h"
+
+#include <cstring>
+#include <stdexcept>
+
+// Doesn't use <format>, so the trace tools also build with standard libraries that lack it.
+namespace PinTrace {
+	constexpr char c_Magic[4] = { 'Z', 'E', 'P', 'T' };
+
+	// The writer buffers this much before handing it to the file, even if it isn't flushed.
+	constexpr size_t c_WriteBufferSize = 256 * 1024;
+
+	// Bounds what a corrupt length can make the reader allocate.
+	constexpr uint64_t c_MaxStringSize = 1024 * 1024;
+
+	// Thrown by the reader when the file ends in the middle of a record.
+	struct TruncatedTrace {};
+
+	static uint64_t ZigZagEncode(int64_t p_Value) {
+		return (static_cast<uint64_t>(p_Value) << 1) ^ static_cast<uint64_t>(p_Value >> 63);
+	}
+
+	static int64_t ZigZagDecode(uint64_t p_Value) {
+		return static_cast<int64_t>(p_Value >> 1) ^ -static_cast<int64_t>(p_Value & 1);
+	}
+
+	Writer::Writer(const std::filesystem::path& p_Path, uint64_t p_StartTime) :
+		m_Stream(p_Path, std::ios::binary | std::ios::trunc) {
+		if (!m_Stream) {
+			throw std::runtime_error("Could not open '" + p_Path.string() + "' for writing.");
+		}
+
+		m_Buffer.reserve(c_WriteBufferSize);
+		m_Buffer.append(c_Magic, sizeof(c_Magic));
+		WriteU32(c_Version);
+		WriteU64(p_StartTime);
+	}
+
+	uint32_t Writer::WriteEntity(const EntityInfo& p_Entity) {
+		WriteU8(static_cast<uint8_t>(ERecordKind::Entity));
+		WriteU64(p_Entity.Id);
+		WriteU64(p_Entity.Tblu);
+		WriteString(p_Entity.Name);
+		WriteString(p_Entity.Type);
+
+		return m_EntityCount++;
+	}
+
+	uint32_t Writer::WritePin(const PinInfo& p_Pin) {
+		WriteU8(static_cast<uint8_t>(ERecordKind::Pin));
+		WriteU32(static_cast<uint32_t>(p_Pin.Id));
+		WriteString(p_Pin.Name);
+
+		return m_PinCount++;
+	}
+
+	uint32_t Writer::WritePayloadType(std::string_view p_Name) {
+		WriteU8(static_cast<uint8_t>(ERecordKind::PayloadType));
+		WriteString(p_Name);
+
+		return m_PayloadTypeCount++;
+	}
+
+	void Writer::WriteSignal(const Signal& p_Signal) {
+		if (p_Signal.Entity >= m_EntityCount || p_Signal.Pin >= m_PinCount || p_Signal.PayloadType >= m_PayloadTypeCount) {
+			throw std::runtime_error("Signals can only refer to entities, pins and payload types that were written before them.");
+		}
+
+		WriteU8(static_cast<uint8_t>(ERecordKind::Signal));
+		WriteVarint(ZigZagEncode(static_cast<int64_t>(p_Signal.Time - m_LastTime)));
+		WriteVarint(p_Signal.Entity);
+		WriteVarint(static_cast<uint64_t>(p_Signal.Pin) << 1 | (p_Signal.Output ? 1 : 0));
+		WriteVarint(p_Signal.PayloadType);
+
+		m_LastTime = p_Signal.Time;
+		++m_SignalCount;
+
+		if (m_Buffer.size() >= c_WriteBufferSize) {
+			WriteBuffer();
+		}
+	}
+
+	void Writer::Flush() {
+		WriteBuffer();
+		m_Stream.flush();
+
+		if (!m_Stream) {
+			throw std::runtime_error("Could not write the pin trace.");
+		}
+	}
+
+	uint64_t Writer::Finish() {
+		Flush();
+		m_Stream.close();
+
+		if (m_Stream.fail()) {
+			throw std::runtime_error("Could not finish writing the pin trace.");
+		}
+
+		return m_WrittenBytes;
+	}
+
+	void Writer::WriteBuffer() {
+		m_Stream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+
+		if (!m_Stream) {
+			throw std::runtime_error("Could not write the pin trace.");
+		}
+
+		m_WrittenBytes += m_Buffer.size();
+		m_Buffer.clear();
+	}
+
+	void Writer::WriteU8(uint8_t p_Value) {
+		m_Buffer.push_back(static_cast<char>(p_Value));
+	}
+
+	void Writer::WriteU32(uint32_t p_Value) {
+		m_Buffer.append(reinterpret_cast<const char*>(&p_Value), sizeof(p_Value));
+	}
+
+	void Writer::WriteU64(uint64_t p_Value) {
+		m_Buffer.append(reinterpret_cast<const char*>(&p_Value), sizeof(p_Value));
+	}
+
+	void Writer::WriteVarint(uint64_t p_Value) {
+		while (p_Value >= 0x80) {
+			m_Buffer.push_back(static_cast<char>((p_Value & 0x7F) | 0x80));
+			p_Value >>= 7;
+		}
+
+		m_Buffer.push_back(static_cast<char>(p_Value));
+	}
+
+	void Writer::WriteString(std::string_view p_Value) {
+		WriteVarint(p_Value.size());
+		m_Buffer.append(p_Value);
+	}
+
+	Reader::Reader(const std::filesystem::path& p_Path) :
+		m_Stream(p_Path, std::ios::binary) {
+		if (!m_Stream) {
+			throw std::runtime_error("Could not open '" + p_Path.string() + "' for reading.");
+		}
+
+		try {
+			char s_Magic[sizeof(c_Magic)];
+			ReadRaw(s_Magic, sizeof(s_Magic));
+
+			if (memcmp(s_Magic, c_Magic, sizeof(c_Magic)) != 0) {
+				throw std::runtime_error("'" + p_Path.string() + "' is not a pin trace.");
+			}
+
+			if (const auto s_Version = ReadU32(); s_Version != c_Version) {
+				throw std::runtime_error("'" + p_Path.string() + "' is a version " + std::to_string(s_Version) +
+					" pin trace, but only version " + std::to_string(c_Version) + " is supported.");
+			}
+
+			m_StartTime = ReadU64();
+		}
+		catch (const TruncatedTrace&) {
+			throw std::runtime_error("'" + p_Path.string() + "' is not a pin trace.");
+		}
+	}
+
+	bool Reader::ReadSignal(Signal& p_Signal) {
+		try {
+			while (m_Stream.peek() != std::char_traits<char>::eof()) {
+				if (ReadRecord(p_Signal)) {
+					return true;
+				}
+			}
+		}
+		catch (const TruncatedTrace&) {
+			m_Truncated = true;
+		}
+
+		return false;
+	}
+
+	bool Reader::ReadRecord(Signal& p_Signal) {
+		switch (const auto s_Kind = static_cast<ERecordKind>(ReadU8())) {
+			case ERecordKind::Entity: {
+				EntityInfo s_Entity;
+				s_Entity.Id = ReadU64();
+				s_Entity.Tblu = ReadU64();
+				ReadString(s_Entity.Name);
+				ReadString(s_Entity.Type);
+				m_Entities.push_back(std::move(s_Entity));
+				return false;
+			}
+			case ERecordKind::Pin: {
+				PinInfo s_Pin;
+				s_Pin.Id = static_cast<int32_t>(ReadU32());
+				ReadString(s_Pin.Name);
+				m_Pins.push_back(std::move(s_Pin));
+				return false;
+			}
+			case ERecordKind::PayloadType: {
+				ReadString(m_PayloadTypes.emplace_back());
+				return false;
+			}
+			case ERecordKind::Signal: {
+				const int64_t s_TimeDelta = ZigZagDecode(ReadVarint());
+				const uint64_t s_Entity = ReadVarint();
+				const uint64_t s_Pin = ReadVarint();
+				const uint64_t s_PayloadType = ReadVarint();
+
+				if (s_Entity >= m_Entities.size() || (s_Pin >> 1) >= m_Pins.size() || s_PayloadType >= m_PayloadTypes.size()) {
+					throw std::runtime_error("A signal refers to an entity, pin or payload type that wasn't defined before it.");
+				}
+
+				m_LastTime += static_cast<uint64_t>(s_TimeDelta);
+
+				p_Signal.Time = m_LastTime;
+				p_Signal.Entity = static_cast<uint32_t>(s_Entity);
+				p_Signal.Pin = static_cast<uint32_t>(s_Pin >> 1);
+				p_Signal.Output = s_Pin & 1;
+				p_Signal.PayloadType = static_cast<uint32_t>(s_PayloadType);
+				return true;
+			}
+			default:
+				throw std::runtime_error("Unknown record kind " + std::to_string(static_cast<int>(s_Kind)) + ".");
+		}
+	}
+
+	void Reader::ReadRaw(void* p_Data, size_t p_Size) {
+		if (!m_Stream.read(static_cast<char*>(p_Data), static_cast<std::streamsize>(p_Size))) {
+			throw TruncatedTrace {};
+		}
+	}
+
+	uint8_t Reader::ReadU8() {
+		uint8_t s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	uint32_t Reader::ReadU32() {
+		uint32_t s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	uint64_t Reader::ReadU64() {
+		uint64_t s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	uint64_t Reader::ReadVarint() {
+		uint64_t s_Value = 0;
+
+		for (int s_Shift = 0; s_Shift < 64; s_Shift += 7) {
+			const uint8_t s_Byte = ReadU8();
+			s_Value |= static_cast<uint64_t>(s_Byte & 0x7F) << s_Shift;
+
+			if (!(s_Byte & 0x80)) {
+				return s_Value;
+			}
+		}
+
+		throw std::runtime_error("Varint is longer than 64 bits.");
+	}
+
+	void Reader::ReadString(std::string& p_Value) {
+		const uint64_t s_Size = ReadVarint();
+
+		if (s_Size > c_MaxStringSize) {
+			throw std::runtime_error("A string of " + std::to_string(s_Size) + " bytes is longer than a pin trace can hold.");
+		}
+
+		p_Value.resize(s_Size);
+		ReadRaw(p_Value.data(), p_Value.size());
+	}
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Recording of pin signals, used to analyze minutes of pin traffic offline.
+ * Traces are written and read as streams, and can be read up to the last complete record
+ * if the game stops before the recording is finished.
+ * Only depends on the standard library, so tools reading traces can be built on any platform.
+ *
+ * All values are little-endian.
+ *   file:    char magic[4] = "ZEPT", u32 version, u64 startTime (unix time in milliseconds), record...
+ *   string:  varint length, followed by UTF-8 bytes
+ *   record:  u8 kind, followed by one of
+ *     entity:  u64 id, u64 tblu, string name, string type
+ *     pin:     i32 id, string name (empty when unknown)
+ *     type:    string name
+ *     signal:  zigzag varint time delta, varint entity index, varint (pin index << 1 | output), varint type index
+ *
+ * Entities, pins and payload types are written once, before the first signal that refers to them,
+ * and are referred to by the order they were written in after that. Signal times are in nanoseconds since
+ * the start of the recording, stored as the difference to the previous signal. Signals from different threads
+ * can be slightly out of order, so the difference can be negative.
+ */
+namespace PinTrace {
+	constexpr uint32_t c_Version = 1;
+
+	enum class ERecordKind : uint8_t {
+		Entity,
+		Pin,
+		PayloadType,
+		Signal,
+	};
+
+	struct EntityInfo {
+		uint64_t Id = 0;
+		uint64_t Tblu = 0;
+		std::string Name;
+		std::string Type;
+	};
+
+	struct PinInfo {
+		int32_t Id = 0;
+		std::string Name;
+	};
+
+	struct Signal {
+		// Nanoseconds since the start of the recording.
+		uint64_t Time = 0;
+
+		// Indexes into the entities, pins and payload types written so far.
+		uint32_t Entity = 0;
+		uint32_t Pin = 0;
+		uint32_t PayloadType = 0;
+		bool Output = false;
+	};
+
+	/**
+	 * Streams a trace to a file. Throws std::runtime_error if the file can't be written,
+	 * or if a signal refers to something that wasn't written before it.
+	 */
+	class Writer {
+	public:
+		Writer(const std::filesystem::path& p_Path, uint64_t p_StartTime);
+
+		// Each of these returns the index that signals refer to the written value by.
+		uint32_t WriteEntity(const EntityInfo& p_Entity);
+		uint32_t WritePin(const PinInfo& p_Pin);
+		uint32_t WritePayloadType(std::string_view p_Name);
+
+		void WriteSignal(const Signal& p_Signal);
+
+		// Hands everything written so far to the file, so it survives the game stopping.
+		void Flush();
+
+		/**
+		 * Flushes and closes the file. Nothing can be written after this.
+		 * @return The size of the file in bytes.
+		 */
+		uint64_t Finish();
+
+		[[nodiscard]] uint64_t GetSignalCount() const {
+			return m_SignalCount;
+		}
+
+		// The number of bytes handed to the file so far.
+		[[nodiscard]] uint64_t GetWrittenBytes() const {
+			return m_WrittenBytes;
+		}
+
+	private:
+		void WriteBuffer();
+		void WriteU8(uint8_t p_Value);
+		void WriteU32(uint32_t p_Value);
+		void WriteU64(uint64_t p_Value);
+		void WriteVarint(uint64_t p_Value);
+		void WriteString(std::string_view p_Value);
+
+		std::ofstream m_Stream;
+		std::string m_Buffer;
+		uint32_t m_EntityCount = 0;
+		uint32_t m_PinCount = 0;
+		uint32_t m_PayloadTypeCount = 0;
+		uint64_t m_SignalCount = 0;
+		uint64_t m_LastTime = 0;
+		uint64_t m_WrittenBytes = 0;
+	};
+
+	/**
+	 * Reads a trace from a file. Throws std::runtime_error if the file can't be read or is malformed.
+	 */
+	class Reader {
+	public:
+		explicit Reader(const std::filesystem::path& p_Path);
+
+		/**
+		 * Reads the next signal, along with the entities, pins and payload types written before it.
+		 * @return false once every signal has been read, or if the trace ends in the middle of a record,
+		 * which happens when the game stopped while recording. IsTruncated tells the two apart.
+		 */
+		bool ReadSignal(Signal& p_Signal);
+
+		[[nodiscard]] uint64_t GetStartTime() const {
+			return m_StartTime;
+		}
+
+		[[nodiscard]] bool IsTruncated() const {
+			return m_Truncated;
+		}
+
+		[[nodiscard]] const std::vector<EntityInfo>& GetEntities() const {
+			return m_Entities;
+		}
+
+		[[nodiscard]] const std::vector<PinInfo>& GetPins() const {
+			return m_Pins;
+		}
+
+		[[nodiscard]] const std::vector<std::string>& GetPayloadTypes() const {
+			return m_PayloadTypes;
+		}
+
+	private:
+		bool ReadRecord(Signal& p_Signal);
+		void ReadRaw(void* p_Data, size_t p_Size);
+		uint8_t ReadU8();
+		uint32_t ReadU32();
+		uint64_t ReadU64();
+		uint64_t ReadVarint();
+		void ReadString(std::string& p_Value);
+
+		std::ifstream m_Stream;
+		uint64_t m_StartTime = 0;
+		uint64_t m_LastTime = 0;
+		bool m_Truncated = false;
+		std::vector<EntityInfo> m_Entities;
+		std::vector<PinInfo> m_Pins;
+		std::vector<std::string> m_PayloadTypes;
+	};
+}
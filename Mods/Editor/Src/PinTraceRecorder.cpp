@@ -0,0 +1,211 @@
+#include "PinTraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <Glacier/Reflection.h>
+
+#include "IModSDK.h"
+#include "Logging.h"
+
+// Everything recorded is handed to the file at least this often, so a trace survives the game stopping.
+constexpr auto c_FlushInterval = std::chrono::seconds(1);
+
+PinTraceRecorder::~PinTraceRecorder() {
+	Stop();
+}
+
+void PinTraceRecorder::Start(const std::filesystem::path& p_Path, double p_TicksPerSecond) {
+	Stop();
+
+	const auto s_StartTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()
+	);
+
+	PinTrace::Writer s_Writer(p_Path, static_cast<uint64_t>(s_StartTime.count()));
+
+	m_StartTimestamp = PinSignalCapture::Now();
+	m_TicksPerSecond = p_TicksPerSecond;
+	m_EntityIndices.clear();
+	m_PinIndices.clear();
+	m_PayloadTypeIndices.clear();
+	m_SignalCount = 0;
+	m_WrittenBytes = 0;
+	m_Failed = false;
+
+	{
+		std::scoped_lock s_Lock(m_BatchesMutex);
+		m_Batches.clear();
+	}
+
+	{
+		std::scoped_lock s_Lock(m_ErrorMutex);
+		m_Error.reset();
+	}
+
+	m_WriterThread = std::jthread([this, s_Writer = std::move(s_Writer)](std::stop_token p_StopToken) mutable {
+		WriteBatches(p_StopToken, std::move(s_Writer));
+	});
+}
+
+void PinTraceRecorder::Stop() {
+	if (!m_WriterThread.joinable()) {
+		return;
+	}
+
+	m_WriterThread.request_stop();
+	m_WriterThread.join();
+	m_WriterThread = {};
+}
+
+void PinTraceRecorder::Record(const std::vector<PinSignal>& p_Signals, const EntityTree* p_Tree) {
+	if (!IsRecording() || m_Failed.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	Batch s_Batch;
+	s_Batch.Signals.reserve(p_Signals.size());
+
+	for (const auto& s_Signal : p_Signals) {
+		if (s_Signal.Timestamp < m_StartTimestamp) {
+			continue;
+		}
+
+		s_Batch.Signals.push_back({
+			.Time = static_cast<uint64_t>(static_cast<double>(s_Signal.Timestamp - m_StartTimestamp) * 1'000'000'000.0 / m_TicksPerSecond),
+			.Entity = GetEntityIndex(s_Signal.Entity, p_Tree, s_Batch),
+			.Pin = GetPinIndex(s_Signal.PinId, s_Batch),
+			.PayloadType = GetPayloadTypeIndex(s_Signal.PayloadType, s_Batch),
+			.Output = s_Signal.Direction == EPinDirection::Output,
+		});
+	}
+
+	if (s_Batch.Signals.empty()) {
+		return;
+	}
+
+	// Drained signals are grouped by thread. Sorting them keeps the time deltas small.
+	std::ranges::sort(s_Batch.Signals, {}, &PinTrace::Signal::Time);
+
+	{
+		std::scoped_lock s_Lock(m_BatchesMutex);
+		m_Batches.push_back(std::move(s_Batch));
+	}
+
+	m_BatchesCondition.notify_one();
+}
+
+std::optional<std::string> PinTraceRecorder::GetError() {
+	std::scoped_lock s_Lock(m_ErrorMutex);
+	return m_Error;
+}
+
+uint32_t PinTraceRecorder::GetEntityIndex(ZEntityRef p_Entity, const EntityTree* p_Tree, Batch& p_Batch) {
+	const auto [it, s_Inserted] = m_EntityIndices.try_emplace(p_Entity, static_cast<uint32_t>(m_EntityIndices.size()));
+
+	if (s_Inserted) {
+		auto& s_Entity = p_Batch.Entities.emplace_back();
+
+		// Entities are only described through the tree, since the entity may have been destroyed since it signalled.
+		// Entities that aren't in the tree are recorded without an id or name.
+		if (const auto s_Node = p_Tree ? p_Tree->FindNode(p_Entity) : nullptr) {
+			s_Entity.Id = s_Node->EntityId;
+			s_Entity.Tblu = s_Node->TBLU.GetID();
+			s_Entity.Name = s_Node->Name;
+			s_Entity.Type = s_Node->TypeName;
+		}
+	}
+
+	return it->second;
+}
+
+uint32_t PinTraceRecorder::GetPinIndex(uint32_t p_PinId, Batch& p_Batch) {
+	const auto [it, s_Inserted] = m_PinIndices.try_emplace(p_PinId, static_cast<uint32_t>(m_PinIndices.size()));
+
+	if (s_Inserted) {
+		auto& s_Pin = p_Batch.Pins.emplace_back();
+		s_Pin.Id = static_cast<int32_t>(p_PinId);
+
+		if (ZString s_Name; SDK()->GetPinName(s_Pin.Id, s_Name)) {
+			s_Pin.Name = s_Name.ToStringView();
+		}
+	}
+
+	return it->second;
+}
+
+uint32_t PinTraceRecorder::GetPayloadTypeIndex(STypeID* p_PayloadType, Batch& p_Batch) {
+	const auto [it, s_Inserted] = m_PayloadTypeIndices.try_emplace(p_PayloadType, static_cast<uint32_t>(m_PayloadTypeIndices.size()));
+
+	if (s_Inserted) {
+		const auto s_TypeInfo = p_PayloadType ? p_PayloadType->typeInfo() : nullptr;
+		p_Batch.PayloadTypes.emplace_back(s_TypeInfo ? s_TypeInfo->m_pTypeName : "void");
+	}
+
+	return it->second;
+}
+
+void PinTraceRecorder::WriteBatches(std::stop_token p_StopToken, PinTrace::Writer p_Writer) {
+	try {
+		auto s_NextFlush = std::chrono::steady_clock::now() + c_FlushInterval;
+
+		while (true) {
+			std::deque<Batch> s_Batches;
+			bool s_Stopping;
+
+			{
+				std::unique_lock s_Lock(m_BatchesMutex);
+				m_BatchesCondition.wait_until(s_Lock, p_StopToken, s_NextFlush, [this] { return !m_Batches.empty(); });
+
+				// Checked before taking the batches, so the batches recorded before stopping are always written.
+				s_Stopping = p_StopToken.stop_requested();
+				s_Batches.swap(m_Batches);
+			}
+
+			for (const auto& s_Batch : s_Batches) {
+				for (const auto& s_Entity : s_Batch.Entities) {
+					p_Writer.WriteEntity(s_Entity);
+				}
+
+				for (const auto& s_Pin : s_Batch.Pins) {
+					p_Writer.WritePin(s_Pin);
+				}
+
+				for (const auto& s_PayloadType : s_Batch.PayloadTypes) {
+					p_Writer.WritePayloadType(s_PayloadType);
+				}
+
+				for (const auto& s_Signal : s_Batch.Signals) {
+					p_Writer.WriteSignal(s_Signal);
+				}
+			}
+
+			m_SignalCount.store(p_Writer.GetSignalCount(), std::memory_order_relaxed);
+
+			if (s_Stopping) {
+				m_WrittenBytes.store(p_Writer.Finish(), std::memory_order_relaxed);
+				return;
+			}
+
+			if (std::chrono::steady_clock::now() >= s_NextFlush) {
+				p_Writer.Flush();
+				s_NextFlush = std::chrono::steady_clock::now() + c_FlushInterval;
+			}
+
+			m_WrittenBytes.store(p_Writer.GetWrittenBytes(), std::memory_order_relaxed);
+		}
+	}
+	catch (const std::exception& e) {
+		Logger::Error("Pin trace recording stopped: {}", e.what());
+		SetError(e.what());
+	}
+}
+
+void PinTraceRecorder::SetError(std::string p_Error) {
+	{
+		std::scoped_lock s_Lock(m_ErrorMutex);
+		m_Error = std::move(p_Error);
+	}
+
+	m_Failed = true;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityTreeNode.h"
+#include "PinSignalCapture.h"
+#include "PinTrace.h"
+
+/**
+ * Records the pin signals drained from a PinSignalCapture to a pin trace file.
+ * Signals are encoded on the thread that drains them, and written to disk by a background thread,
+ * which flushes the file periodically so a trace survives the game stopping.
+ */
+class PinTraceRecorder {
+public:
+	~PinTraceRecorder();
+
+	// Starts recording to a new file. Throws std::runtime_error if the file can't be created.
+	void Start(const std::filesystem::path& p_Path, double p_TicksPerSecond);
+
+	// Writes what is left and closes the file.
+	void Stop();
+
+	[[nodiscard]] bool IsRecording() const {
+		return m_WriterThread.joinable();
+	}
+
+	/**
+	 * Adds drained signals to the recording. Signals from before the recording started are skipped.
+	 * Must be called from the thread that drains the capture.
+	 * @param p_Tree The entity tree, locked, used to describe entities the first time they signal a pin. Can be null.
+	 */
+	void Record(const std::vector<PinSignal>& p_Signals, const EntityTree* p_Tree);
+
+	[[nodiscard]] uint64_t GetSignalCount() const {
+		return m_SignalCount.load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] uint64_t GetWrittenBytes() const {
+		return m_WrittenBytes.load(std::memory_order_relaxed);
+	}
+
+	// The reason the last recording stopped early, if it did.
+	[[nodiscard]] std::optional<std::string> GetError();
+
+private:
+	// What a call to Record adds to the trace. Everything a batch's signals refer to is either in
+	// the batch itself or in an earlier one, so batches can be written in order without looking back.
+	struct Batch {
+		std::vector<PinTrace::EntityInfo> Entities;
+		std::vector<PinTrace::PinInfo> Pins;
+		std::vector<std::string> PayloadTypes;
+		std::vector<PinTrace::Signal> Signals;
+	};
+
+	uint32_t GetEntityIndex(ZEntityRef p_Entity, const EntityTree* p_Tree, Batch& p_Batch);
+	uint32_t GetPinIndex(uint32_t p_PinId, Batch& p_Batch);
+	uint32_t GetPayloadTypeIndex(STypeID* p_PayloadType, Batch& p_Batch);
+
+	void WriteBatches(std::stop_token p_StopToken, PinTrace::Writer p_Writer);
+	void SetError(std::string p_Error);
+
+	// Only used by the thread calling Record.
+	uint64_t m_StartTimestamp = 0;
+	double m_TicksPerSecond = 1.0;
+	std::unordered_map<ZEntityRef, uint32_t> m_EntityIndices;
+	std::unordered_map<uint32_t, uint32_t> m_PinIndices;
+	std::unordered_map<STypeID*, uint32_t> m_PayloadTypeIndices;
+
+	std::mutex m_BatchesMutex;
+	std::condition_variable_any m_BatchesCondition;
+	std::deque<Batch> m_Batches;
+
+	std::mutex m_ErrorMutex;
+	std::optional<std::string> m_Error;
+
+	// Set when the writer thread stopped because of an error, so nothing more is queued for it.
+	std::atomic_bool m_Failed = false;
+
+	std::atomic<uint64_t> m_SignalCount = 0;
+	std::atomic<uint64_t> m_WrittenBytes = 0;
+
+	std::jthread m_WriterThread;
+};
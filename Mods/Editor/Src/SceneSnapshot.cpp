@@ -0,0 +1,287 @@
+#include "SceneSnapshot.h"
+
+#include <cstring>
+#include <stdexcept>
+
+// Doesn't use <format>, so the snapshot tools also build with standard libraries that lack it.
+namespace SceneSnapshot {
+	constexpr char c_Magic[4] = { 'Z', 'E', 'S', 'N' };
+
+	// The header is rewritten with the entity count once it's known.
+	constexpr size_t c_EntityCountOffset = sizeof(c_Magic) + sizeof(uint32_t);
+
+	// The writer buffers this much before handing it to the file.
+	constexpr size_t c_WriteBufferSize = 256 * 1024;
+
+	// Bounds what a corrupt length or count can make the reader allocate.
+	constexpr uint64_t c_MaxStringSize = 64 * 1024 * 1024;
+	constexpr uint32_t c_MaxPropertyCount = 64 * 1024;
+
+	enum EEntityFlags : uint8_t {
+		ENTITY_HAS_TRANSFORM = 1 << 0,
+	};
+
+	Writer::Writer(const std::filesystem::path& p_Path) :
+		m_Stream(p_Path, std::ios::binary | std::ios::trunc) {
+		if (!m_Stream) {
+			throw std::runtime_error("Could not open '" + p_Path.string() + "' for writing.");
+		}
+
+		m_Buffer.reserve(c_WriteBufferSize);
+		m_Buffer.append(c_Magic, sizeof(c_Magic));
+		WriteU32(c_Version);
+		WriteU64(0);
+	}
+
+	void Writer::WriteEntity(const Entity& p_Entity) {
+		const std::pair s_Key { p_Entity.Id, p_Entity.Tblu };
+
+		if (m_LastKey && s_Key < *m_LastKey) {
+			throw std::runtime_error("Snapshot entities must be written sorted by id and tblu.");
+		}
+
+		for (size_t i = 1; i < p_Entity.Properties.size(); ++i) {
+			if (p_Entity.Properties[i].Id < p_Entity.Properties[i - 1].Id) {
+				throw std::runtime_error("Snapshot properties must be written sorted by id.");
+			}
+		}
+
+		m_LastKey = s_Key;
+
+		WriteU64(p_Entity.Id);
+		WriteU64(p_Entity.Tblu);
+		WriteName(p_Entity.Name);
+		WriteName(p_Entity.Type);
+		WriteU8(p_Entity.Transform ? ENTITY_HAS_TRANSFORM : 0);
+
+		if (p_Entity.Transform) {
+			for (const auto* s_Values : { &p_Entity.Transform->Position, &p_Entity.Transform->Rotation, &p_Entity.Transform->Scale }) {
+				for (const float s_Value : *s_Values) {
+					WriteF32(s_Value);
+				}
+			}
+		}
+
+		WriteU32(static_cast<uint32_t>(p_Entity.Properties.size()));
+
+		for (const auto& s_Property : p_Entity.Properties) {
+			WriteU32(s_Property.Id);
+			WriteName(s_Property.Name);
+			WriteName(s_Property.Type);
+			WriteString(s_Property.JsonValue);
+		}
+
+		++m_EntityCount;
+
+		if (m_Buffer.size() >= c_WriteBufferSize) {
+			Flush();
+		}
+	}
+
+	uint64_t Writer::Finish() {
+		Flush();
+
+		m_Stream.seekp(c_EntityCountOffset);
+		m_Stream.write(reinterpret_cast<const char*>(&m_EntityCount), sizeof(m_EntityCount));
+		m_Stream.close();
+
+		if (m_Stream.fail()) {
+			throw std::runtime_error("Could not finish writing the snapshot.");
+		}
+
+		return m_FlushedBytes;
+	}
+
+	void Writer::WriteU8(uint8_t p_Value) {
+		m_Buffer.push_back(static_cast<char>(p_Value));
+	}
+
+	void Writer::WriteU32(uint32_t p_Value) {
+		m_Buffer.append(reinterpret_cast<const char*>(&p_Value), sizeof(p_Value));
+	}
+
+	void Writer::WriteU64(uint64_t p_Value) {
+		m_Buffer.append(reinterpret_cast<const char*>(&p_Value), sizeof(p_Value));
+	}
+
+	void Writer::WriteF32(float p_Value) {
+		m_Buffer.append(reinterpret_cast<const char*>(&p_Value), sizeof(p_Value));
+	}
+
+	void Writer::WriteVarint(uint64_t p_Value) {
+		while (p_Value >= 0x80) {
+			m_Buffer.push_back(static_cast<char>((p_Value & 0x7F) | 0x80));
+			p_Value >>= 7;
+		}
+
+		m_Buffer.push_back(static_cast<char>(p_Value));
+	}
+
+	void Writer::WriteString(std::string_view p_Value) {
+		WriteVarint(p_Value.size());
+		m_Buffer.append(p_Value);
+	}
+
+	void Writer::WriteName(const std::string& p_Value) {
+		const auto [it, s_Inserted] = m_Names.try_emplace(p_Value, static_cast<uint32_t>(m_Names.size()));
+
+		if (!s_Inserted) {
+			WriteVarint(static_cast<uint64_t>(it->second) << 1 | 1);
+			return;
+		}
+
+		WriteVarint(static_cast<uint64_t>(p_Value.size()) << 1);
+		m_Buffer.append(p_Value);
+	}
+
+	void Writer::Flush() {
+		m_Stream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+
+		if (!m_Stream) {
+			throw std::runtime_error("Could not write the snapshot.");
+		}
+
+		m_FlushedBytes += m_Buffer.size();
+		m_Buffer.clear();
+	}
+
+	Reader::Reader(const std::filesystem::path& p_Path) :
+		m_Stream(p_Path, std::ios::binary) {
+		if (!m_Stream) {
+			throw std::runtime_error("Could not open '" + p_Path.string() + "' for reading.");
+		}
+
+		char s_Magic[sizeof(c_Magic)];
+		ReadRaw(s_Magic, sizeof(s_Magic));
+
+		if (memcmp(s_Magic, c_Magic, sizeof(c_Magic)) != 0) {
+			throw std::runtime_error("'" + p_Path.string() + "' is not a scene snapshot.");
+		}
+
+		if (const auto s_Version = ReadU32(); s_Version != c_Version) {
+			throw std::runtime_error("'" + p_Path.string() + "' is a version " + std::to_string(s_Version) +
+				" snapshot, but only version " + std::to_string(c_Version) + " is supported.");
+		}
+
+		m_EntityCount = ReadU64();
+	}
+
+	bool Reader::ReadEntity(Entity& p_Entity) {
+		if (m_EntitiesRead == m_EntityCount) {
+			return false;
+		}
+
+		p_Entity.Id = ReadU64();
+		p_Entity.Tblu = ReadU64();
+		ReadName(p_Entity.Name);
+		ReadName(p_Entity.Type);
+
+		if (ReadU8() & ENTITY_HAS_TRANSFORM) {
+			auto& s_Transform = p_Entity.Transform.emplace();
+
+			for (auto* s_Values : { &s_Transform.Position, &s_Transform.Rotation, &s_Transform.Scale }) {
+				for (float& s_Value : *s_Values) {
+					s_Value = ReadF32();
+				}
+			}
+		}
+		else {
+			p_Entity.Transform.reset();
+		}
+
+		const uint32_t s_PropertyCount = ReadU32();
+
+		if (s_PropertyCount > c_MaxPropertyCount) {
+			throw std::runtime_error("An entity has " + std::to_string(s_PropertyCount) + " properties, which is more than a snapshot can hold.");
+		}
+
+		p_Entity.Properties.resize(s_PropertyCount);
+
+		for (auto& s_Property : p_Entity.Properties) {
+			s_Property.Id = ReadU32();
+			ReadName(s_Property.Name);
+			ReadName(s_Property.Type);
+			ReadString(s_Property.JsonValue);
+		}
+
+		++m_EntitiesRead;
+
+		return true;
+	}
+
+	void Reader::ReadRaw(void* p_Data, size_t p_Size) {
+		if (!m_Stream.read(static_cast<char*>(p_Data), static_cast<std::streamsize>(p_Size))) {
+			throw std::runtime_error("The snapshot ends unexpectedly.");
+		}
+	}
+
+	uint8_t Reader::ReadU8() {
+		uint8_t s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	uint32_t Reader::ReadU32() {
+		uint32_t s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	uint64_t Reader::ReadU64() {
+		uint64_t s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	float Reader::ReadF32() {
+		float s_Value;
+		ReadRaw(&s_Value, sizeof(s_Value));
+		return s_Value;
+	}
+
+	uint64_t Reader::ReadVarint() {
+		uint64_t s_Value = 0;
+
+		for (int s_Shift = 0; s_Shift < 64; s_Shift += 7) {
+			const uint8_t s_Byte = ReadU8();
+			s_Value |= static_cast<uint64_t>(s_Byte & 0x7F) << s_Shift;
+
+			if (!(s_Byte & 0x80)) {
+				return s_Value;
+			}
+		}
+
+		throw std::runtime_error("Varint is longer than 64 bits.");
+	}
+
+	void Reader::ReadString(std::string& p_Value) {
+		ReadStringData(p_Value, ReadVarint());
+	}
+
+	void Reader::ReadStringData(std::string& p_Value, uint64_t p_Size) {
+		if (p_Size > c_MaxStringSize) {
+			throw std::runtime_error("A string of " + std::to_string(p_Size) + " bytes is longer than a snapshot can hold.");
+		}
+
+		p_Value.resize(p_Size);
+		ReadRaw(p_Value.data(), p_Value.size());
+	}
+
+	void Reader::ReadName(std::string& p_Value) {
+		const uint64_t s_Value = ReadVarint();
+
+		if (s_Value & 1) {
+			const uint64_t s_Index = s_Value >> 1;
+
+			if (s_Index >= m_Names.size()) {
+				throw std::runtime_error("Name index " + std::to_string(s_Index) + " is out of range.");
+			}
+
+			p_Value = m_Names[s_Index];
+			return;
+		}
+
+		ReadStringData(p_Value, s_Value >> 1);
+		m_Names.push_back(p_Value);
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "EditorBinaryProtocol.h"
+
+/**
+ * Snapshot of every entity in the entity tree, with its transform and properties, used to find what changed
+ * between two points in time. Snapshots are written and read as streams, so neither side needs the whole file in memory.
+ * Only depends on the standard library, so tools reading snapshots can be built on any platform.
+ *
+ * All values are little-endian.
+ *   file:      char magic[4] = "ZESN", u32 version, u64 entityCount, entity[entityCount]
+ *   string:    varint length, followed by UTF-8 bytes
+ *   name:      varint (index << 1) | 1 for a name that appeared before, or varint (length << 1) followed by
+ *              UTF-8 bytes for a new name, which gets the next index
+ *   entity:    u64 id, u64 tblu, name name, name type, u8 flags (1 = has transform), [transform],
+ *              u32 propertyCount, property[propertyCount]
+ *   transform: f32 position[3], f32 rotation[3] (yaw, pitch, roll), f32 scale[3]
+ *   property:  u32 id, name name, name type, string json
+ *
+ * Entities are sorted by id and then tblu, and the properties of an entity by id, so two snapshots can be diffed
+ * in a single pass over both. Entity and property names and types are stored once and referred to by index after that.
+ */
+namespace SceneSnapshot {
+	constexpr uint32_t c_Version = 1;
+
+	struct Property {
+		uint32_t Id = 0;
+		std::string Name;
+		std::string Type;
+		std::string JsonValue;
+	};
+
+	struct Entity {
+		uint64_t Id = 0;
+		uint64_t Tblu = 0;
+		std::string Name;
+		std::string Type;
+		std::optional<EditorBinaryProtocol::Transform> Transform;
+		std::vector<Property> Properties;
+	};
+
+	// Orders entities the way they are stored.
+	inline bool EntityLess(const Entity& p_Left, const Entity& p_Right) {
+		return p_Left.Id != p_Right.Id ? p_Left.Id < p_Right.Id : p_Left.Tblu < p_Right.Tblu;
+	}
+
+	/**
+	 * Streams a snapshot to a file. Throws std::runtime_error if the file can't be written,
+	 * or if entities or properties are written out of order.
+	 */
+	class Writer {
+	public:
+		explicit Writer(const std::filesystem::path& p_Path);
+
+		void WriteEntity(const Entity& p_Entity);
+
+		/**
+		 * Fills in the entity count and closes the file. Nothing can be written after this.
+		 * @return The size of the file in bytes.
+		 */
+		uint64_t Finish();
+
+		[[nodiscard]] uint64_t GetEntityCount() const {
+			return m_EntityCount;
+		}
+
+	private:
+		void WriteU8(uint8_t p_Value);
+		void WriteU32(uint32_t p_Value);
+		void WriteU64(uint64_t p_Value);
+		void WriteF32(float p_Value);
+		void WriteVarint(uint64_t p_Value);
+		void WriteString(std::string_view p_Value);
+		void WriteName(const std::string& p_Value);
+		void Flush();
+
+		std::ofstream m_Stream;
+		std::string m_Buffer;
+		std::unordered_map<std::string, uint32_t> m_Names;
+		uint64_t m_EntityCount = 0;
+		uint64_t m_FlushedBytes = 0;
+		std::optional<std::pair<uint64_t, uint64_t>> m_LastKey;
+	};
+
+	/**
+	 * Reads a snapshot from a file. Throws std::runtime_error if the file can't be read or is malformed.
+	 */
+	class Reader {
+	public:
+		explicit Reader(const std::filesystem::path& p_Path);
+
+		[[nodiscard]] uint64_t GetEntityCount() const {
+			return m_EntityCount;
+		}
+
+		/**
+		 * Reads the next entity, reusing the storage of the given one.
+		 * @return false once every entity has been read.
+		 */
+		bool ReadEntity(Entity& p_Entity);
+
+	private:
+		void ReadRaw(void* p_Data, size_t p_Size);
+		uint8_t ReadU8();
+		uint32_t ReadU32();
+		uint64_t ReadU64();
+		float ReadF32();
+		uint64_t ReadVarint();
+		void ReadString(std::string& p_Value);
+		void ReadStringData(std::string& p_Value, uint64_t p_Size);
+		void ReadName(std::string& p_Value);
+
+		std::ifstream m_Stream;
+		std::vector<std::string> m_Names;
+		uint64_t m_EntityCount = 0;
+		uint64_t m_EntitiesRead = 0;
+	};
+}
@@ -0,0 +1,301 @@
+/// <reference path="./editor.d.ts" />
+
+// Load tester for the editor server. Connects a number of clients to a running editor, has each of them
+// replay a trace of requests, and reports latency per request type, throughput and server memory growth.
+//
+// Usage:
+//   deno run --allow-net --allow-read editor-loadtest.ts [options]
+//
+// Options:
+//   --url <url>           Editor server to connect to. Defaults to ws://localhost:46735.
+//   --clients <n>         Number of concurrent clients. Defaults to 8.
+//   --iterations <n>      How many times each client replays the trace. Defaults to 10.
+//   --trace <file>        Trace to replay. Defaults to a built-in trace that only reads from the editor.
+//   --protocol <p>        "json" or "binary". Defaults to "json".
+//
+// A trace is a JSON lines file. Each line holds a request and the time in milliseconds, relative to the start
+// of the replay, at which it should be sent:
+//   {"at": 0, "message": {"type": "getHitmanEntity"}}
+//   {"at": 5, "message": {"type": "listEntities", "depth": 1}}
+// Requests that get a response are given a msgId, and their latency is measured until the matching response.
+// Streamed entity lists are measured until their last chunk.
+
+interface TraceEntry {
+	at: number;
+	message: EditorRequest;
+}
+
+const c_DefaultTrace: TraceEntry[] = [
+	{ at: 0, message: { type: "getHitmanEntity" } },
+	{ at: 0, message: { type: "getCameraEntity" } },
+	{ at: 5, message: { type: "listEntities", depth: 1 } },
+	{ at: 10, message: { type: "listEntities", stream: true, chunkSize: 1000 } },
+	{ at: 20, message: { type: "getServerStats" } },
+];
+
+// Requests that the server answers with a message carrying their msgId.
+const c_RequestsWithResponses = new Set([
+	"listEntities",
+	"getEntityDetails",
+	"getHitmanEntity",
+	"getCameraEntity",
+	"getServerStats",
+	"batch",
+]);
+
+function parseArgs(args: string[]) {
+	const options = {
+		url: "ws://localhost:46735",
+		clients: 8,
+		iterations: 10,
+		trace: undefined as string | undefined,
+		protocol: "json" as "json" | "binary",
+	};
+
+	for (let i = 0; i < args.length; i += 2) {
+		const value = args[i + 1];
+
+		switch (args[i]) {
+			case "--url": options.url = value; break;
+			case "--clients": options.clients = parseInt(value); break;
+			case "--iterations": options.iterations = parseInt(value); break;
+			case "--trace": options.trace = value; break;
+			case "--protocol": options.protocol = value === "binary" ? "binary" : "json"; break;
+			default: throw new Error(`Unknown option: ${args[i]}`);
+		}
+	}
+
+	return options;
+}
+
+async function loadTrace(path: string | undefined): Promise<TraceEntry[]> {
+	if (!path) {
+		return c_DefaultTrace;
+	}
+
+	const text = await Deno.readTextFile(path);
+
+	return text.split("\n")
+		.filter((line) => line.trim().length > 0)
+		.map((line) => JSON.parse(line) as TraceEntry)
+		.sort((a, b) => a.at - b.at);
+}
+
+function delay(ms: number) {
+	return new Promise((resolve) => setTimeout(resolve, ms));
+}
+
+class Stats {
+	latencies = new Map<string, number[]>();
+	sent = 0;
+	received = 0;
+	receivedBytes = 0;
+	errors = 0;
+
+	record(type: string, latency: number) {
+		let latencies = this.latencies.get(type);
+
+		if (!latencies) {
+			latencies = [];
+			this.latencies.set(type, latencies);
+		}
+
+		latencies.push(latency);
+	}
+}
+
+function percentile(sorted: number[], p: number) {
+	return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+// Reads the msgId of a binary message, if it has one. See the "Binary protocol" section of the README.
+function binaryMessageId(data: ArrayBuffer): { msgId?: number; done: boolean } {
+	const view = new DataView(data);
+	const type = view.getUint8(0);
+	const hasId = (view.getUint8(1) & 1) !== 0;
+	const msgId = hasId ? Number(view.getBigInt64(2, true)) : undefined;
+
+	// Entity list chunks carry a u32 chunk index and a u8 done flag after the header.
+	const done = type !== 2 || view.getUint8(hasId ? 14 : 6) !== 0;
+
+	return { msgId, done };
+}
+
+let nextMessageId = 1;
+
+function connect(url: string, protocol: "json" | "binary", stats: Stats): Promise<WebSocket> {
+	return new Promise((resolve, reject) => {
+		const ws = new WebSocket(url);
+		ws.binaryType = "arraybuffer";
+
+		ws.onerror = (e) => reject(e);
+
+		ws.onopen = () => {
+			ws.send(JSON.stringify({
+				type: "hello",
+				identifier: "Editor Load Test",
+				protocol,
+			} satisfies EditorRequest));
+		};
+
+		ws.onmessage = (message) => {
+			const msg = JSON.parse(message.data);
+
+			if (msg.type === "welcome") {
+				attachHandler(ws, stats);
+				resolve(ws);
+			}
+		};
+	});
+}
+
+// Requests waiting for a response, by msgId.
+const pendingRequests = new Map<number, { type: string; sentAt: number }>();
+
+function attachHandler(ws: WebSocket, stats: Stats) {
+	ws.onmessage = (message) => {
+		const receivedAt = performance.now();
+		let msgId: number | undefined;
+		let done = true;
+
+		++stats.received;
+
+		if (message.data instanceof ArrayBuffer) {
+			stats.receivedBytes += message.data.byteLength;
+			({ msgId, done } = binaryMessageId(message.data));
+		}
+		else {
+			stats.receivedBytes += message.data.length;
+
+			const msg = JSON.parse(message.data);
+
+			if (msg.type === "error") {
+				++stats.errors;
+				console.error("Editor error:", msg.message);
+			}
+
+			msgId = msg.msgId;
+			done = msg.type !== "entityListChunk" || msg.done;
+		}
+
+		if (msgId === undefined || !done) {
+			return;
+		}
+
+		const request = pendingRequests.get(msgId);
+
+		if (request) {
+			pendingRequests.delete(msgId);
+			stats.record(request.type, receivedAt - request.sentAt);
+		}
+	};
+}
+
+async function replay(ws: WebSocket, trace: TraceEntry[], iterations: number, stats: Stats) {
+	for (let iteration = 0; iteration < iterations; ++iteration) {
+		const start = performance.now();
+
+		for (const entry of trace) {
+			const wait = start + entry.at - performance.now();
+
+			if (wait > 0) {
+				await delay(wait);
+			}
+
+			const message: Record<string, unknown> = { ...entry.message };
+
+			if (c_RequestsWithResponses.has(entry.message.type)) {
+				const msgId = nextMessageId++;
+				message.msgId = msgId;
+				pendingRequests.set(msgId, { type: entry.message.type, sentAt: performance.now() });
+			}
+
+			ws.send(JSON.stringify(message));
+			++stats.sent;
+		}
+	}
+}
+
+function getServerStats(ws: WebSocket): Promise<EditorEvents.ServerStatsResponse> {
+	return new Promise((resolve) => {
+		const msgId = nextMessageId++;
+
+		ws.addEventListener("message", function onMessage(message) {
+			if (typeof message.data !== "string") {
+				return;
+			}
+
+			const msg = JSON.parse(message.data);
+
+			if (msg.type === "serverStats" && msg.msgId === msgId) {
+				ws.removeEventListener("message", onMessage);
+				resolve(msg);
+			}
+		});
+
+		ws.send(JSON.stringify({ type: "getServerStats", msgId } satisfies EditorRequest));
+	});
+}
+
+async function waitForResponses(timeoutMs: number) {
+	const deadline = performance.now() + timeoutMs;
+
+	while (pendingRequests.size > 0 && performance.now() < deadline) {
+		await delay(10);
+	}
+}
+
+const options = parseArgs(Deno.args);
+const trace = await loadTrace(options.trace);
+const stats = new Stats();
+
+// A separate JSON client samples the server's memory before and after the run.
+const monitor = await connect(options.url, "json", new Stats());
+const statsBefore = await getServerStats(monitor);
+
+const clients = await Promise.all(
+	Array.from({ length: options.clients }, () => connect(options.url, options.protocol, stats)),
+);
+
+console.log(`Replaying ${trace.length} requests ${options.iterations} times on ${clients.length} clients.`);
+
+const start = performance.now();
+await Promise.all(clients.map((ws) => replay(ws, trace, options.iterations, stats)));
+await waitForResponses(30_000);
+const elapsed = (performance.now() - start) / 1000;
+
+const statsAfter = await getServerStats(monitor);
+
+console.log();
+console.log("type                  count      p50 ms      p99 ms      max ms");
+
+for (const [type, latencies] of [...stats.latencies.entries()].sort()) {
+	latencies.sort((a, b) => a - b);
+
+	console.log(
+		type.padEnd(20),
+		String(latencies.length).padStart(7),
+		percentile(latencies, 0.5).toFixed(2).padStart(11),
+		percentile(latencies, 0.99).toFixed(2).padStart(11),
+		latencies[latencies.length - 1].toFixed(2).padStart(11),
+	);
+}
+
+console.log();
+console.log(`Sent ${stats.sent} messages in ${elapsed.toFixed(2)}s (${(stats.sent / elapsed).toFixed(0)}/s).`);
+console.log(
+	`Received ${stats.received} messages (${(stats.received / elapsed).toFixed(0)}/s, ` +
+		`${(stats.receivedBytes / elapsed / 1024 / 1024).toFixed(2)} MiB/s).`,
+);
+console.log(`Errors: ${stats.errors}. Unanswered requests: ${pendingRequests.size}.`);
+
+const toMiB = (bytes: number) => (bytes / 1024 / 1024).toFixed(1);
+
+console.log(
+	`Game working set: ${toMiB(statsBefore.workingSetBytes)} MiB -> ${toMiB(statsAfter.workingSetBytes)} MiB, ` +
+		`private bytes: ${toMiB(statsBefore.privateBytes)} MiB -> ${toMiB(statsAfter.privateBytes)} MiB.`,
+);
+
+for (const ws of [...clients, monitor]) {
+	ws.close();
+}
@@ -80,6 +80,11 @@ type GameEntityBaseDetails = GameEntity & EntityBaseData;
 type EditorEntityBaseDetails = EditorEntity & EntityBaseData;
 type EntityBaseDetails = GameEntityBaseDetails | EditorEntityBaseDetails;
 
+type EntityListEntry = EntityBaseDetails & {
+	// The number of children of the entity in the entity tree. Only set when a `depth` was requested.
+	childCount?: number;
+};
+
 // For properties with unknown names, their name will be formatted as such:
 // ~id
 // where `id` is a 16-character hexadecimal representation of the property id, which
@@ -99,6 +104,12 @@ type GameEntityDetails = GameEntity & EntityData;
 type EditorEntityDetails = EditorEntity & EntityData;
 type EntityDetails = GameEntityDetails | EditorEntityDetails;
 
+// Sent in transform updates to clients that asked for `transformOnly` updates.
+type EntityTransformDetails = EntitySelector & {
+	transform: Transform;
+	relativeTransform?: Transform;
+};
+
 
 // Requests from a third party program to the editor.
 declare namespace EditorRequests {
@@ -109,6 +120,20 @@ declare namespace EditorRequests {
 
 		// The name of the third party program.
 		identifier: string;
+
+		// The encoding to use for high-volume events. Defaults to 'json'.
+		// With 'binary', entity lists, entity details and transform updates are sent as binary frames instead.
+		// See the "Binary protocol" section of the README for their layout.
+		protocol?: 'json' | 'binary';
+
+		// The maximum number of transform updates per second this client wants to receive. Defaults to 30.
+		// Changes made in between are coalesced, and only the latest transform of each entity is sent.
+		// Set to 0 to receive an update every frame.
+		maxTransformRate?: number;
+
+		// Whether transform updates should only contain the id and transforms of the entity
+		// instead of its full details. Defaults to false.
+		transformOnly?: boolean;
 	}
 
 	interface SelectEntity {
@@ -195,6 +220,51 @@ declare namespace EditorRequests {
 		// `true` to only list entities spawned by the editor, `false` or undefined to list all entities.
 		editorOnly?: boolean;
 
+		// `true` to receive the list as a series of `entityListChunk` events instead of a single `entityList` event.
+		stream?: boolean;
+
+		// The maximum number of entities in each chunk when streaming. Defaults to 1000.
+		chunkSize?: number;
+
+		// The entity to start listing from. Defaults to the scene root.
+		root?: EntitySelector;
+
+		// How many levels below the root to list. `0` only lists the root itself. Defaults to the whole tree.
+		// When set, each listed entity includes its `childCount` so clients can lazy-load deeper branches.
+		depth?: number;
+
+		// A message id to include in the response in order to match it to the request.
+		msgId?: number;
+	}
+
+	// Find the entities in the entity tree that match every given filter, without listing the whole tree.
+	// Results are listed breadth-first and sent back as an `entityQueryResult` event, a page at a time.
+	interface QueryEntities {
+		type: 'queryEntities';
+
+		// Only match entities of this type, e.g. `ZItemSpawner`.
+		entityType?: string;
+
+		// Only match entities whose name contains this, ignoring case.
+		name?: string;
+
+		// Only match entities whose whole name matches this wildcard pattern, ignoring case. `*` matches any
+		// number of characters and `?` matches a single one, e.g. `Door_*`. At most 256 characters long.
+		namePattern?: string;
+
+		// Only match entities spawned from this blueprint.
+		tblu?: ResourceId;
+
+		// Only match spatial entities inside this box. Positions are those of the last entity tree rebuild,
+		// so entities that moved since then are matched where they were.
+		bounds?: { min: Vec3; max: Vec3; };
+
+		// How many matching entities to skip. Defaults to 0.
+		offset?: number;
+
+		// The maximum number of entities to return. Defaults to 100, and can be at most 10000.
+		limit?: number;
+
 		// A message id to include in the response in order to match it to the request.
 		msgId?: number;
 	}
@@ -226,6 +296,68 @@ declare namespace EditorRequests {
 	interface RebuildEntityTree {
 		type: 'rebuildEntityTree';
 	}
+
+	// Request counters describing the state of the editor server. Used by editor-loadtest.ts to track memory growth.
+	interface GetServerStats {
+		type: 'getServerStats';
+
+		// A message id to include in the response in order to match it to the request.
+		msgId?: number;
+	}
+
+	// Apply several commands at once. The commands are applied in order on the game thread within a single frame,
+	// and the entity events they cause are coalesced with the rest of that frame's events.
+	// A `batchResult` event is sent back once the batch has been applied.
+	interface Batch {
+		type: 'batch';
+
+		// The commands to apply. At most 10000 commands are allowed per batch.
+		commands: (SetEntityTransform | SetEntityName | SetEntityProperty)[];
+
+		// `true` to apply either all commands or none of them. If a command fails, the commands
+		// applied before it are undone. Defaults to `false`, which applies every command that can be applied.
+		atomic?: boolean;
+
+		// A message id to include in the response in order to match it to the request.
+		msgId?: number;
+	}
+
+	// Save a snapshot of every entity in the entity tree, with its world transform and properties, to a file on
+	// the machine the game runs on. The scene is captured within a single frame, and the file is written in the background.
+	// A `sceneSnapshotSaved` event is sent back once it has been written. Snapshots can be compared with the SnapshotDiff tool.
+	interface SaveSceneSnapshot {
+		type: 'saveSceneSnapshot';
+
+		// Where to save the snapshot, relative to the `SceneSnapshots` directory in the game's working directory.
+		// Must end in `.zesn`, and can't lead out of that directory.
+		path: string;
+
+		// A message id to include in the response in order to match it to the request.
+		msgId?: number;
+	}
+
+	// Start receiving `entityPropertiesChanged` events for some properties of an entity.
+	// Watched properties are compared against their last sent value once per frame, and only changed ones are sent.
+	// The current values are sent on the next frame. Watches are dropped when the scene is cleared, or when the entity leaves the entity tree.
+	interface WatchProperties {
+		type: 'watchProperties';
+
+		// The entity to watch the properties of.
+		entity: EntitySelector;
+
+		// The names or ids of the properties to watch.
+		properties: (string | number)[];
+	}
+
+	interface UnwatchProperties {
+		type: 'unwatchProperties';
+
+		// The entity to stop watching the properties of.
+		entity: EntitySelector;
+
+		// The names or ids of the properties to stop watching. Defaults to all watched properties of the entity.
+		properties?: (string | number)[];
+	}
 }
 
 type EditorRequest =
@@ -238,16 +370,25 @@ type EditorRequest =
 		| EditorRequests.SetEntityProperty
 		| EditorRequests.SignalEntityPin
 		| EditorRequests.ListEntities
+		| EditorRequests.QueryEntities
 		| EditorRequests.GetEntityDetails
 		| EditorRequests.GetHitmanEntity
 		| EditorRequests.GetCameraEntity
-		| EditorRequests.RebuildEntityTree;
+		| EditorRequests.RebuildEntityTree
+		| EditorRequests.GetServerStats
+		| EditorRequests.Batch
+		| EditorRequests.SaveSceneSnapshot
+		| EditorRequests.WatchProperties
+		| EditorRequests.UnwatchProperties;
 
 // Events from the editor to a third party program.
 declare namespace EditorEvents {
 	// A welcome message, which is sent in response to a hello message.
 	interface Welcome {
 		type: 'welcome';
+
+		// The protocol that was negotiated in the hello message.
+		protocol: 'json' | 'binary';
 	}
 
 	interface Error {
@@ -274,8 +415,8 @@ declare namespace EditorEvents {
 	interface EntityTransformUpdated {
 		type: 'entityTransformUpdated';
 
-		// The entity whose transform was updated.
-		entity: EntityDetails;
+		// The entity whose transform was updated. Entities without a transform are always sent with their full details.
+		entity: EntityDetails | EntityTransformDetails;
 	}
 
 	interface EntityNameUpdated {
@@ -312,6 +453,63 @@ declare namespace EditorEvents {
 		value: PropertyValue;
 	}
 
+	interface ServerStatsResponse {
+		type: 'serverStats';
+
+		// The message id of the request, if any.
+		msgId?: number;
+
+		// The number of connected clients.
+		clients: number;
+
+		// Memory use of the game process.
+		workingSetBytes: number;
+		privateBytes: number;
+
+		// Entity events waiting for the end of the frame.
+		pendingEvents: number;
+
+		// Distinct properties watched by any client.
+		propertyWatches: number;
+
+		// Messages sent with and without permessage-deflate since the server started.
+		compressedMessages: number;
+		uncompressedMessages: number;
+	}
+
+	// Sent to the client that sent a batch, once it has been applied.
+	interface BatchResult {
+		type: 'batchResult';
+
+		// The message id of the batch request, if any.
+		msgId?: number;
+
+		// The number of commands that were applied. Always 0 for atomic batches that failed.
+		applied: number;
+
+		// Whether commands of an atomic batch were applied and then undone because a later command failed.
+		rolledBack: boolean;
+
+		// The commands that failed, by their index in the batch.
+		errors: { index: number; message: string; }[];
+	}
+
+	// Sent at most once per frame to clients watching properties that changed during the frame.
+	interface EntityPropertiesChanged {
+		type: 'entityPropertiesChanged';
+
+		changes: {
+			// The entity whose property changed.
+			entity: EntitySelector;
+
+			// The name of the property that changed.
+			property: PropertyName;
+
+			// The new value of the property.
+			value: PropertyValue;
+		}[];
+	}
+
 	interface SceneLoading {
 		type: 'sceneLoading';
 
@@ -335,7 +533,60 @@ declare namespace EditorEvents {
 		type: 'entityList';
 
 		// The list of requested entities.
-		entities: EntityBaseDetails[];
+		entities: EntityListEntry[];
+
+		// The message id of the request, if any.
+		msgId?: number;
+	}
+
+	// Part of a streamed entity list. Chunks are sent in order, and entities are listed
+	// breadth-first across them, in the same order as in a single `entityList` response.
+	// If the entity tree is rebuilt while streaming, the stream ends with an `error` event instead.
+	interface EntityListChunk {
+		type: 'entityListChunk';
+
+		// The index of this chunk, starting from 0.
+		chunk: number;
+
+		// The entities in this chunk.
+		entities: EntityListEntry[];
+
+		// `true` if this is the last chunk of the list.
+		done: boolean;
+
+		// The message id of the request, if any. The same for all chunks of a list.
+		msgId?: number;
+	}
+
+	interface EntityQueryResult {
+		type: 'entityQueryResult';
+
+		// The total number of matching entities, across all pages.
+		total: number;
+
+		// The offset of the first entity in this page.
+		offset: number;
+
+		// The matching entities in this page, with their `childCount`.
+		entities: EntityListEntry[];
+
+		// The message id of the request, if any.
+		msgId?: number;
+	}
+
+	// Sent to the client that requested a scene snapshot, once it has been written.
+	// If it couldn't be written, an `error` event with the message id of the request is sent instead.
+	interface SceneSnapshotSaved {
+		type: 'sceneSnapshotSaved';
+
+		// The path the snapshot was saved to.
+		path: string;
+
+		// The number of entities in the snapshot.
+		entities: number;
+
+		// The size of the snapshot file.
+		bytes: number;
 
 		// The message id of the request, if any.
 		msgId?: number;
@@ -371,9 +622,26 @@ declare namespace EditorEvents {
 		msgId?: number;
 	}
 
+	// The entity tree was rebuilt from scratch (e.g. after a scene load), or changed too much to
+	// describe as a delta. Clients should request a new entity list.
 	interface EntityTreeRebuilt {
 		type: 'entityTreeRebuilt';
 	}
+
+	// The entity tree was rebuilt and only some of its entities changed.
+	// Added and reparented entities are listed parents first.
+	interface EntityTreeDelta {
+		type: 'entityTreeDelta';
+
+		// Entities that were added to the tree, along with their parent (`null` for the root).
+		added: { entity: EntityListEntry; parent: GameEntity | null; }[];
+
+		// Entities that were removed from the tree.
+		removed: GameEntity[];
+
+		// Entities that moved to a different parent in the tree.
+		reparented: { entity: GameEntity; parent: GameEntity | null; }[];
+	}
 }
 
 type EditorEvent =
@@ -386,10 +654,17 @@ type EditorEvent =
 		| EditorEvents.EntitySpawned
 		| EditorEvents.EntityDestroyed
 		| EditorEvents.EntityPropertyChanged
+		| EditorEvents.EntityPropertiesChanged
+		| EditorEvents.BatchResult
+		| EditorEvents.SceneSnapshotSaved
+		| EditorEvents.ServerStatsResponse
 		| EditorEvents.SceneLoading
 		| EditorEvents.SceneClearing
 		| EditorEvents.EntityListResponse
+		| EditorEvents.EntityListChunk
+		| EditorEvents.EntityQueryResult
 		| EditorEvents.EntityDetailsResponse
 		| EditorEvents.HitmanEntityResponse
 		| EditorEvents.CameraEntityResponse
-		| EditorEvents.EntityTreeRebuilt;
\ No newline at end of file
+		| EditorEvents.EntityTreeRebuilt
+		| EditorEvents.EntityTreeDelta;
\ No newline at end of file
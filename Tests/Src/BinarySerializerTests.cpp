@@ -0,0 +1,925 @@
+#include "Test.h"
+
+#include <IO/ZBinaryDeserializer.h>
+#include <IO/ZBinarySerializer.h>
+
+#include <Glacier/ZObject.h>
+#include <Glacier/ZTypeRegistry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <new>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// The deserializer only reaches into the game to resolve variant types and reindex resource ids.
+// Both are done against a type registry and a resource container that the tests set up.
+ZTypeRegistry** Globals::TypeRegistry = nullptr;
+ZResourceContainer** Globals::ResourceContainer = nullptr;
+ZMemoryManager** Globals::MemoryManager = nullptr;
+
+struct SInner
+{
+    int32_t m_nValue;
+    float m_fScale;
+};
+
+struct SRoot
+{
+    bool m_bEnabled;
+    ZString m_sName;
+    TArray<int32_t> m_aValues;
+    TArray<ZString> m_aNames;
+    SInner m_Inner;
+    SInner m_aFixedInners[2];
+    TArray<SInner> m_aInners;
+    TArray<int32_t> m_aEmpty;
+    ZRuntimeResourceID m_ridResource;
+    ZRuntimeResourceID m_ridSameResource;
+    ZRuntimeResourceID m_ridOtherResource;
+    ZRuntimeResourceID m_ridNull;
+};
+
+// Shaped like the entities of a large entity template, for measuring throughput.
+struct SBenchProperty
+{
+    uint32_t m_nPropertyId;
+    ZString m_sValue;
+    ZRuntimeResourceID m_ridValue;
+    ZObjectRef m_Value;
+};
+
+struct SBenchEntity
+{
+    ZString m_sName;
+    ZRuntimeResourceID m_ridBlueprint;
+    TArray<SBenchProperty> m_aProperties;
+    TArray<int32_t> m_aValues;
+};
+
+struct SBenchRoot
+{
+    TArray<SBenchEntity> m_aEntities;
+};
+
+template <typename T>
+static SArrayFunctions* GetArrayFunctions()
+{
+    static SArrayFunctions s_Functions {
+        .begin = [](void* p_Array) -> void* { return static_cast<TArray<T>*>(p_Array)->begin(); },
+        .end = [](void* p_Array) -> void* { return static_cast<TArray<T>*>(p_Array)->end(); },
+        .next = [](void*, void* p_Element) -> void* { return static_cast<T*>(p_Element) + 1; },
+        .size = [](void* p_Array) -> size_t { return static_cast<TArray<T>*>(p_Array)->size(); },
+    };
+
+    return &s_Functions;
+}
+
+/**
+ * Stub type descriptors for the types above, laid out like the game's. The serializer only reads the size,
+ * alignment, flags and name of types, the properties and base classes of classes, and the element type and
+ * functions of arrays, so that is all these fill in.
+ */
+class StubTypes
+{
+public:
+    StubTypes()
+    {
+        Int32 = AddType<int32_t>("int32", TIF_Primitive);
+        const auto s_Float32 = AddType<float>("float32", TIF_Primitive);
+        const auto s_Bool = AddType<bool>("bool", TIF_Primitive);
+        String = AddType<ZString>("ZString", 0);
+        ResourceID = AddType<ZRuntimeResourceID>("ZRuntimeResourceID", TIF_Class);
+        Variant = AddType<ZObjectRef>("ZVariant", 0);
+
+        Inner = AddClass<SInner>("SInner", {
+            { .m_pName = "m_nValue", .m_pType = Int32, .m_nOffset = offsetof(SInner, m_nValue) },
+            { .m_pName = "m_fScale", .m_pType = s_Float32, .m_nOffset = offsetof(SInner, m_fScale) },
+        });
+
+        Int32Array = AddArray<int32_t>("TArray<int32>", Int32);
+        const auto s_StringArray = AddArray<ZString>("TArray<ZString>", String);
+        const auto s_InnerArray = AddArray<SInner>("TArray<SInner>", Inner);
+        const auto s_InnerFixedArray = AddFixedArray("TFixedArray<SInner>", Inner, 2);
+
+        Root = AddClass<SRoot>("SRoot", {
+            { .m_pName = "m_bEnabled", .m_pType = s_Bool, .m_nOffset = offsetof(SRoot, m_bEnabled) },
+            { .m_pName = "m_sName", .m_pType = String, .m_nOffset = offsetof(SRoot, m_sName) },
+            { .m_pName = "m_aValues", .m_pType = Int32Array, .m_nOffset = offsetof(SRoot, m_aValues) },
+            { .m_pName = "m_aNames", .m_pType = s_StringArray, .m_nOffset = offsetof(SRoot, m_aNames) },
+            { .m_pName = "m_Inner", .m_pType = Inner, .m_nOffset = offsetof(SRoot, m_Inner) },
+            { .m_pName = "m_aFixedInners", .m_pType = s_InnerFixedArray, .m_nOffset = offsetof(SRoot, m_aFixedInners) },
+            { .m_pName = "m_aInners", .m_pType = s_InnerArray, .m_nOffset = offsetof(SRoot, m_aInners) },
+            { .m_pName = "m_aEmpty", .m_pType = Int32Array, .m_nOffset = offsetof(SRoot, m_aEmpty) },
+            { .m_pName = "m_ridResource", .m_pType = ResourceID, .m_nOffset = offsetof(SRoot, m_ridResource) },
+            { .m_pName = "m_ridSameResource", .m_pType = ResourceID, .m_nOffset = offsetof(SRoot, m_ridSameResource) },
+            { .m_pName = "m_ridOtherResource", .m_pType = ResourceID, .m_nOffset = offsetof(SRoot, m_ridOtherResource) },
+            { .m_pName = "m_ridNull", .m_pType = ResourceID, .m_nOffset = offsetof(SRoot, m_ridNull) },
+        });
+    }
+
+    template <typename T>
+    STypeID* AddType(const char* p_Name, uint16_t p_Flags)
+    {
+        IType& s_Type = m_Types.emplace_back();
+        InitType<T>(s_Type, p_Name, p_Flags);
+
+        return AddTypeID(&s_Type);
+    }
+
+    template <typename T>
+    STypeID* AddClass(const char* p_Name, std::vector<ZClassProperty> p_Properties)
+    {
+        IClassType& s_Type = m_ClassTypes.emplace_back();
+        InitType<T>(s_Type, p_Name, TIF_Class);
+
+        auto& s_Properties = m_Properties.emplace_back(std::move(p_Properties));
+        s_Type.m_nPropertyCount = static_cast<uint16_t>(s_Properties.size());
+        s_Type.m_pProperties = s_Properties.data();
+
+        return AddTypeID(&s_Type);
+    }
+
+    template <typename T>
+    STypeID* AddArray(const char* p_Name, STypeID* p_ElementType)
+    {
+        IArrayType& s_Type = m_ArrayTypes.emplace_back();
+        InitType<TArray<T>>(s_Type, p_Name, TIF_Array | TIF_Container);
+
+        s_Type.m_pArrayElementType = p_ElementType;
+        s_Type.m_pArrayFunctions = GetArrayFunctions<T>();
+
+        return AddTypeID(&s_Type);
+    }
+
+    STypeID* AddFixedArray(const char* p_Name, STypeID* p_ElementType, size_t p_Size)
+    {
+        IArrayType& s_Type = m_ArrayTypes.emplace_back();
+        IType* s_ElementType = p_ElementType->typeInfo();
+
+        s_Type.m_nTypeSize = static_cast<uint16_t>(s_ElementType->m_nTypeSize * p_Size);
+        s_Type.m_nTypeAlignment = s_ElementType->m_nTypeAlignment;
+        s_Type.m_nTypeInfoFlags = TIF_FixedArray;
+        s_Type.m_pTypeName = const_cast<char*>(p_Name);
+        s_Type.m_pArrayElementType = p_ElementType;
+
+        return AddTypeID(&s_Type);
+    }
+
+    STypeID* Int32 = nullptr;
+    STypeID* String = nullptr;
+    STypeID* ResourceID = nullptr;
+    STypeID* Variant = nullptr;
+    STypeID* Int32Array = nullptr;
+    STypeID* Inner = nullptr;
+    STypeID* Root = nullptr;
+
+private:
+    template <typename T>
+    static void InitType(IType& p_Type, const char* p_Name, uint16_t p_Flags)
+    {
+        p_Type.m_nTypeSize = sizeof(T);
+        p_Type.m_nTypeAlignment = alignof(T);
+        p_Type.m_nTypeInfoFlags = p_Flags;
+        p_Type.m_pTypeName = const_cast<char*>(p_Name);
+    }
+
+    STypeID* AddTypeID(IType* p_Type)
+    {
+        STypeID& s_TypeID = m_TypeIDs.emplace_back();
+        s_TypeID.m_pType = p_Type;
+        p_Type->m_pTypeID = &s_TypeID;
+
+        return &s_TypeID;
+    }
+
+    // Deques, so that descriptors don't move as more are added.
+    std::deque<IType> m_Types;
+    std::deque<IClassType> m_ClassTypes;
+    std::deque<IArrayType> m_ArrayTypes;
+    std::deque<std::vector<ZClassProperty>> m_Properties;
+    std::deque<STypeID> m_TypeIDs;
+};
+
+// Test values, whose arrays are freed when they go out of scope.
+struct TestRoot : SRoot
+{
+    TestRoot()
+    {
+        m_bEnabled = true;
+        m_sName = ZString("Root object");
+        m_Inner = { 42, 1.5f };
+        m_aFixedInners[0] = { -1, 0.25f };
+        m_aFixedInners[1] = { 7, -8.f };
+        m_ridResource = ZRuntimeResourceID(0x00123456789abcde);
+        m_ridSameResource = m_ridResource;
+        m_ridOtherResource = ZRuntimeResourceID(0x00fedcba98765432);
+
+        for (int32_t i = 0; i < 100; ++i)
+            m_aValues.push_back(i * i);
+
+        m_aNames.push_back(ZString(std::string_view("first")));
+        m_aNames.push_back(ZString(std::string_view("")));
+        m_aNames.push_back(ZString(std::string_view("third name")));
+
+        m_aInners.push_back({ 1, 2.f });
+        m_aInners.push_back({ 3, 4.f });
+    }
+
+    ~TestRoot()
+    {
+        m_aValues.clear();
+        m_aNames.clear();
+        m_aInners.clear();
+    }
+};
+
+// Owns data returned by the deserializer, which is allocated with the alignment of the resource.
+class DeserializedData
+{
+public:
+    DeserializedData(void* p_Data, unsigned char p_Alignment) :
+        m_Data(p_Data),
+        m_Alignment(p_Alignment)
+    {
+    }
+
+    ~DeserializedData()
+    {
+        operator delete(m_Data, std::align_val_t(m_Alignment));
+    }
+
+    DeserializedData(const DeserializedData&) = delete;
+    DeserializedData& operator=(const DeserializedData&) = delete;
+
+    const SRoot* operator->() const
+    {
+        return static_cast<const SRoot*>(m_Data);
+    }
+
+    const SRoot& operator*() const
+    {
+        return *static_cast<const SRoot*>(m_Data);
+    }
+
+    template <typename T>
+    const T& As() const
+    {
+        return *static_cast<const T*>(m_Data);
+    }
+
+private:
+    void* m_Data;
+    unsigned char m_Alignment;
+};
+
+static bool InnerEquals(const SInner& p_Left, const SInner& p_Right)
+{
+    return p_Left.m_nValue == p_Right.m_nValue && p_Left.m_fScale == p_Right.m_fScale;
+}
+
+static bool StringEquals(const ZString& p_Left, const ZString& p_Right)
+{
+    return p_Left.ToStringView() == p_Right.ToStringView() && p_Left.c_str()[p_Left.size()] == '\0';
+}
+
+template <typename T, typename Equals>
+static bool ArrayEquals(const TArray<T>& p_Left, const TArray<T>& p_Right, Equals p_Equals)
+{
+    if (p_Left.size() != p_Right.size())
+        return false;
+
+    for (size_t i = 0; i < p_Left.size(); ++i)
+    {
+        if (!p_Equals(p_Left[i], p_Right[i]))
+            return false;
+    }
+
+    return true;
+}
+
+static void CheckValues(const SRoot& p_Read, const SRoot& p_Expected)
+{
+    CHECK(p_Read.m_bEnabled == p_Expected.m_bEnabled);
+    CHECK(StringEquals(p_Read.m_sName, p_Expected.m_sName));
+    CHECK(ArrayEquals(p_Read.m_aValues, p_Expected.m_aValues, std::equal_to<int32_t>()));
+    CHECK(ArrayEquals(p_Read.m_aNames, p_Expected.m_aNames, StringEquals));
+    CHECK(InnerEquals(p_Read.m_Inner, p_Expected.m_Inner));
+    CHECK(InnerEquals(p_Read.m_aFixedInners[0], p_Expected.m_aFixedInners[0]));
+    CHECK(InnerEquals(p_Read.m_aFixedInners[1], p_Expected.m_aFixedInners[1]));
+    CHECK(ArrayEquals(p_Read.m_aInners, p_Expected.m_aInners, InnerEquals));
+    CHECK(p_Read.m_aEmpty.size() == 0);
+    CHECK(p_Read.m_aEmpty.begin() == nullptr);
+}
+
+// Lays the references of a serialized resource out in a resource container, as the game does when it loads the resource.
+class StubResourceContainer
+{
+public:
+    explicit StubResourceContainer(const std::vector<ZRuntimeResourceID>& p_References)
+    {
+        // In reverse, so reindexing has to map them.
+        m_Container.m_resources.push_back({ ZRuntimeResourceID() });
+
+        for (size_t i = p_References.size(); i > 0; --i)
+            m_Container.m_resources.push_back({ p_References[i - 1] });
+
+        for (size_t i = 0; i < p_References.size(); ++i)
+            m_ReferenceIndices.push_back(ZResourceIndex(static_cast<int>(p_References.size() - i)));
+
+        Globals::ResourceContainer = &m_ContainerPtr;
+    }
+
+    ~StubResourceContainer()
+    {
+        Globals::ResourceContainer = nullptr;
+        m_Container.m_resources.clear();
+        m_ReferenceIndices.clear();
+    }
+
+    StubResourceContainer(const StubResourceContainer&) = delete;
+    StubResourceContainer& operator=(const StubResourceContainer&) = delete;
+
+    const TArray<ZResourceIndex>* GetReferenceIndices() const
+    {
+        return &m_ReferenceIndices;
+    }
+
+private:
+    ZResourceContainer m_Container;
+    ZResourceContainer* m_ContainerPtr = &m_Container;
+    TArray<ZResourceIndex> m_ReferenceIndices;
+};
+
+// Defined by the game.
+ZTypeRegistry::~ZTypeRegistry()
+{
+}
+
+// Registers types by name, which is how the deserializer resolves the types of variants.
+class StubTypeRegistry : public ZTypeRegistry
+{
+public:
+    explicit StubTypeRegistry(const std::vector<STypeID*>& p_Types)
+    {
+        m_Buckets.assign(p_Types.size() * 2 + 1, UINT32_MAX);
+        m_Nodes.reserve(p_Types.size());
+
+        for (STypeID* s_Type : p_Types)
+        {
+            const ZString s_Name = ZString(std::string_view(s_Type->typeInfo()->m_pTypeName));
+            uint32_t& s_Bucket = m_Buckets[TypeMapHashingPolicy()(s_Name) % m_Buckets.size()];
+
+            m_Nodes.push_back({ .m_nNextIndex = static_cast<int32_t>(s_Bucket), .m_value = { s_Name, s_Type } });
+            s_Bucket = static_cast<uint32_t>(m_Nodes.size() - 1);
+        }
+
+        m_types.m_nSize = static_cast<uint32_t>(m_Nodes.size());
+        m_types.m_Info.m_nBucketCount = static_cast<uint32_t>(m_Buckets.size());
+        m_types.m_Info.m_pBuckets = m_Buckets.data();
+        m_types.m_Info.m_pNodes = m_Nodes.data();
+
+        Globals::TypeRegistry = &m_RegistryPtr;
+    }
+
+    ~StubTypeRegistry() override
+    {
+        Globals::TypeRegistry = nullptr;
+    }
+
+    StubTypeRegistry(const StubTypeRegistry&) = delete;
+    StubTypeRegistry& operator=(const StubTypeRegistry&) = delete;
+
+    int addRef() override
+    {
+        return 1;
+    }
+
+    int release() override
+    {
+        return 1;
+    }
+
+    void ZTypeRegistry_unk2() override
+    {
+    }
+
+    void ZTypeRegistry_unk3() override
+    {
+    }
+
+private:
+    using Types = decltype(m_types);
+
+    std::vector<uint32_t> m_Buckets;
+    std::vector<Types::node_type> m_Nodes;
+    ZTypeRegistry* m_RegistryPtr = this;
+};
+
+static DeserializedData Deserialize(std::vector<char> p_Resource, const TArray<ZResourceIndex>* p_ReferenceIndices = nullptr)
+{
+    ZBinaryDeserializer s_Deserializer;
+    void* s_Data = s_Deserializer.Deserialize(&p_Resource, p_ReferenceIndices);
+
+    return DeserializedData(s_Data, s_Deserializer.GetAlignment());
+}
+
+TEST(ObjectsRoundTrip)
+{
+    const StubTypes s_Types;
+    const TestRoot s_Root;
+
+    ZBinarySerializer s_Serializer;
+    const DeserializedData s_Read = Deserialize(s_Serializer.Serialize(&s_Root, s_Types.Root));
+
+    CheckValues(*s_Read, s_Root);
+
+    // Without reference indices, resource ids are left as indices into the references of the resource.
+    const std::vector<ZRuntimeResourceID>& s_References = s_Serializer.GetReferences();
+
+    CHECK(s_References.size() == 2);
+    CHECK(s_Read->m_ridResource.m_IDHigh == 0);
+    CHECK(s_References[s_Read->m_ridResource.m_IDLow] == s_Root.m_ridResource);
+    CHECK(s_Read->m_ridSameResource.m_IDLow == s_Read->m_ridResource.m_IDLow);
+    CHECK(s_References[s_Read->m_ridOtherResource.m_IDLow] == s_Root.m_ridOtherResource);
+    CHECK(s_Read->m_ridNull == ZRuntimeResourceID());
+}
+
+TEST(ResourceIDsAreReindexed)
+{
+    const StubTypes s_Types;
+    const TestRoot s_Root;
+
+    ZBinarySerializer s_Serializer;
+    std::vector<char> s_Resource = s_Serializer.Serialize(&s_Root, s_Types.Root);
+
+    const StubResourceContainer s_Container(s_Serializer.GetReferences());
+    const DeserializedData s_Read = Deserialize(std::move(s_Resource), s_Container.GetReferenceIndices());
+
+    CHECK(s_Read->m_ridResource == s_Root.m_ridResource);
+    CHECK(s_Read->m_ridSameResource == s_Root.m_ridResource);
+    CHECK(s_Read->m_ridOtherResource == s_Root.m_ridOtherResource);
+    CHECK(s_Read->m_ridNull == ZRuntimeResourceID());
+}
+
+TEST(DeserializedObjectsSerializeIdentically)
+{
+    const StubTypes s_Types;
+    const TestRoot s_Root;
+
+    ZBinarySerializer s_Serializer;
+    const std::vector<char> s_Resource = s_Serializer.Serialize(&s_Root, s_Types.Root);
+    const DeserializedData s_Read = Deserialize(s_Resource);
+
+    // Serializing the deserialized object writes its ids as they were, so only compare the rest.
+    SRoot s_ReadRoot;
+    std::memcpy(static_cast<void*>(&s_ReadRoot), &*s_Read, sizeof(SRoot));
+    s_ReadRoot.m_ridResource = s_Root.m_ridResource;
+    s_ReadRoot.m_ridSameResource = s_Root.m_ridSameResource;
+    s_ReadRoot.m_ridOtherResource = s_Root.m_ridOtherResource;
+
+    CHECK(ZBinarySerializer().Serialize(&s_ReadRoot, s_Types.Root) == s_Resource);
+}
+
+TEST(SerializersAreReusable)
+{
+    const StubTypes s_Types;
+    const TestRoot s_Root;
+    const SInner s_Inner { 5, 6.f };
+
+    ZBinarySerializer s_Serializer;
+    const std::vector<char> s_First = s_Serializer.Serialize(&s_Root, s_Types.Root);
+
+    s_Serializer.Serialize(&s_Inner, s_Types.Inner);
+    CHECK(s_Serializer.GetReferences().empty());
+
+    CHECK(s_Serializer.Serialize(&s_Root, s_Types.Root) == s_First);
+}
+
+TEST(UnsupportedTypesAreRejected)
+{
+    StubTypes s_Types;
+
+    // Maps and entity references can't be represented in BIN1.
+    const auto s_Map = s_Types.AddType<TArray<int32_t>>("TMap<int32,int32>", TIF_Map | TIF_Container);
+    const auto s_EntityRef = s_Types.AddType<ZRuntimeResourceID>("ZEntityRef", TIF_Class);
+
+    const auto s_WithMap = s_Types.AddClass<TArray<int32_t>>("SWithMap", {
+        { .m_pName = "m_Map", .m_pType = s_Map, .m_nOffset = 0 },
+    });
+
+    const auto s_WithEntityRef = s_Types.AddClass<TArray<int32_t>>("SWithEntityRef", {
+        { .m_pName = "m_rEntity", .m_pType = s_EntityRef, .m_nOffset = 0 },
+    });
+
+    ZBinarySerializer s_Serializer;
+    const TArray<int32_t> s_Value;
+
+    CHECK_THROWS(s_Serializer.Serialize(&s_Value, s_WithMap), std::invalid_argument);
+    CHECK_THROWS(s_Serializer.Serialize(&s_Value, s_WithEntityRef), std::invalid_argument);
+}
+
+static uint32_t GetDataLength(const std::vector<char>& p_Resource)
+{
+    return static_cast<uint8_t>(p_Resource[8]) << 24 | static_cast<uint8_t>(p_Resource[9]) << 16 |
+        static_cast<uint8_t>(p_Resource[10]) << 8 | static_cast<uint8_t>(p_Resource[11]);
+}
+
+TEST(MalformedResourcesAreRejected)
+{
+    const StubTypes s_Types;
+    const TestRoot s_Root;
+
+    std::vector<char> s_Resource = ZBinarySerializer().Serialize(&s_Root, s_Types.Root);
+
+    std::vector<char> s_WrongMagic = s_Resource;
+    s_WrongMagic[0] = 'X';
+    CHECK_THROWS(Deserialize(s_WrongMagic), std::invalid_argument);
+
+    // Points the first rebase location past the end of the data section.
+    const uint32_t s_DataLength = GetDataLength(s_Resource);
+    const size_t s_FirstRebaseOffset = 16 + s_DataLength + 3 * sizeof(uint32_t);
+
+    std::memcpy(s_Resource.data() + s_FirstRebaseOffset, &s_DataLength, sizeof(s_DataLength));
+    CHECK_THROWS(Deserialize(s_Resource), std::invalid_argument);
+}
+
+// A large entity template: thousands of entities, each with a name, a blueprint, and arrays of values and of
+// properties holding strings and resource ids. When variant types are given, the properties also hold variants
+// of those types, like the property values of a TEMP.
+class LargeObject
+{
+public:
+    static constexpr size_t c_EntityCount = 4000;
+    static constexpr size_t c_PropertiesPerEntity = 4;
+    static constexpr size_t c_ValuesPerEntity = 8;
+
+    explicit LargeObject(StubTypes& p_Types, const std::vector<STypeID*>& p_VariantTypes = {})
+    {
+        const auto s_Property = p_Types.AddClass<SBenchProperty>("SBenchProperty", {
+            { .m_pName = "m_nPropertyId", .m_pType = p_Types.Int32, .m_nOffset = offsetof(SBenchProperty, m_nPropertyId) },
+            { .m_pName = "m_sValue", .m_pType = p_Types.String, .m_nOffset = offsetof(SBenchProperty, m_sValue) },
+            { .m_pName = "m_ridValue", .m_pType = p_Types.ResourceID, .m_nOffset = offsetof(SBenchProperty, m_ridValue) },
+            { .m_pName = "m_Value", .m_pType = p_Types.Variant, .m_nOffset = offsetof(SBenchProperty, m_Value) },
+        });
+
+        const auto s_Entity = p_Types.AddClass<SBenchEntity>("SBenchEntity", {
+            { .m_pName = "m_sName", .m_pType = p_Types.String, .m_nOffset = offsetof(SBenchEntity, m_sName) },
+            { .m_pName = "m_ridBlueprint", .m_pType = p_Types.ResourceID, .m_nOffset = offsetof(SBenchEntity, m_ridBlueprint) },
+            {
+                .m_pName = "m_aProperties",
+                .m_pType = p_Types.AddArray<SBenchProperty>("TArray<SBenchProperty>", s_Property),
+                .m_nOffset = offsetof(SBenchEntity, m_aProperties),
+            },
+            { .m_pName = "m_aValues", .m_pType = p_Types.Int32Array, .m_nOffset = offsetof(SBenchEntity, m_aValues) },
+        });
+
+        Type = p_Types.AddClass<SBenchRoot>("SBenchRoot", {
+            {
+                .m_pName = "m_aEntities",
+                .m_pType = p_Types.AddArray<SBenchEntity>("TArray<SBenchEntity>", s_Entity),
+                .m_nOffset = offsetof(SBenchRoot, m_aEntities),
+            },
+        });
+
+        m_Root.m_aEntities.resize(c_EntityCount);
+        m_VariantValues.resize(c_EntityCount * c_PropertiesPerEntity);
+
+        for (size_t i = 0; i < c_EntityCount; ++i)
+        {
+            auto& s_EntityValue = *new (&m_Root.m_aEntities[i]) SBenchEntity {
+                .m_sName = AddString("Entity_" + std::to_string(i)),
+                .m_ridBlueprint = ZRuntimeResourceID(0x00a0000000000000ull | i),
+            };
+
+            s_EntityValue.m_aProperties.resize(c_PropertiesPerEntity);
+
+            for (size_t j = 0; j < c_PropertiesPerEntity; ++j)
+            {
+                const size_t s_PropertyIndex = i * c_PropertiesPerEntity + j;
+                ZObjectRef s_Value(nullptr, nullptr);
+
+                if (!p_VariantTypes.empty())
+                {
+                    m_VariantValues[s_PropertyIndex] = static_cast<int32_t>(s_PropertyIndex);
+                    s_Value.Assign(p_VariantTypes[s_PropertyIndex % p_VariantTypes.size()], &m_VariantValues[s_PropertyIndex]);
+                }
+
+                // Every other property refers to one of a few resources that many entities share, the rest to none.
+                new (&s_EntityValue.m_aProperties[j]) SBenchProperty {
+                    .m_nPropertyId = static_cast<uint32_t>(0x1000 + j),
+                    .m_sValue = AddString("Property value " + std::to_string(s_PropertyIndex)),
+                    .m_ridValue = j % 2 ? ZRuntimeResourceID(0x00b0000000000000ull | (i % 64)) : ZRuntimeResourceID(),
+                    .m_Value = s_Value,
+                };
+            }
+
+            s_EntityValue.m_aValues.resize(c_ValuesPerEntity);
+
+            for (size_t j = 0; j < c_ValuesPerEntity; ++j)
+                s_EntityValue.m_aValues[j] = static_cast<int32_t>(i * j);
+        }
+    }
+
+    ~LargeObject()
+    {
+        for (auto& s_Entity : m_Root.m_aEntities)
+        {
+            s_Entity.m_aProperties.clear();
+            s_Entity.m_aValues.clear();
+        }
+
+        m_Root.m_aEntities.clear();
+    }
+
+    LargeObject(const LargeObject&) = delete;
+    LargeObject& operator=(const LargeObject&) = delete;
+
+    const SBenchRoot& GetRoot() const
+    {
+        return m_Root;
+    }
+
+    STypeID* Type = nullptr;
+
+private:
+    // The strings don't own their characters, so they point into strings kept here.
+    ZString AddString(std::string p_String)
+    {
+        return ZString(std::string_view(m_Strings.emplace_back(std::move(p_String))));
+    }
+
+    std::deque<std::string> m_Strings;
+    std::vector<int32_t> m_VariantValues;
+    SBenchRoot m_Root;
+};
+
+static bool VariantEquals(const ZObjectRef& p_Left, const ZObjectRef& p_Right)
+{
+    if (p_Left.m_pTypeID != p_Right.m_pTypeID)
+        return false;
+
+    return !p_Left.m_pTypeID || *static_cast<const int32_t*>(p_Left.m_pData) == *static_cast<const int32_t*>(p_Right.m_pData);
+}
+
+static void CheckLargeObject(const SBenchRoot& p_Read, const SBenchRoot& p_Expected)
+{
+    CHECK(p_Read.m_aEntities.size() == p_Expected.m_aEntities.size());
+
+    for (size_t i = 0; i < p_Read.m_aEntities.size(); ++i)
+    {
+        const SBenchEntity& s_Read = p_Read.m_aEntities[i];
+        const SBenchEntity& s_Expected = p_Expected.m_aEntities[i];
+
+        CHECK(StringEquals(s_Read.m_sName, s_Expected.m_sName));
+        CHECK(s_Read.m_ridBlueprint == s_Expected.m_ridBlueprint);
+        CHECK(ArrayEquals(s_Read.m_aValues, s_Expected.m_aValues, std::equal_to<int32_t>()));
+        CHECK(ArrayEquals(s_Read.m_aProperties, s_Expected.m_aProperties, [](const SBenchProperty& p_Left, const SBenchProperty& p_Right)
+        {
+            return p_Left.m_nPropertyId == p_Right.m_nPropertyId && StringEquals(p_Left.m_sValue, p_Right.m_sValue) &&
+                p_Left.m_ridValue == p_Right.m_ridValue && VariantEquals(p_Left.m_Value, p_Right.m_Value);
+        }));
+    }
+}
+
+// Runs a function a few times, and returns how long the fastest run took in seconds.
+template <typename Function>
+static double MeasureFastest(Function p_Function, int p_Runs = 5)
+{
+    double s_Fastest = std::numeric_limits<double>::max();
+
+    for (int i = 0; i < p_Runs; ++i)
+    {
+        const auto s_Start = std::chrono::steady_clock::now();
+        p_Function();
+        const std::chrono::duration<double> s_Elapsed = std::chrono::steady_clock::now() - s_Start;
+
+        s_Fastest = (std::min)(s_Fastest, s_Elapsed.count());
+    }
+
+    return s_Fastest;
+}
+
+static void ReportThroughput(std::string_view p_Name, size_t p_Bytes, double p_Seconds)
+{
+    std::ostringstream s_Report;
+
+    s_Report << std::fixed << std::setprecision(2) << "    " << p_Name << ": " << p_Bytes / 1e6 << " MB in "
+        << p_Seconds * 1e3 << " ms, " << p_Bytes / 1e6 / p_Seconds << " MB/s";
+
+    std::cout << s_Report.str() << std::endl;
+}
+
+// Reports throughput rather than checking it, since that depends on the machine and the build type.
+// Useful for comparing changes to the serializer and the deserializer.
+TEST(LargeObjectThroughput)
+{
+    StubTypes s_Types;
+    const LargeObject s_Object(s_Types);
+
+    ZBinarySerializer s_Serializer;
+    std::vector<char> s_Resource;
+
+    const double s_SerializeTime = MeasureFastest([&]()
+    {
+        s_Resource = s_Serializer.Serialize(&s_Object.GetRoot(), s_Object.Type);
+    });
+
+    const StubResourceContainer s_Container(s_Serializer.GetReferences());
+    ZBinaryDeserializer s_Deserializer;
+
+    const double s_DeserializeTime = MeasureFastest([&]()
+    {
+        void* s_Data = s_Deserializer.Deserialize(&s_Resource, s_Container.GetReferenceIndices());
+        DeserializedData(s_Data, s_Deserializer.GetAlignment());
+    });
+
+    ReportThroughput("Serialize", s_Resource.size(), s_SerializeTime);
+    ReportThroughput("Deserialize", s_Resource.size(), s_DeserializeTime);
+
+    void* s_Data = s_Deserializer.Deserialize(&s_Resource, s_Container.GetReferenceIndices());
+    const DeserializedData s_Read(s_Data, s_Deserializer.GetAlignment());
+    CheckLargeObject(s_Read.As<SBenchRoot>(), s_Object.GetRoot());
+}
+
+static constexpr uint32_t c_RebaseSection = 0x12EBA5ED;
+static constexpr uint32_t c_TypeReindexingSection = 0x3989BF9F;
+static constexpr uint32_t c_ResourceIDReindexingSection = 0x578FBCEE;
+
+// The sections of a serialized resource by type, each with its type and size.
+static std::map<uint32_t, std::span<const char>> GetSections(const std::vector<char>& p_Resource)
+{
+    std::map<uint32_t, std::span<const char>> s_Sections;
+    size_t s_Offset = 16 + GetDataLength(p_Resource);
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(p_Resource[6]); ++i)
+    {
+        uint32_t s_Type;
+        uint32_t s_Size;
+        std::memcpy(&s_Type, p_Resource.data() + s_Offset, sizeof(s_Type));
+        std::memcpy(&s_Size, p_Resource.data() + s_Offset + sizeof(s_Type), sizeof(s_Size));
+
+        s_Sections.emplace(s_Type, std::span(p_Resource.data() + s_Offset, 2 * sizeof(uint32_t) + s_Size));
+        s_Offset += 2 * sizeof(uint32_t) + s_Size;
+    }
+
+    return s_Sections;
+}
+
+// Keeps only the given sections of a serialized resource, so the time the deserializer spends on each can be told apart.
+static std::vector<char> KeepSections(const std::vector<char>& p_Resource, std::initializer_list<uint32_t> p_Types)
+{
+    const auto s_Sections = GetSections(p_Resource);
+    std::vector<char> s_Resource(p_Resource.begin(), p_Resource.begin() + 16 + GetDataLength(p_Resource));
+
+    s_Resource[6] = 0;
+
+    for (uint32_t s_Type : p_Types)
+    {
+        const auto s_Section = s_Sections.at(s_Type);
+
+        s_Resource.insert(s_Resource.end(), s_Section.begin(), s_Section.end());
+        ++s_Resource[6];
+    }
+
+    return s_Resource;
+}
+
+// Relocation sections start with the number of locations to relocate.
+static uint32_t GetRelocationCount(const std::vector<char>& p_Resource, uint32_t p_SectionType)
+{
+    uint32_t s_Count;
+    std::memcpy(&s_Count, GetSections(p_Resource).at(p_SectionType).data() + 2 * sizeof(uint32_t), sizeof(s_Count));
+
+    return s_Count;
+}
+
+static void ReportRelocations(std::string_view p_Name, size_t p_Count, double p_Seconds)
+{
+    std::ostringstream s_Report;
+
+    s_Report << std::fixed << std::setprecision(2) << "    " << p_Name << ": " << p_Count << " locations in "
+        << p_Seconds * 1e3 << " ms, " << p_Seconds * 1e9 / p_Count << " ns each";
+
+    std::cout << s_Report.str() << std::endl;
+}
+
+/**
+ * Variant types of a benchmark resource. The deserializer caches the types it resolves by name for the lifetime
+ * of the process, so each generation of types gets names of its own, which the cache hasn't seen yet.
+ */
+class VariantTypes
+{
+public:
+    static constexpr size_t c_TypeCount = 256;
+
+    VariantTypes(StubTypes& p_Types, int p_Generation)
+    {
+        for (size_t i = 0; i < c_TypeCount; ++i)
+        {
+            const std::string& s_Name = m_Names.emplace_back("SBenchValue" + std::to_string(p_Generation) + "_" + std::to_string(i));
+            m_Types.push_back(p_Types.AddType<int32_t>(s_Name.c_str(), TIF_Primitive));
+        }
+    }
+
+    const std::vector<STypeID*>& Get() const
+    {
+        return m_Types;
+    }
+
+private:
+    std::deque<std::string> m_Names;
+    std::vector<STypeID*> m_Types;
+};
+
+// Times each relocation pass of the deserializer on a resource the size of a large TEMP, with tens of thousands of
+// pointers, variants and resource ids. Each pass is timed on a copy of the resource with only its section, less
+// the time that copying the data section alone takes. Like the throughput test, this reports rather than checks.
+TEST(DeserializerRelocationTimings)
+{
+    constexpr int c_ColdRuns = 3;
+
+    StubTypes s_Types;
+    std::vector<char> s_Resource;
+    std::vector<ZRuntimeResourceID> s_References;
+    double s_ColdTypeTime = std::numeric_limits<double>::max();
+    double s_WarmTypeTime = std::numeric_limits<double>::max();
+
+    for (int s_Generation = 0; s_Generation < c_ColdRuns; ++s_Generation)
+    {
+        const VariantTypes s_VariantTypes(s_Types, s_Generation);
+        const StubTypeRegistry s_Registry(s_VariantTypes.Get());
+        const LargeObject s_Object(s_Types, s_VariantTypes.Get());
+
+        ZBinarySerializer s_Serializer;
+        s_Resource = s_Serializer.Serialize(&s_Object.GetRoot(), s_Object.Type);
+
+        std::vector<char> s_TypesOnly = KeepSections(s_Resource, { c_TypeReindexingSection });
+        ZBinaryDeserializer s_Deserializer;
+
+        const auto s_Deserialize = [&](std::vector<char>& p_Resource)
+        {
+            void* s_Data = s_Deserializer.Deserialize(&p_Resource);
+            DeserializedData(s_Data, s_Deserializer.GetAlignment());
+        };
+
+        // The first deserialization resolves the types through the registry, later ones through the cache.
+        s_ColdTypeTime = (std::min)(s_ColdTypeTime, MeasureFastest([&]() { s_Deserialize(s_TypesOnly); }, 1));
+        s_WarmTypeTime = (std::min)(s_WarmTypeTime, MeasureFastest([&]() { s_Deserialize(s_TypesOnly); }));
+
+        const StubResourceContainer s_Container(s_Serializer.GetReferences());
+        void* s_Data = s_Deserializer.Deserialize(&s_Resource, s_Container.GetReferenceIndices());
+        const DeserializedData s_Read(s_Data, s_Deserializer.GetAlignment());
+
+        CheckLargeObject(s_Read.As<SBenchRoot>(), s_Object.GetRoot());
+
+        s_References = s_Serializer.GetReferences();
+    }
+
+    std::vector<char> s_NoSections = KeepSections(s_Resource, {});
+    std::vector<char> s_RebaseOnly = KeepSections(s_Resource, { c_RebaseSection });
+    std::vector<char> s_ResourceIDsOnly = KeepSections(s_Resource, { c_ResourceIDReindexingSection });
+
+    const StubResourceContainer s_Container(s_References);
+    ZBinaryDeserializer s_Deserializer;
+
+    const auto s_Measure = [&](std::vector<char>& p_Resource)
+    {
+        return MeasureFastest([&]()
+        {
+            void* s_Data = s_Deserializer.Deserialize(&p_Resource, s_Container.GetReferenceIndices());
+            DeserializedData(s_Data, s_Deserializer.GetAlignment());
+        });
+    };
+
+    const double s_BaseTime = s_Measure(s_NoSections);
+    const auto s_SectionTime = [&](double p_Time)
+    {
+        return (std::max)(p_Time - s_BaseTime, 0.0);
+    };
+
+    ReportThroughput("Data section", s_NoSections.size(), s_BaseTime);
+    ReportRelocations("Rebasing", GetRelocationCount(s_Resource, c_RebaseSection), s_SectionTime(s_Measure(s_RebaseOnly)));
+    const std::string s_TypeCount = std::to_string(VariantTypes::c_TypeCount);
+    const uint32_t s_VariantCount = GetRelocationCount(s_Resource, c_TypeReindexingSection);
+
+    ReportRelocations("Type reindexing of " + s_TypeCount + " types, cold cache", s_VariantCount, s_SectionTime(s_ColdTypeTime));
+    ReportRelocations("Type reindexing of " + s_TypeCount + " types, warm cache", s_VariantCount, s_SectionTime(s_WarmTypeTime));
+    ReportRelocations("Resource id reindexing", GetRelocationCount(s_Resource, c_ResourceIDReindexingSection), s_SectionTime(s_Measure(s_ResourceIDsOnly)));
+}
+
+int main()
+{
+    return RunTests();
+}
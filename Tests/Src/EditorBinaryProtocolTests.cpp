@@ -0,0 +1,245 @@
+#include "Test.h"
+
+#include <EditorBinaryProtocol.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using namespace EditorBinaryProtocol;
+
+static Transform MakeTransform(float p_Base)
+{
+    return Transform {
+        .Position = { p_Base, p_Base + 1.f, p_Base + 2.f },
+        .Rotation = { p_Base + 3.f, p_Base + 4.f, p_Base + 5.f },
+        .Scale = { 1.f, 1.f, 1.f },
+    };
+}
+
+static bool TransformEquals(const Transform& p_Left, const Transform& p_Right)
+{
+    return p_Left.Position == p_Right.Position && p_Left.Rotation == p_Right.Rotation && p_Left.Scale == p_Right.Scale;
+}
+
+static bool EntityEquals(const Entity& p_Left, const Entity& p_Right)
+{
+    return p_Left.Id == p_Right.Id && p_Left.Tblu == p_Right.Tblu && p_Left.Type == p_Right.Type &&
+        p_Left.Name == p_Right.Name && p_Left.ChildCount == p_Right.ChildCount;
+}
+
+static EntityDetails MakeDetails()
+{
+    EntityDetails s_Details;
+
+    s_Details.Base = Entity {
+        .Id = 0xfeedfacecafebeef,
+        .Tblu = 0x00123456789abcde,
+        .Type = "ZItemSpawner",
+        .Name = "Spawner (Crowbar)",
+        .ChildCount = 3,
+    };
+    s_Details.Interfaces = { "ZItemSpawner", "ZSpatialEntity", "ZEntityImpl" };
+    s_Details.WorldTransform = MakeTransform(10.f);
+    s_Details.RelativeTransform = MakeTransform(-5.f);
+    s_Details.Properties = {
+        PropertyValue { .Name = "m_bEnabled", .Type = "bool", .Kind = EPropertyValueKind::Json, .JsonValue = "true" },
+        PropertyValue {
+            .Name = "m_rParent",
+            .Type = "ZSpatialEntity",
+            .Kind = EPropertyValueKind::Entity,
+            .EntityValue = Entity { .Id = 42, .Type = "ZSpatialEntity" },
+        },
+        PropertyValue { .Name = "m_rTarget", .Type = "ZEntityRef", .Kind = EPropertyValueKind::Null },
+    };
+
+    return s_Details;
+}
+
+static void WriteDetailsMessage(Writer& p_Writer, const EntityDetails& p_Details)
+{
+    p_Writer.WriteHeader(EMessageType::EntityDetails, 7);
+    p_Writer.WriteEntityDetails(p_Details);
+}
+
+static void ReadDetailsMessage(Reader& p_Reader)
+{
+    p_Reader.ReadHeader();
+    p_Reader.ReadEntityDetails();
+}
+
+TEST(VarintsRoundTrip)
+{
+    constexpr uint64_t c_Values[] = { 0, 1, 0x7f, 0x80, 0x3fff, 0x4000, UINT32_MAX, UINT64_MAX };
+
+    Writer s_Writer;
+
+    for (const uint64_t s_Value : c_Values)
+        s_Writer.WriteVarint(s_Value);
+
+    Reader s_Reader(s_Writer.View());
+
+    for (const uint64_t s_Value : c_Values)
+        CHECK(s_Reader.ReadVarint() == s_Value);
+
+    CHECK(s_Reader.GetRemaining() == 0);
+}
+
+TEST(EntityListRoundTrips)
+{
+    const Entity s_Entities[] = {
+        Entity { .Id = 1, .Type = "ZEntityImpl" },
+        Entity { .Id = 2, .Tblu = 3, .Type = "ZSpatialEntity", .Name = "Door", .ChildCount = 0 },
+        Entity { .Id = UINT64_MAX, .Type = "", .Name = "" },
+    };
+
+    Writer s_Writer;
+    s_Writer.WriteHeader(EMessageType::EntityList, std::nullopt);
+
+    const size_t s_CountOffset = s_Writer.ReserveU32();
+
+    for (const auto& s_Entity : s_Entities)
+        s_Writer.WriteEntity(s_Entity);
+
+    s_Writer.PatchU32(s_CountOffset, std::size(s_Entities));
+
+    Reader s_Reader(s_Writer.View());
+    const MessageHeader s_Header = s_Reader.ReadHeader();
+
+    CHECK(s_Header.Type == EMessageType::EntityList);
+    CHECK(!s_Header.MessageId);
+    CHECK(s_Reader.ReadU32() == std::size(s_Entities));
+
+    for (const auto& s_Entity : s_Entities)
+        CHECK(EntityEquals(s_Reader.ReadEntity(), s_Entity));
+
+    CHECK(s_Reader.GetRemaining() == 0);
+}
+
+TEST(EntityDetailsRoundTrip)
+{
+    const EntityDetails s_Details = MakeDetails();
+
+    Writer s_Writer;
+    WriteDetailsMessage(s_Writer, s_Details);
+
+    Reader s_Reader(s_Writer.View());
+    const MessageHeader s_Header = s_Reader.ReadHeader();
+    const EntityDetails s_Read = s_Reader.ReadEntityDetails();
+
+    CHECK(s_Header.Type == EMessageType::EntityDetails);
+    CHECK(s_Header.MessageId == 7);
+    CHECK(EntityEquals(s_Read.Base, s_Details.Base));
+    CHECK(s_Read.Interfaces == s_Details.Interfaces);
+    CHECK(TransformEquals(*s_Read.WorldTransform, *s_Details.WorldTransform));
+    CHECK(TransformEquals(*s_Read.RelativeTransform, *s_Details.RelativeTransform));
+    CHECK(s_Read.Properties.size() == s_Details.Properties.size());
+
+    for (size_t i = 0; i < s_Details.Properties.size(); ++i)
+    {
+        CHECK(s_Read.Properties[i].Name == s_Details.Properties[i].Name);
+        CHECK(s_Read.Properties[i].Type == s_Details.Properties[i].Type);
+        CHECK(s_Read.Properties[i].Kind == s_Details.Properties[i].Kind);
+        CHECK(s_Read.Properties[i].JsonValue == s_Details.Properties[i].JsonValue);
+        CHECK(EntityEquals(s_Read.Properties[i].EntityValue, s_Details.Properties[i].EntityValue));
+    }
+
+    CHECK(s_Reader.GetRemaining() == 0);
+}
+
+TEST(EntityTransformHasFixedSize)
+{
+    const EntityTransform s_Transform {
+        .Id = 5,
+        .Tblu = 6,
+        .WorldTransform = MakeTransform(1.f),
+        .RelativeTransform = MakeTransform(2.f),
+    };
+
+    Writer s_Writer;
+    s_Writer.WriteHeader(EMessageType::EntityTransformOnlyUpdated, std::nullopt);
+    s_Writer.WriteEntityTransform(s_Transform);
+
+    // Header, id, flags, tblu and two transforms of nine floats.
+    CHECK(s_Writer.View().size() == 2 + 8 + 1 + 8 + 2 * 9 * sizeof(float));
+
+    Reader s_Reader(s_Writer.View());
+    s_Reader.ReadHeader();
+
+    const EntityTransform s_Read = s_Reader.ReadEntityTransform();
+
+    CHECK(s_Read.Id == s_Transform.Id);
+    CHECK(s_Read.Tblu == s_Transform.Tblu);
+    CHECK(TransformEquals(s_Read.WorldTransform, s_Transform.WorldTransform));
+    CHECK(TransformEquals(*s_Read.RelativeTransform, *s_Transform.RelativeTransform));
+}
+
+TEST(ClearedWriterIsReusable)
+{
+    Writer s_Writer;
+    WriteDetailsMessage(s_Writer, MakeDetails());
+
+    const std::string s_First(s_Writer.View());
+
+    s_Writer.Clear();
+    CHECK(s_Writer.View().empty());
+
+    WriteDetailsMessage(s_Writer, MakeDetails());
+    CHECK(s_Writer.View() == s_First);
+}
+
+TEST(TruncatedMessagesThrowOutOfRange)
+{
+    Writer s_Writer;
+    WriteDetailsMessage(s_Writer, MakeDetails());
+
+    const std::string_view s_Message = s_Writer.View();
+
+    // Every proper prefix of a valid message is a truncated message.
+    for (size_t s_Size = 0; s_Size < s_Message.size(); ++s_Size)
+    {
+        Reader s_Reader(s_Message.substr(0, s_Size));
+        CHECK_THROWS(ReadDetailsMessage(s_Reader), std::out_of_range);
+    }
+}
+
+TEST(StringsPastTheEndThrowOutOfRange)
+{
+    Writer s_Writer;
+    s_Writer.WriteVarint(100);
+    s_Writer.WriteU32(0);
+
+    Reader s_Reader(s_Writer.View());
+    CHECK_THROWS(s_Reader.ReadString(), std::out_of_range);
+}
+
+TEST(MalformedMessagesThrowRuntimeError)
+{
+    Writer s_Writer;
+    s_Writer.WriteU8(0);
+    s_Writer.WriteU8(0);
+
+    Reader s_UnknownType(s_Writer.View());
+    CHECK_THROWS(s_UnknownType.ReadHeader(), std::runtime_error);
+
+    s_Writer.Clear();
+    s_Writer.WriteString("m_Value");
+    s_Writer.WriteString("int32");
+    s_Writer.WriteU8(3);
+
+    Reader s_UnknownKind(s_Writer.View());
+    CHECK_THROWS(s_UnknownKind.ReadPropertyValue(), std::runtime_error);
+
+    s_Writer.Clear();
+
+    for (int i = 0; i < 10; ++i)
+        s_Writer.WriteU8(0xff);
+
+    Reader s_LongVarint(s_Writer.View());
+    CHECK_THROWS(s_LongVarint.ReadVarint(), std::runtime_error);
+}
+
+int main()
+{
+    return RunTests();
+}
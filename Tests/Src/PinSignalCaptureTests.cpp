@@ -0,0 +1,241 @@
+#include "Test.h"
+
+#include <PinSignalCapture.h>
+#include <PinSignalFilter.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Stands in for the entities of a scene. Entity references only need to be distinct, they are never dereferenced.
+static std::array<ZEntityType*, 64> s_EntitySlots;
+
+static ZEntityRef MakeEntity(size_t p_Index)
+{
+    return ZEntityRef(&s_EntitySlots[p_Index + 1]);
+}
+
+// Signals carry a sequence number in their payload type, so their order can be checked after they are drained.
+static STypeID* MakePayload(uint64_t p_Sequence)
+{
+    return reinterpret_cast<STypeID*>(static_cast<uintptr_t>(p_Sequence + 1));
+}
+
+static uint64_t GetSequence(const PinSignal& p_Signal)
+{
+    return reinterpret_cast<uintptr_t>(p_Signal.PayloadType) - 1;
+}
+
+TEST(RecordedSignalsAreDrainedInOrder)
+{
+    PinSignalCapture s_Capture;
+
+    for (uint64_t i = 0; i < 100; ++i)
+        s_Capture.Record(MakeEntity(i % 3), static_cast<uint32_t>(i), i % 2 ? EPinDirection::Output : EPinDirection::Input, MakePayload(i));
+
+    std::vector<PinSignal> s_Signals;
+    CHECK(s_Capture.Drain(s_Signals) == 0);
+    CHECK(s_Signals.size() == 100);
+
+    for (uint64_t i = 0; i < s_Signals.size(); ++i)
+    {
+        CHECK(s_Signals[i].Entity == MakeEntity(i % 3));
+        CHECK(s_Signals[i].PinId == i);
+        CHECK(s_Signals[i].Direction == (i % 2 ? EPinDirection::Output : EPinDirection::Input));
+        CHECK(GetSequence(s_Signals[i]) == i);
+        CHECK(i == 0 || s_Signals[i].Timestamp >= s_Signals[i - 1].Timestamp);
+    }
+
+    s_Signals.clear();
+    CHECK(s_Capture.Drain(s_Signals) == 0);
+    CHECK(s_Signals.empty());
+}
+
+TEST(FullRingsDropAndCountSignals)
+{
+    PinSignalCapture s_Capture;
+
+    // The ring of a thread holds 4096 signals.
+    for (uint64_t i = 0; i < 4096 + 10; ++i)
+        s_Capture.Record(MakeEntity(0), 1, EPinDirection::Input, MakePayload(i));
+
+    std::vector<PinSignal> s_Signals;
+    CHECK(s_Capture.Drain(s_Signals) == 10);
+    CHECK(s_Signals.size() == 4096);
+    CHECK(GetSequence(s_Signals.back()) == 4095);
+
+    // Draining frees the ring up again, and dropped signals are only reported once.
+    s_Capture.Record(MakeEntity(0), 1, EPinDirection::Input, MakePayload(0));
+
+    s_Signals.clear();
+    CHECK(s_Capture.Drain(s_Signals) == 0);
+    CHECK(s_Signals.size() == 1);
+}
+
+TEST(FiltersMatchPinsAndEntities)
+{
+    PinSignalFilter s_Empty;
+    CHECK(s_Empty.Matches(MakeEntity(0), 1));
+
+    PinSignalFilter s_Pins;
+    s_Pins.AddPin(1);
+    s_Pins.AddPin(0xfedcba98);
+
+    CHECK(s_Pins.Matches(MakeEntity(0), 1));
+    CHECK(s_Pins.Matches(MakeEntity(1), 0xfedcba98));
+    CHECK(!s_Pins.Matches(MakeEntity(0), 2));
+
+    // Shares its bit in the bloom filter with pin 1, so it has to be rejected by the exact set.
+    CHECK(!s_Pins.Matches(MakeEntity(0), 1 + 4096));
+
+    PinSignalFilter s_Both = s_Pins;
+    s_Both.AddEntity(MakeEntity(1));
+
+    CHECK(s_Both.Matches(MakeEntity(1), 1));
+    CHECK(!s_Both.Matches(MakeEntity(0), 1));
+    CHECK(!s_Both.Matches(MakeEntity(1), 2));
+}
+
+TEST(SubtreesAreFlattened)
+{
+    // Root
+    //   A
+    //     A1
+    //       A1X
+    //     A2
+    //   B
+    // Orphan, whose parent isn't in the tree.
+    auto s_Tree = std::make_unique<EntityTree>(8);
+
+    const auto s_AddNode = [&](size_t p_Entity, std::string_view p_Name, ZEntityRef p_Parent)
+    {
+        s_Tree->AddNode(EntityTreeNodeInfo {
+            .Name = p_Name,
+            .TypeName = "ZEntityImpl",
+            .EntityId = p_Entity,
+            .Entity = MakeEntity(p_Entity),
+            .LogicalParent = p_Parent,
+        });
+    };
+
+    s_AddNode(0, "Root", {});
+    s_AddNode(1, "A", MakeEntity(0));
+    s_AddNode(2, "A1", MakeEntity(1));
+    s_AddNode(3, "A1X", MakeEntity(2));
+    s_AddNode(4, "A2", MakeEntity(1));
+    s_AddNode(5, "B", MakeEntity(0));
+    s_AddNode(6, "Orphan", MakeEntity(9));
+    s_Tree->LinkNodes();
+
+    PinSignalFilter s_Filter;
+    s_Filter.AddSubtree(*s_Tree, *s_Tree->FindNode(MakeEntity(1)));
+
+    // The filter doesn't refer to the tree, which is usually replaced while the filter is still in use.
+    s_Tree.reset();
+
+    for (size_t s_Entity : { 1, 2, 3, 4 })
+        CHECK(s_Filter.Matches(MakeEntity(s_Entity), 1));
+
+    for (size_t s_Entity : { 0, 5, 6, 9 })
+        CHECK(!s_Filter.Matches(MakeEntity(s_Entity), 1));
+}
+
+// Pin detours record signals on many threads while the UI thread replaces the filter and drains the rings.
+// Meant to be run under ThreadSanitizer and AddressSanitizer as well, which catch filters that are destroyed
+// while a detour is still testing them.
+TEST(ConcurrentRecordReplaceAndDrain)
+{
+    constexpr size_t c_ProducerCount = 4;
+    constexpr uint64_t c_SignalsPerProducer = 200000;
+    constexpr uint32_t c_TracedPin = 1;
+    constexpr uint32_t c_IgnoredPin = 2;
+
+    PinSignalCapture s_Capture;
+
+    // Every filter matches the traced pin of every producer, and none matches the ignored pin.
+    const auto s_MakeFilter = [&](uint32_t p_Generation)
+    {
+        auto s_Filter = std::make_unique<PinSignalFilter>();
+        s_Filter->AddPin(c_TracedPin);
+
+        for (uint32_t i = 0; i < p_Generation % 16; ++i)
+            s_Filter->AddPin(1000 + i);
+
+        if (p_Generation % 2)
+        {
+            for (size_t i = 0; i < c_ProducerCount; ++i)
+                s_Filter->AddEntity(MakeEntity(i));
+        }
+
+        return s_Filter;
+    };
+
+    s_Capture.SetFilter(s_MakeFilter(0));
+
+    std::atomic<size_t> s_RunningProducers = c_ProducerCount;
+    std::vector<std::thread> s_Producers;
+
+    for (size_t s_Producer = 0; s_Producer < c_ProducerCount; ++s_Producer)
+    {
+        s_Producers.emplace_back([&, s_Producer]()
+        {
+            for (uint64_t i = 0; i < c_SignalsPerProducer; ++i)
+            {
+                s_Capture.Record(MakeEntity(s_Producer), c_TracedPin, EPinDirection::Input, MakePayload(i));
+                s_Capture.Record(MakeEntity(s_Producer), c_IgnoredPin, EPinDirection::Input, MakePayload(i));
+            }
+
+            --s_RunningProducers;
+        });
+    }
+
+    std::thread s_Replacer([&]()
+    {
+        for (uint32_t s_Generation = 1; s_RunningProducers > 0; ++s_Generation)
+            s_Capture.SetFilter(s_MakeFilter(s_Generation));
+    });
+
+    std::vector<PinSignal> s_Signals;
+    uint64_t s_Dropped = 0;
+
+    while (s_RunningProducers > 0)
+        s_Dropped += s_Capture.Drain(s_Signals);
+
+    for (auto& s_Thread : s_Producers)
+        s_Thread.join();
+
+    s_Replacer.join();
+    s_Dropped += s_Capture.Drain(s_Signals);
+
+    CHECK(s_Signals.size() + s_Dropped == c_ProducerCount * c_SignalsPerProducer);
+
+    // Signals of a thread keep their order, even when they are drained across several calls.
+    std::array<uint64_t, c_ProducerCount> s_NextSequence {};
+
+    for (const auto& s_Signal : s_Signals)
+    {
+        CHECK(s_Signal.PinId == c_TracedPin);
+
+        const auto s_Producer = static_cast<size_t>(s_Signal.Entity.m_pEntity - &s_EntitySlots[1]);
+        CHECK(s_Producer < c_ProducerCount);
+        CHECK(GetSequence(s_Signal) >= s_NextSequence[s_Producer]);
+
+        s_NextSequence[s_Producer] = GetSequence(s_Signal) + 1;
+    }
+
+    // Without a filter every signal is recorded again.
+    s_Capture.SetFilter(nullptr);
+    s_Capture.Record(MakeEntity(0), c_IgnoredPin, EPinDirection::Output, MakePayload(0));
+
+    s_Signals.clear();
+    s_Capture.Drain(s_Signals);
+    CHECK(s_Signals.size() == 1);
+    CHECK(s_Signals[0].PinId == c_IgnoredPin);
+}
+
+int main()
+{
+    return RunTests();
+}
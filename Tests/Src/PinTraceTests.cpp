@@ -0,0 +1,214 @@
+#include "Test.h"
+
+#include <PinTrace.h>
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace PinTrace;
+
+constexpr uint64_t c_StartTime = 1700000000000;
+
+struct WrittenTrace
+{
+    std::vector<Signal> Signals;
+
+    // The number of signals in the file when it ends after each record.
+    std::map<uint64_t, size_t> SignalsByRecordEnd;
+};
+
+// Writes a small trace, flushing after every record so the record boundaries are known.
+static WrittenTrace WriteTrace(const std::filesystem::path& p_Path)
+{
+    WrittenTrace s_Trace;
+    Writer s_Writer(p_Path, c_StartTime);
+
+    const auto s_RecordWritten = [&]()
+    {
+        s_Writer.Flush();
+        s_Trace.SignalsByRecordEnd[s_Writer.GetWrittenBytes()] = s_Trace.Signals.size();
+    };
+
+    s_RecordWritten();
+
+    const uint32_t s_Door = s_Writer.WriteEntity(EntityInfo { .Id = 1, .Tblu = 2, .Name = "Door", .Type = "ZDoorEntity" });
+    s_RecordWritten();
+
+    const uint32_t s_Open = s_Writer.WritePin(PinInfo { .Id = 0x1234abcd, .Name = "Open" });
+    s_RecordWritten();
+
+    // Pin ids are CRC32s, so they can be negative when stored as an int.
+    const uint32_t s_Unknown = s_Writer.WritePin(PinInfo { .Id = -5 });
+    s_RecordWritten();
+
+    const uint32_t s_Void = s_Writer.WritePayloadType("void");
+    s_RecordWritten();
+
+    const auto s_WriteSignal = [&](const Signal& p_Signal)
+    {
+        s_Writer.WriteSignal(p_Signal);
+        s_Trace.Signals.push_back(p_Signal);
+        s_RecordWritten();
+    };
+
+    s_WriteSignal(Signal { .Time = 1000, .Entity = s_Door, .Pin = s_Open, .PayloadType = s_Void, .Output = false });
+    s_WriteSignal(Signal { .Time = 5000000000, .Entity = s_Door, .Pin = s_Unknown, .PayloadType = s_Void, .Output = true });
+
+    // Signals from other threads can arrive slightly out of order.
+    s_WriteSignal(Signal { .Time = 4999999000, .Entity = s_Door, .Pin = s_Open, .PayloadType = s_Void, .Output = true });
+
+    const uint32_t s_Lever = s_Writer.WriteEntity(EntityInfo { .Id = UINT64_MAX, .Tblu = 0, .Name = "", .Type = "ZLever" });
+    s_RecordWritten();
+
+    const uint32_t s_Bool = s_Writer.WritePayloadType("bool");
+    s_RecordWritten();
+
+    s_WriteSignal(Signal { .Time = 5000000000, .Entity = s_Lever, .Pin = s_Unknown, .PayloadType = s_Bool, .Output = false });
+
+    s_Writer.Finish();
+
+    return s_Trace;
+}
+
+static std::string ReadFile(const std::filesystem::path& p_Path)
+{
+    std::ifstream s_Stream(p_Path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(s_Stream), std::istreambuf_iterator<char>());
+}
+
+static void WriteFile(const std::filesystem::path& p_Path, std::string_view p_Data)
+{
+    std::ofstream s_Stream(p_Path, std::ios::binary | std::ios::trunc);
+    s_Stream.write(p_Data.data(), static_cast<std::streamsize>(p_Data.size()));
+}
+
+static bool SignalEquals(const Signal& p_Left, const Signal& p_Right)
+{
+    return p_Left.Time == p_Right.Time && p_Left.Entity == p_Right.Entity && p_Left.Pin == p_Right.Pin &&
+        p_Left.PayloadType == p_Right.PayloadType && p_Left.Output == p_Right.Output;
+}
+
+TEST(SignalsRoundTrip)
+{
+    const TemporaryFile s_File("trace.zept");
+    const WrittenTrace s_Trace = WriteTrace(s_File.GetPath());
+
+    Reader s_Reader(s_File.GetPath());
+    CHECK(s_Reader.GetStartTime() == c_StartTime);
+
+    Signal s_Signal;
+
+    for (const auto& s_Expected : s_Trace.Signals)
+    {
+        CHECK(s_Reader.ReadSignal(s_Signal));
+        CHECK(SignalEquals(s_Signal, s_Expected));
+    }
+
+    CHECK(!s_Reader.ReadSignal(s_Signal));
+    CHECK(!s_Reader.IsTruncated());
+
+    CHECK(s_Reader.GetEntities().size() == 2);
+    CHECK(s_Reader.GetEntities()[0].Id == 1);
+    CHECK(s_Reader.GetEntities()[0].Tblu == 2);
+    CHECK(s_Reader.GetEntities()[0].Name == "Door");
+    CHECK(s_Reader.GetEntities()[0].Type == "ZDoorEntity");
+    CHECK(s_Reader.GetEntities()[1].Id == UINT64_MAX);
+    CHECK(s_Reader.GetEntities()[1].Type == "ZLever");
+
+    CHECK(s_Reader.GetPins().size() == 2);
+    CHECK(s_Reader.GetPins()[0].Id == 0x1234abcd);
+    CHECK(s_Reader.GetPins()[0].Name == "Open");
+    CHECK(s_Reader.GetPins()[1].Id == -5);
+    CHECK(s_Reader.GetPins()[1].Name.empty());
+
+    CHECK(s_Reader.GetPayloadTypes() == std::vector<std::string>({ "void", "bool" }));
+}
+
+TEST(TruncatedTracesAreReadUpToTheLastRecord)
+{
+    const TemporaryFile s_File("complete.zept");
+    const TemporaryFile s_TruncatedFile("truncated.zept");
+
+    const WrittenTrace s_Trace = WriteTrace(s_File.GetPath());
+    const std::string s_Data = ReadFile(s_File.GetPath());
+    const uint64_t s_HeaderSize = s_Trace.SignalsByRecordEnd.begin()->first;
+
+    for (size_t s_Size = 0; s_Size < s_HeaderSize; ++s_Size)
+    {
+        WriteFile(s_TruncatedFile.GetPath(), std::string_view(s_Data).substr(0, s_Size));
+        CHECK_THROWS(Reader(s_TruncatedFile.GetPath()), std::runtime_error);
+    }
+
+    for (size_t s_Size = s_HeaderSize; s_Size <= s_Data.size(); ++s_Size)
+    {
+        WriteFile(s_TruncatedFile.GetPath(), std::string_view(s_Data).substr(0, s_Size));
+
+        // The last record that fits in the file, and how many signals were written up to it.
+        const auto s_LastRecord = std::prev(s_Trace.SignalsByRecordEnd.upper_bound(s_Size));
+
+        Reader s_Reader(s_TruncatedFile.GetPath());
+        Signal s_Signal;
+        size_t s_SignalCount = 0;
+
+        while (s_Reader.ReadSignal(s_Signal))
+        {
+            CHECK(SignalEquals(s_Signal, s_Trace.Signals[s_SignalCount]));
+            ++s_SignalCount;
+        }
+
+        CHECK(s_SignalCount == s_LastRecord->second);
+        CHECK(s_Reader.IsTruncated() == (s_LastRecord->first != s_Size));
+    }
+}
+
+TEST(SignalsMustReferToWrittenRecords)
+{
+    const TemporaryFile s_File("invalid.zept");
+    Writer s_Writer(s_File.GetPath(), c_StartTime);
+
+    CHECK_THROWS(s_Writer.WriteSignal(Signal {}), std::runtime_error);
+
+    s_Writer.WriteEntity(EntityInfo {});
+    s_Writer.WritePin(PinInfo {});
+    s_Writer.WritePayloadType("void");
+
+    s_Writer.WriteSignal(Signal {});
+    CHECK_THROWS(s_Writer.WriteSignal(Signal { .Entity = 1 }), std::runtime_error);
+    CHECK_THROWS(s_Writer.WriteSignal(Signal { .Pin = 1 }), std::runtime_error);
+    CHECK_THROWS(s_Writer.WriteSignal(Signal { .PayloadType = 1 }), std::runtime_error);
+    CHECK(s_Writer.GetSignalCount() == 1);
+}
+
+TEST(MalformedTracesAreRejected)
+{
+    const TemporaryFile s_File("malformed.zept");
+    const std::string_view s_Header("ZEPT\1\0\0\0\0\0\0\0\0\0\0\0", 16);
+
+    WriteFile(s_File.GetPath(), std::string_view("ZESN\1\0\0\0\0\0\0\0\0\0\0\0", 16));
+    CHECK_THROWS(Reader(s_File.GetPath()), std::runtime_error);
+
+    WriteFile(s_File.GetPath(), std::string_view("ZEPT\2\0\0\0\0\0\0\0\0\0\0\0", 16));
+    CHECK_THROWS(Reader(s_File.GetPath()), std::runtime_error);
+
+    // A record kind that doesn't exist.
+    WriteFile(s_File.GetPath(), std::string(s_Header) + "\x7f");
+
+    Reader s_UnknownKind(s_File.GetPath());
+    Signal s_Signal;
+    CHECK_THROWS(s_UnknownKind.ReadSignal(s_Signal), std::runtime_error);
+
+    // A signal before the entity, pin and payload type it refers to.
+    WriteFile(s_File.GetPath(), std::string(s_Header) + std::string("\3\0\0\0\0", 5));
+
+    Reader s_Undefined(s_File.GetPath());
+    CHECK_THROWS(s_Undefined.ReadSignal(s_Signal), std::runtime_error);
+}
+
+int main()
+{
+    return RunTests();
+}
@@ -0,0 +1,213 @@
+#include "Test.h"
+
+#include <SceneSnapshot.h>
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace SceneSnapshot;
+
+static std::vector<Entity> MakeEntities()
+{
+    Entity s_Root {
+        .Id = 1,
+        .Tblu = 0x00a1b2c3d4e5f607,
+        .Name = "Scene",
+        .Type = "ZEntityImpl",
+    };
+
+    Entity s_Door {
+        .Id = 2,
+        .Tblu = 0x00a1b2c3d4e5f607,
+        .Name = "Door",
+        .Type = "ZSpatialEntity",
+        .Transform = EditorBinaryProtocol::Transform {
+            .Position = { 1.f, 2.f, 3.f },
+            .Rotation = { 0.f, 90.f, 0.f },
+            .Scale = { 1.f, 1.f, 1.f },
+        },
+        .Properties = {
+            Property { .Id = 10, .Name = "m_bOpen", .Type = "bool", .JsonValue = "false" },
+            Property { .Id = 20, .Name = "m_sName", .Type = "ZString", .JsonValue = "\"Front door\"" },
+        },
+    };
+
+    // Same id as the door, but from another blueprint. Reuses the names and types written before it.
+    Entity s_OtherDoor = s_Door;
+    s_OtherDoor.Tblu = 0x00ffffffffffffff;
+    s_OtherDoor.Properties[0].JsonValue = "true";
+
+    Entity s_Spawner {
+        .Id = 3,
+        .Name = "Door",
+        .Type = "ZItemSpawner",
+        .Properties = { Property { .Id = 10, .Name = "m_bOpen", .Type = "bool", .JsonValue = "" } },
+    };
+
+    return { s_Root, s_Door, s_OtherDoor, s_Spawner };
+}
+
+static bool EntityEquals(const Entity& p_Left, const Entity& p_Right)
+{
+    if (p_Left.Id != p_Right.Id || p_Left.Tblu != p_Right.Tblu || p_Left.Name != p_Right.Name ||
+        p_Left.Type != p_Right.Type || p_Left.Transform.has_value() != p_Right.Transform.has_value() ||
+        p_Left.Properties.size() != p_Right.Properties.size())
+        return false;
+
+    if (p_Left.Transform && (p_Left.Transform->Position != p_Right.Transform->Position ||
+        p_Left.Transform->Rotation != p_Right.Transform->Rotation || p_Left.Transform->Scale != p_Right.Transform->Scale))
+        return false;
+
+    for (size_t i = 0; i < p_Left.Properties.size(); ++i)
+    {
+        const Property& s_Left = p_Left.Properties[i];
+        const Property& s_Right = p_Right.Properties[i];
+
+        if (s_Left.Id != s_Right.Id || s_Left.Name != s_Right.Name || s_Left.Type != s_Right.Type ||
+            s_Left.JsonValue != s_Right.JsonValue)
+            return false;
+    }
+
+    return true;
+}
+
+static uint64_t WriteSnapshot(const std::filesystem::path& p_Path, const std::vector<Entity>& p_Entities)
+{
+    Writer s_Writer(p_Path);
+
+    for (const auto& s_Entity : p_Entities)
+        s_Writer.WriteEntity(s_Entity);
+
+    return s_Writer.Finish();
+}
+
+static std::string ReadFile(const std::filesystem::path& p_Path)
+{
+    std::ifstream s_Stream(p_Path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(s_Stream), std::istreambuf_iterator<char>());
+}
+
+static void WriteFile(const std::filesystem::path& p_Path, std::string_view p_Data)
+{
+    std::ofstream s_Stream(p_Path, std::ios::binary | std::ios::trunc);
+    s_Stream.write(p_Data.data(), static_cast<std::streamsize>(p_Data.size()));
+}
+
+static void ReadSnapshot(const std::filesystem::path& p_Path)
+{
+    Reader s_Reader(p_Path);
+    Entity s_Entity;
+
+    while (s_Reader.ReadEntity(s_Entity))
+    {
+    }
+}
+
+TEST(EntitiesRoundTrip)
+{
+    const TemporaryFile s_File("snapshot.zesn");
+    const std::vector<Entity> s_Entities = MakeEntities();
+
+    const uint64_t s_Size = WriteSnapshot(s_File.GetPath(), s_Entities);
+
+    CHECK(s_Size == std::filesystem::file_size(s_File.GetPath()));
+
+    Reader s_Reader(s_File.GetPath());
+    CHECK(s_Reader.GetEntityCount() == s_Entities.size());
+
+    // The entity is reused between reads, so this also checks that nothing carries over from the previous one.
+    Entity s_Entity;
+
+    for (const auto& s_Expected : s_Entities)
+    {
+        CHECK(s_Reader.ReadEntity(s_Entity));
+        CHECK(EntityEquals(s_Entity, s_Expected));
+    }
+
+    CHECK(!s_Reader.ReadEntity(s_Entity));
+}
+
+TEST(EmptySnapshotRoundTrips)
+{
+    const TemporaryFile s_File("empty.zesn");
+
+    WriteSnapshot(s_File.GetPath(), {});
+
+    Reader s_Reader(s_File.GetPath());
+    Entity s_Entity;
+
+    CHECK(s_Reader.GetEntityCount() == 0);
+    CHECK(!s_Reader.ReadEntity(s_Entity));
+}
+
+TEST(RepeatedNamesAreStoredOnce)
+{
+    const TemporaryFile s_File("names.zesn");
+    const std::string s_LongType(10000, 'T');
+
+    std::vector<Entity> s_Entities;
+
+    for (uint64_t i = 0; i < 100; ++i)
+        s_Entities.push_back(Entity { .Id = i, .Name = "Entity", .Type = s_LongType });
+
+    const uint64_t s_Size = WriteSnapshot(s_File.GetPath(), s_Entities);
+
+    CHECK(s_Size < 2 * s_LongType.size());
+
+    Reader s_Reader(s_File.GetPath());
+    Entity s_Entity;
+
+    while (s_Reader.ReadEntity(s_Entity))
+        CHECK(s_Entity.Type == s_LongType);
+}
+
+TEST(UnsortedEntitiesAreRejected)
+{
+    const TemporaryFile s_File("unsorted.zesn");
+    Writer s_Writer(s_File.GetPath());
+
+    s_Writer.WriteEntity(Entity { .Id = 2 });
+    CHECK_THROWS(s_Writer.WriteEntity(Entity { .Id = 1 }), std::runtime_error);
+
+    CHECK_THROWS(
+        s_Writer.WriteEntity(Entity { .Id = 3, .Properties = { Property { .Id = 2 }, Property { .Id = 1 } } }),
+        std::runtime_error
+    );
+}
+
+TEST(TruncatedSnapshotsThrow)
+{
+    const TemporaryFile s_File("complete.zesn");
+    const TemporaryFile s_TruncatedFile("truncated.zesn");
+
+    WriteSnapshot(s_File.GetPath(), MakeEntities());
+
+    const std::string s_Data = ReadFile(s_File.GetPath());
+
+    for (size_t s_Size = 0; s_Size < s_Data.size(); ++s_Size)
+    {
+        WriteFile(s_TruncatedFile.GetPath(), std::string_view(s_Data).substr(0, s_Size));
+        CHECK_THROWS(ReadSnapshot(s_TruncatedFile.GetPath()), std::runtime_error);
+    }
+}
+
+TEST(OtherFilesAreRejected)
+{
+    const TemporaryFile s_File("other.zesn");
+
+    WriteFile(s_File.GetPath(), std::string_view("ZEPT\1\0\0\0\0\0\0\0\0\0\0\0", 16));
+    CHECK_THROWS(Reader(s_File.GetPath()), std::runtime_error);
+
+    WriteFile(s_File.GetPath(), std::string_view("ZESN\2\0\0\0\0\0\0\0\0\0\0\0", 16));
+    CHECK_THROWS(Reader(s_File.GetPath()), std::runtime_error);
+
+    CHECK_THROWS(Reader(s_File.GetPath().string() + ".missing"), std::runtime_error);
+}
+
+int main()
+{
+    return RunTests();
+}
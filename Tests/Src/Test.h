@@ -0,0 +1,121 @@
+#pragma once
+
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Minimal test runner, so the tests build anywhere without extra dependencies.
+ * Every test source is its own executable: tests are declared with TEST, check their results with CHECK and
+ * CHECK_THROWS, and main returns RunTests().
+ */
+struct TestFailure
+{
+    std::string Message;
+};
+
+struct TestCase
+{
+    const char* Name;
+    void (*Run)();
+};
+
+inline std::vector<TestCase>& GetTestCases()
+{
+    static std::vector<TestCase> s_TestCases;
+    return s_TestCases;
+}
+
+inline bool RegisterTest(const char* p_Name, void (*p_Run)())
+{
+    GetTestCases().push_back({ p_Name, p_Run });
+    return true;
+}
+
+// A uniquely named file in the temporary directory, which is removed when it goes out of scope.
+class TemporaryFile
+{
+public:
+    explicit TemporaryFile(std::string_view p_Name) :
+        m_Path(std::filesystem::temp_directory_path() / (std::to_string(std::random_device()()) + "-" + std::string(p_Name)))
+    {
+    }
+
+    ~TemporaryFile()
+    {
+        std::error_code s_Error;
+        std::filesystem::remove(m_Path, s_Error);
+    }
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    [[nodiscard]] const std::filesystem::path& GetPath() const
+    {
+        return m_Path;
+    }
+
+private:
+    std::filesystem::path m_Path;
+};
+
+inline int RunTests()
+{
+    size_t s_Failed = 0;
+
+    for (const auto& s_Test : GetTestCases())
+    {
+        try
+        {
+            s_Test.Run();
+            std::cout << "[PASS] " << s_Test.Name << std::endl;
+            continue;
+        }
+        catch (const TestFailure& p_Failure)
+        {
+            std::cout << "[FAIL] " << s_Test.Name << ": " << p_Failure.Message << std::endl;
+        }
+        catch (const std::exception& p_Exception)
+        {
+            std::cout << "[FAIL] " << s_Test.Name << ": unexpected exception: " << p_Exception.what() << std::endl;
+        }
+
+        ++s_Failed;
+    }
+
+    std::cout << GetTestCases().size() - s_Failed << " of " << GetTestCases().size() << " tests passed." << std::endl;
+
+    return s_Failed == 0 ? 0 : 1;
+}
+
+#define TEST_FAILURE(p_Message) TestFailure { std::string(__FILE__) + ":" + std::to_string(__LINE__) + ": " + (p_Message) }
+
+#define TEST(p_Name) \
+    static void p_Name(); \
+    static const bool p_Name##Registered = RegisterTest(#p_Name, p_Name); \
+    static void p_Name()
+
+#define CHECK(p_Condition) \
+    do \
+    { \
+        if (!(p_Condition)) \
+            throw TEST_FAILURE("CHECK(" #p_Condition ") failed"); \
+    } while (false)
+
+#define CHECK_THROWS(p_Expression, p_Exception) \
+    do \
+    { \
+        try \
+        { \
+            (void) (p_Expression); \
+        } \
+        catch (const p_Exception&) \
+        { \
+            break; \
+        } \
+        throw TEST_FAILURE(#p_Expression " didn't throw " #p_Exception); \
+    } while (false)
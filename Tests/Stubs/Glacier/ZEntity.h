@@ -0,0 +1,54 @@
+#pragma once
+
+// Stands in for the SDK's ZEntity.h, which pulls in every engine function and hook, and with them DirectX.
+// Only declares what the editor code under test needs from an entity reference: its identity.
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+class ZEntityType;
+class ZEntityImpl;
+
+class ZEntityRef
+{
+public:
+    ZEntityType** m_pEntity = nullptr;
+
+public:
+    ZEntityRef()
+    {
+    }
+
+    ZEntityRef(ZEntityType** p_EntityRef) :
+        m_pEntity(p_EntityRef)
+    {
+    }
+
+    bool operator==(const ZEntityRef& p_Other) const
+    {
+        return GetEntity() == p_Other.GetEntity();
+    }
+
+    operator bool() const
+    {
+        return GetEntity() != nullptr;
+    }
+
+    ZEntityImpl* GetEntity() const
+    {
+        if (!m_pEntity)
+            return nullptr;
+
+        auto s_RealPtr = reinterpret_cast<uintptr_t>(m_pEntity) - sizeof(uintptr_t);
+        return reinterpret_cast<ZEntityImpl*>(s_RealPtr);
+    }
+};
+
+template <>
+struct std::hash<ZEntityRef>
+{
+    size_t operator()(const ZEntityRef& p_Ref) const noexcept
+    {
+        return reinterpret_cast<uintptr_t>(p_Ref.GetEntity());
+    }
+};
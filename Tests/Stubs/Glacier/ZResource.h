@@ -0,0 +1,31 @@
+#pragma once
+
+// Stands in for the SDK's ZResource.h, which pulls in every engine function and hook, and with them DirectX.
+// Only declares the parts of it that ZBinaryDeserializer uses, so tests can set up a resource container of their own.
+#include <Globals.h>
+#include <Glacier/TArray.h>
+#include <Glacier/ZResourceID.h>
+#include <Glacier/ZTypeRegistry.h>
+
+class ZResourceIndex
+{
+public:
+    ZResourceIndex(int val) : val(val)
+    {
+
+    }
+
+    int val;
+};
+
+class ZResourceContainer
+{
+public:
+    struct SResourceInfo
+    {
+        ZRuntimeResourceID rid;
+    };
+
+public:
+    TArray<SResourceInfo> m_resources;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+// Stands in for Windows.h when the tests are built on other platforms, declaring just enough of it (and of the
+// MSVC extensions that the SDK headers use) for the parts of the SDK that the tests compile.
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#define __declspec(p_Attribute)
+#define __int64 long long
+#define __FUNCSIG__ __PRETTY_FUNCTION__
+#define sscanf_s sscanf
+#define sprintf_s snprintf
+
+using std::max;
+using std::min;
+
+struct SRWLOCK
+{
+    void* Ptr;
+};
+
+inline void AcquireSRWLockShared(SRWLOCK*) {}
+inline void ReleaseSRWLockShared(SRWLOCK*) {}
+inline void AcquireSRWLockExclusive(SRWLOCK*) {}
+inline void ReleaseSRWLockExclusive(SRWLOCK*) {}
@@ -0,0 +1,13 @@
+#pragma once
+
+// Stands in for MSVC's intrin.h. Only __rdtsc is needed, which GCC and Clang declare in x86intrin.h.
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+
+inline unsigned long long __rdtsc()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+#endif
@@ -0,0 +1,4 @@
+#pragma once
+
+// min and max are provided by the Windows.h stand-in.
+#include "Windows.h"
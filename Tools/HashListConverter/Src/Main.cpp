@@ -0,0 +1,277 @@
+#include <IO/ZHashList.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct HashListEntry
+{
+    uint64_t Id;
+    std::string_view Path;
+};
+
+static bool ParseHashListLine(std::string_view p_Line, HashListEntry& p_Entry)
+{
+    // Lines look like "00123456789ABCDE.TEMP,[assembly:/path/to/resource.entitytemplate].pc_entitytype".
+    if (!p_Line.empty() && p_Line.back() == '\r')
+        p_Line.remove_suffix(1);
+
+    const size_t s_CommaIndex = p_Line.find(',');
+
+    if (s_CommaIndex == std::string_view::npos)
+        return false;
+
+    const std::string_view s_Hash = p_Line.substr(0, (std::min)(p_Line.find('.'), s_CommaIndex));
+
+    if (s_Hash.empty() || s_Hash.size() > 16)
+        return false;
+
+    uint64_t s_Id = 0;
+
+    for (const char s_Char : s_Hash)
+    {
+        uint64_t s_Digit;
+
+        if (s_Char >= '0' && s_Char <= '9')
+            s_Digit = s_Char - '0';
+        else if (s_Char >= 'a' && s_Char <= 'f')
+            s_Digit = s_Char - 'a' + 10;
+        else if (s_Char >= 'A' && s_Char <= 'F')
+            s_Digit = s_Char - 'A' + 10;
+        else
+            return false;
+
+        s_Id = (s_Id << 4) | s_Digit;
+    }
+
+    p_Entry.Id = s_Id;
+    p_Entry.Path = p_Line.substr(s_CommaIndex + 1);
+
+    return true;
+}
+
+// Builds a minimal perfect hash using hash-and-displace: keys are split into buckets, and buckets are placed
+// largest first by searching for a pilot value that maps all of their keys to free slots.
+static bool BuildPerfectHash(const std::vector<HashListEntry>& p_Entries, std::vector<uint32_t>& p_Pilots, std::vector<uint32_t>& p_Slots)
+{
+    const uint64_t s_EntryCount = p_Entries.size();
+    const uint64_t s_BucketCount = std::max<uint64_t>(1, s_EntryCount / 4);
+
+    std::vector<std::vector<uint32_t>> s_Buckets(s_BucketCount);
+
+    for (uint32_t i = 0; i < s_EntryCount; ++i)
+        s_Buckets[ZHashListHash::Bucket(p_Entries[i].Id, s_BucketCount)].push_back(i);
+
+    std::vector<uint32_t> s_BucketOrder(s_BucketCount);
+    std::iota(s_BucketOrder.begin(), s_BucketOrder.end(), 0);
+    std::stable_sort(s_BucketOrder.begin(), s_BucketOrder.end(), [&](uint32_t a, uint32_t b) {
+        return s_Buckets[a].size() > s_Buckets[b].size();
+    });
+
+    p_Pilots.assign(s_BucketCount, 0);
+    p_Slots.assign(s_EntryCount, UINT32_MAX);
+
+    std::vector<uint64_t> s_CandidateSlots;
+
+    for (const uint32_t s_BucketIndex : s_BucketOrder)
+    {
+        const auto& s_Bucket = s_Buckets[s_BucketIndex];
+
+        if (s_Bucket.empty())
+            break;
+
+        bool s_Placed = false;
+
+        for (uint32_t s_Pilot = 0; s_Pilot < UINT32_MAX && !s_Placed; ++s_Pilot)
+        {
+            s_CandidateSlots.clear();
+
+            bool s_Collides = false;
+
+            for (const uint32_t s_EntryIndex : s_Bucket)
+            {
+                const uint64_t s_Slot = ZHashListHash::Slot(p_Entries[s_EntryIndex].Id, s_Pilot, s_EntryCount);
+
+                if (p_Slots[s_Slot] != UINT32_MAX ||
+                    std::find(s_CandidateSlots.begin(), s_CandidateSlots.end(), s_Slot) != s_CandidateSlots.end())
+                {
+                    s_Collides = true;
+                    break;
+                }
+
+                s_CandidateSlots.push_back(s_Slot);
+            }
+
+            if (s_Collides)
+                continue;
+
+            for (size_t i = 0; i < s_Bucket.size(); ++i)
+                p_Slots[s_CandidateSlots[i]] = s_Bucket[i];
+
+            p_Pilots[s_BucketIndex] = s_Pilot;
+            s_Placed = true;
+        }
+
+        if (!s_Placed)
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+static void WriteSection(std::ofstream& p_Stream, const std::vector<T>& p_Data, uint64_t& p_Offset)
+{
+    static constexpr char c_Padding[8] = {};
+
+    const auto s_Position = static_cast<uint64_t>(p_Stream.tellp());
+    const uint64_t s_Misalign = s_Position % 8;
+
+    if (s_Misalign != 0)
+        p_Stream.write(c_Padding, 8 - s_Misalign);
+
+    p_Offset = static_cast<uint64_t>(p_Stream.tellp());
+    p_Stream.write(reinterpret_cast<const char*>(p_Data.data()), p_Data.size() * sizeof(T));
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <hash_list.txt> <output.hhl> [-no_mph]" << std::endl;
+        return 1;
+    }
+
+    const std::string s_InputPath = argv[1];
+    const std::string s_OutputPath = argv[2];
+    const bool s_BuildPerfectHash = !(argc > 3 && !strcmp(argv[3], "-no_mph"));
+
+    const auto s_StartTime = std::chrono::steady_clock::now();
+
+    ZMappedFile s_InputFile(s_InputPath);
+
+    if (!s_InputFile.IsOpen())
+    {
+        std::cerr << "Could not open input file " << s_InputPath << std::endl;
+        return 1;
+    }
+
+    const std::string_view s_Input(static_cast<const char*>(s_InputFile.GetData()), s_InputFile.GetSize());
+
+    std::vector<HashListEntry> s_Entries;
+    s_Entries.reserve(s_Input.size() / 96);
+
+    // Lines that don't parse as an entry (like the header) are skipped.
+    for (size_t s_LineStart = 0; s_LineStart < s_Input.size();)
+    {
+        size_t s_LineEnd = s_Input.find('\n', s_LineStart);
+
+        if (s_LineEnd == std::string_view::npos)
+            s_LineEnd = s_Input.size();
+
+        HashListEntry s_Entry;
+
+        if (ParseHashListLine(s_Input.substr(s_LineStart, s_LineEnd - s_LineStart), s_Entry))
+            s_Entries.push_back(s_Entry);
+
+        s_LineStart = s_LineEnd + 1;
+    }
+
+    // Sort by id, keeping the first occurrence of duplicate ids.
+    std::stable_sort(s_Entries.begin(), s_Entries.end(), [](const HashListEntry& a, const HashListEntry& b) {
+        return a.Id < b.Id;
+    });
+
+    s_Entries.erase(std::unique(s_Entries.begin(), s_Entries.end(), [](const HashListEntry& a, const HashListEntry& b) {
+        return a.Id == b.Id;
+    }), s_Entries.end());
+
+    std::vector<uint64_t> s_Ids;
+    std::vector<uint32_t> s_PathOffsets;
+    std::vector<char> s_StringPool;
+    std::unordered_map<std::string_view, uint32_t> s_PooledStrings;
+
+    s_Ids.reserve(s_Entries.size());
+    s_PathOffsets.reserve(s_Entries.size());
+    s_PooledStrings.reserve(s_Entries.size());
+
+    for (const auto& s_Entry : s_Entries)
+    {
+        auto [s_It, s_Inserted] = s_PooledStrings.try_emplace(s_Entry.Path, static_cast<uint32_t>(s_StringPool.size()));
+
+        if (s_Inserted)
+        {
+            if (s_StringPool.size() + s_Entry.Path.size() + 1 > UINT32_MAX)
+            {
+                std::cerr << "String pool exceeds 4 GiB." << std::endl;
+                return 1;
+            }
+
+            s_StringPool.insert(s_StringPool.end(), s_Entry.Path.begin(), s_Entry.Path.end());
+            s_StringPool.push_back('\0');
+        }
+
+        s_Ids.push_back(s_Entry.Id);
+        s_PathOffsets.push_back(s_It->second);
+    }
+
+    std::vector<uint32_t> s_Pilots;
+    std::vector<uint32_t> s_Slots;
+
+    if (s_BuildPerfectHash && !s_Entries.empty() && !BuildPerfectHash(s_Entries, s_Pilots, s_Slots))
+    {
+        std::cerr << "Could not build a perfect hash, falling back to binary search lookups." << std::endl;
+
+        s_Pilots.clear();
+        s_Slots.clear();
+    }
+
+    std::ofstream s_OutputFile(s_OutputPath, std::ios::binary | std::ios::trunc);
+
+    if (!s_OutputFile)
+    {
+        std::cerr << "Could not open output file " << s_OutputPath << std::endl;
+        return 1;
+    }
+
+    SHashListHeader s_Header {};
+    s_Header.magic = SHashListHeader::c_Magic;
+    s_Header.version = SHashListHeader::c_Version;
+    s_Header.entryCount = s_Ids.size();
+    s_Header.bucketCount = s_Pilots.size();
+    s_Header.stringPoolSize = s_StringPool.size();
+
+    // Write a placeholder header first and patch it once all section offsets are known.
+    s_OutputFile.write(reinterpret_cast<const char*>(&s_Header), sizeof(s_Header));
+
+    WriteSection(s_OutputFile, s_Ids, s_Header.idsOffset);
+    WriteSection(s_OutputFile, s_PathOffsets, s_Header.pathOffsetsOffset);
+    WriteSection(s_OutputFile, s_Pilots, s_Header.pilotsOffset);
+    WriteSection(s_OutputFile, s_Slots, s_Header.slotsOffset);
+    WriteSection(s_OutputFile, s_StringPool, s_Header.stringPoolOffset);
+
+    s_OutputFile.seekp(0);
+    s_OutputFile.write(reinterpret_cast<const char*>(&s_Header), sizeof(s_Header));
+    s_OutputFile.close();
+
+    if (!s_OutputFile)
+    {
+        std::cerr << "Could not write output file " << s_OutputPath << std::endl;
+        return 1;
+    }
+
+    const auto s_ElapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - s_StartTime);
+
+    std::cout << "Wrote " << s_Ids.size() << " entries (" << s_PooledStrings.size() << " unique paths, "
+        << s_StringPool.size() << " bytes of strings" << (s_Pilots.empty() ? "" : ", perfect hash")
+        << ") to " << s_OutputPath << " in " << s_ElapsedTime.count() << "ms." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,335 @@
+#include <PinTrace.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Inter-arrival times are bucketed by powers of two microseconds, from below 1us up to 2^c_HistogramBuckets us.
+constexpr size_t c_HistogramBuckets = 24;
+
+struct AnalyzerOptions
+{
+    size_t Top = 20;
+    size_t Histograms = 5;
+    uint64_t WindowUs = 100;
+};
+
+// A pin of an entity, in one direction.
+struct PinEndpoint
+{
+    uint32_t Entity;
+    uint32_t Pin;
+    bool Output;
+
+    bool operator==(const PinEndpoint& p_Other) const = default;
+};
+
+struct PinEndpointHash
+{
+    size_t operator()(const PinEndpoint& p_Endpoint) const
+    {
+        return std::hash<uint64_t>()(static_cast<uint64_t>(p_Endpoint.Entity) << 33 | static_cast<uint64_t>(p_Endpoint.Pin) << 1 | p_Endpoint.Output);
+    }
+};
+
+struct CausalLink
+{
+    PinEndpoint Cause;
+    PinEndpoint Effect;
+
+    bool operator==(const CausalLink& p_Other) const = default;
+};
+
+struct CausalLinkHash
+{
+    size_t operator()(const CausalLink& p_Link) const
+    {
+        return PinEndpointHash()(p_Link.Cause) * 0x9e3779b97f4a7c15ull ^ PinEndpointHash()(p_Link.Effect);
+    }
+};
+
+struct PinStats
+{
+    uint64_t Count = 0;
+    uint64_t LastTime = 0;
+    std::array<uint64_t, c_HistogramBuckets + 1> InterArrival {};
+};
+
+struct TraceStats
+{
+    uint64_t Signals = 0;
+    uint64_t FirstTime = UINT64_MAX;
+    uint64_t LastTime = 0;
+
+    // Keyed by pin index and direction.
+    std::unordered_map<uint64_t, PinStats> Pins;
+    std::vector<uint64_t> Entities;
+    std::unordered_map<CausalLink, uint64_t, CausalLinkHash> Links;
+};
+
+static uint64_t GetPinKey(uint32_t p_Pin, bool p_Output)
+{
+    return static_cast<uint64_t>(p_Pin) << 1 | p_Output;
+}
+
+static size_t GetHistogramBucket(uint64_t p_Nanoseconds)
+{
+    size_t s_Bucket = 0;
+
+    for (uint64_t s_Limit = 1000; s_Bucket < c_HistogramBuckets && p_Nanoseconds >= s_Limit; s_Limit <<= 1)
+        ++s_Bucket;
+
+    return s_Bucket;
+}
+
+static std::string FormatPin(const PinTrace::Reader& p_Reader, uint32_t p_Pin, bool p_Output)
+{
+    const auto& s_Pin = p_Reader.GetPins()[p_Pin];
+    std::ostringstream s_Stream;
+
+    s_Stream << (p_Output ? "out " : "in  ");
+
+    if (s_Pin.Name.empty())
+        s_Stream << std::hex << static_cast<uint32_t>(s_Pin.Id);
+    else
+        s_Stream << s_Pin.Name;
+
+    return s_Stream.str();
+}
+
+static std::string FormatEntity(const PinTrace::Reader& p_Reader, uint32_t p_Entity)
+{
+    const auto& s_Entity = p_Reader.GetEntities()[p_Entity];
+
+    if (s_Entity.Id == 0 && s_Entity.Name.empty())
+        return "<not in entity tree>";
+
+    std::ostringstream s_Stream;
+    s_Stream << std::hex << std::setfill('0') << std::setw(16) << s_Entity.Id << " " << s_Entity.Name << " [" << s_Entity.Type << "]";
+
+    return s_Stream.str();
+}
+
+static std::string FormatEndpoint(const PinTrace::Reader& p_Reader, const PinEndpoint& p_Endpoint)
+{
+    return FormatPin(p_Reader, p_Endpoint.Pin, p_Endpoint.Output) + " @ " + FormatEntity(p_Reader, p_Endpoint.Entity);
+}
+
+// Returns the keys of a map sorted by descending count, at most p_Count of them.
+template <typename T, typename CountFn>
+static std::vector<T> GetTop(const std::vector<T>& p_Keys, size_t p_Count, CountFn p_GetCount)
+{
+    std::vector<T> s_Keys = p_Keys;
+    const size_t s_Count = (std::min)(p_Count, s_Keys.size());
+
+    std::partial_sort(s_Keys.begin(), s_Keys.begin() + s_Count, s_Keys.end(), [&](const T& a, const T& b)
+    {
+        return p_GetCount(a) > p_GetCount(b);
+    });
+
+    s_Keys.resize(s_Count);
+    return s_Keys;
+}
+
+static void Analyze(PinTrace::Reader& p_Reader, const AnalyzerOptions& p_Options, TraceStats& p_Stats)
+{
+    const uint64_t s_Window = p_Options.WindowUs * 1000;
+
+    // The latest output signal, which inputs signalled within the window after it are attributed to.
+    std::optional<std::pair<uint64_t, PinEndpoint>> s_LastOutput;
+
+    PinTrace::Signal s_Signal;
+
+    while (p_Reader.ReadSignal(s_Signal))
+    {
+        ++p_Stats.Signals;
+        p_Stats.FirstTime = (std::min)(p_Stats.FirstTime, s_Signal.Time);
+        p_Stats.LastTime = (std::max)(p_Stats.LastTime, s_Signal.Time);
+
+        auto& s_Pin = p_Stats.Pins[GetPinKey(s_Signal.Pin, s_Signal.Output)];
+
+        // Signals from different threads can be slightly out of order. Those count as arriving at the same time.
+        if (s_Pin.Count > 0)
+            ++s_Pin.InterArrival[GetHistogramBucket(s_Signal.Time > s_Pin.LastTime ? s_Signal.Time - s_Pin.LastTime : 0)];
+
+        ++s_Pin.Count;
+        s_Pin.LastTime = (std::max)(s_Pin.LastTime, s_Signal.Time);
+
+        if (p_Stats.Entities.size() <= s_Signal.Entity)
+            p_Stats.Entities.resize(s_Signal.Entity + 1);
+
+        ++p_Stats.Entities[s_Signal.Entity];
+
+        const PinEndpoint s_Endpoint { s_Signal.Entity, s_Signal.Pin, s_Signal.Output };
+
+        if (s_Signal.Output)
+        {
+            s_LastOutput.emplace(s_Signal.Time, s_Endpoint);
+        }
+        else if (s_LastOutput && s_LastOutput->first + s_Window >= s_Signal.Time)
+        {
+            // Output pins signal the input pins they're connected to right away, so the latest output
+            // within the window is taken to be what caused this input.
+            ++p_Stats.Links[{ s_LastOutput->second, s_Endpoint }];
+        }
+    }
+}
+
+static void PrintReport(const PinTrace::Reader& p_Reader, const AnalyzerOptions& p_Options, const TraceStats& p_Stats)
+{
+    const double s_Duration = p_Stats.Signals > 1 ? (p_Stats.LastTime - p_Stats.FirstTime) / 1e9 : 0.0;
+
+    std::cout << p_Stats.Signals << " signals over " << std::fixed << std::setprecision(3) << s_Duration << "s, "
+        << p_Reader.GetEntities().size() << " entities, " << p_Reader.GetPins().size() << " pins." << std::endl;
+
+    if (p_Reader.IsTruncated())
+        std::cout << "The trace ends in the middle of a record. It was probably still being recorded." << std::endl;
+
+    std::vector<uint64_t> s_PinKeys;
+
+    for (const auto& [s_Key, s_Pin] : p_Stats.Pins)
+        s_PinKeys.push_back(s_Key);
+
+    const auto s_GetPinCount = [&](uint64_t p_Key) { return p_Stats.Pins.at(p_Key).Count; };
+    const auto s_TopPins = GetTop(s_PinKeys, (std::max)(p_Options.Top, p_Options.Histograms), s_GetPinCount);
+
+    std::cout << std::endl << "Most signalled pins:" << std::endl;
+
+    for (size_t i = 0; i < s_TopPins.size() && i < p_Options.Top; ++i)
+    {
+        const auto& s_Pin = p_Stats.Pins.at(s_TopPins[i]);
+        const double s_Rate = s_Duration > 0.0 ? s_Pin.Count / s_Duration : 0.0;
+
+        std::cout << std::setw(12) << s_Pin.Count << std::setw(12) << std::setprecision(1) << s_Rate << "/s  "
+            << FormatPin(p_Reader, static_cast<uint32_t>(s_TopPins[i] >> 1), s_TopPins[i] & 1) << std::endl;
+    }
+
+    std::vector<uint32_t> s_EntityKeys(p_Stats.Entities.size());
+
+    for (uint32_t i = 0; i < s_EntityKeys.size(); ++i)
+        s_EntityKeys[i] = i;
+
+    const auto s_TopEntities = GetTop(s_EntityKeys, p_Options.Top, [&](uint32_t p_Entity) { return p_Stats.Entities[p_Entity]; });
+
+    std::cout << std::endl << "Most active entities:" << std::endl;
+
+    for (const auto s_Entity : s_TopEntities)
+    {
+        const double s_Rate = s_Duration > 0.0 ? p_Stats.Entities[s_Entity] / s_Duration : 0.0;
+
+        std::cout << std::setw(12) << p_Stats.Entities[s_Entity] << std::setw(12) << std::setprecision(1) << s_Rate << "/s  "
+            << FormatEntity(p_Reader, s_Entity) << std::endl;
+    }
+
+    for (size_t i = 0; i < s_TopPins.size() && i < p_Options.Histograms; ++i)
+    {
+        const auto& s_Pin = p_Stats.Pins.at(s_TopPins[i]);
+        const uint64_t s_MaxBucket = *std::max_element(s_Pin.InterArrival.begin(), s_Pin.InterArrival.end());
+
+        std::cout << std::endl << "Time between signals of " << FormatPin(p_Reader, static_cast<uint32_t>(s_TopPins[i] >> 1), s_TopPins[i] & 1) << ":" << std::endl;
+
+        if (s_MaxBucket == 0)
+        {
+            std::cout << "  (signalled once)" << std::endl;
+            continue;
+        }
+
+        for (size_t s_Bucket = 0; s_Bucket <= c_HistogramBuckets; ++s_Bucket)
+        {
+            const uint64_t s_Count = s_Pin.InterArrival[s_Bucket];
+
+            if (s_Count == 0)
+                continue;
+
+            std::ostringstream s_Label;
+
+            if (s_Bucket == 0)
+                s_Label << "< 1us";
+            else if (s_Bucket == c_HistogramBuckets)
+                s_Label << ">= " << (1ull << (s_Bucket - 1)) << "us";
+            else
+                s_Label << (1ull << (s_Bucket - 1)) << "-" << (1ull << s_Bucket) << "us";
+
+            std::cout << "  " << std::setw(18) << s_Label.str() << std::setw(12) << s_Count << " "
+                << std::string(s_Count * 40 / s_MaxBucket, '#') << std::endl;
+        }
+    }
+
+    std::vector<CausalLink> s_LinkKeys;
+
+    for (const auto& [s_Link, s_Count] : p_Stats.Links)
+        s_LinkKeys.push_back(s_Link);
+
+    const auto s_TopLinks = GetTop(s_LinkKeys, p_Options.Top, [&](const CausalLink& p_Link) { return p_Stats.Links.at(p_Link); });
+
+    std::cout << std::endl << "Most common causal chains (input within " << p_Options.WindowUs << "us of an output):" << std::endl;
+
+    for (const auto& s_Link : s_TopLinks)
+    {
+        std::cout << std::setw(12) << p_Stats.Links.at(s_Link) << "  " << FormatEndpoint(p_Reader, s_Link.Cause) << std::endl
+            << std::string(14, ' ') << "-> " << FormatEndpoint(p_Reader, s_Link.Effect) << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace.zept> [-top <count>] [-histograms <count>] [-window <us>]" << std::endl;
+        std::cerr << "  -top         How many pins, entities and causal chains to list. Defaults to 20." << std::endl;
+        std::cerr << "  -histograms  How many of the most signalled pins to show inter-arrival histograms for. Defaults to 5." << std::endl;
+        std::cerr << "  -window      How soon after an output pin an input pin has to be signalled to count as caused by it, in microseconds. Defaults to 100." << std::endl;
+        return 1;
+    }
+
+    AnalyzerOptions s_Options;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        if (i + 1 == argc)
+        {
+            std::cerr << "Missing value for " << argv[i] << std::endl;
+            return 1;
+        }
+
+        const uint64_t s_Value = std::strtoull(argv[i + 1], nullptr, 10);
+
+        if (!strcmp(argv[i], "-top"))
+            s_Options.Top = s_Value;
+        else if (!strcmp(argv[i], "-histograms"))
+            s_Options.Histograms = s_Value;
+        else if (!strcmp(argv[i], "-window"))
+            s_Options.WindowUs = s_Value;
+        else
+        {
+            std::cerr << "Unknown option " << argv[i] << std::endl;
+            return 1;
+        }
+
+        ++i;
+    }
+
+    try
+    {
+        PinTrace::Reader s_Reader(argv[1]);
+        TraceStats s_Stats;
+
+        Analyze(s_Reader, s_Options, s_Stats);
+        PrintReport(s_Reader, s_Options, s_Stats);
+    }
+    catch (const std::exception& p_Exception)
+    {
+        std::cerr << p_Exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
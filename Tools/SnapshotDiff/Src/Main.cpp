@@ -0,0 +1,210 @@
+#include <SceneSnapshot.h>
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+// Property values longer than this are cut off in the output, unless -full is passed.
+constexpr size_t c_MaxValueLength = 200;
+
+struct DiffOptions
+{
+    bool SummaryOnly = false;
+    bool FullValues = false;
+};
+
+struct DiffStats
+{
+    uint64_t Added = 0;
+    uint64_t Removed = 0;
+    uint64_t Changed = 0;
+    uint64_t Unchanged = 0;
+};
+
+static std::string FormatEntity(const SceneSnapshot::Entity& p_Entity)
+{
+    std::ostringstream s_Stream;
+
+    s_Stream << std::hex << std::setfill('0') << std::setw(16) << p_Entity.Id
+        << " (tblu " << std::setw(16) << p_Entity.Tblu << ") "
+        << p_Entity.Name << " [" << p_Entity.Type << "]";
+
+    return s_Stream.str();
+}
+
+static std::string FormatValue(std::string_view p_Value, const DiffOptions& p_Options)
+{
+    if (p_Options.FullValues || p_Value.size() <= c_MaxValueLength)
+        return std::string(p_Value);
+
+    return std::string(p_Value.substr(0, c_MaxValueLength)) + "...";
+}
+
+static std::string FormatVector(const std::array<float, 3>& p_Vector)
+{
+    std::ostringstream s_Stream;
+    s_Stream << "(" << p_Vector[0] << ", " << p_Vector[1] << ", " << p_Vector[2] << ")";
+    return s_Stream.str();
+}
+
+// Prints what changed between two versions of an entity. Returns false if nothing did.
+static bool DiffEntity(const SceneSnapshot::Entity& p_Before, const SceneSnapshot::Entity& p_After, const DiffOptions& p_Options)
+{
+    std::ostringstream s_Changes;
+
+    if (p_Before.Name != p_After.Name)
+        s_Changes << "    name: " << p_Before.Name << " -> " << p_After.Name << "\n";
+
+    if (p_Before.Type != p_After.Type)
+        s_Changes << "    type: " << p_Before.Type << " -> " << p_After.Type << "\n";
+
+    if (p_Before.Transform.has_value() != p_After.Transform.has_value())
+    {
+        s_Changes << "    transform: " << (p_Before.Transform ? "set" : "none") << " -> " << (p_After.Transform ? "set" : "none") << "\n";
+    }
+    else if (p_Before.Transform)
+    {
+        const auto& s_Before = *p_Before.Transform;
+        const auto& s_After = *p_After.Transform;
+
+        if (s_Before.Position != s_After.Position)
+            s_Changes << "    position: " << FormatVector(s_Before.Position) << " -> " << FormatVector(s_After.Position) << "\n";
+
+        if (s_Before.Rotation != s_After.Rotation)
+            s_Changes << "    rotation: " << FormatVector(s_Before.Rotation) << " -> " << FormatVector(s_After.Rotation) << "\n";
+
+        if (s_Before.Scale != s_After.Scale)
+            s_Changes << "    scale: " << FormatVector(s_Before.Scale) << " -> " << FormatVector(s_After.Scale) << "\n";
+    }
+
+    // Properties are sorted by id, so they can be matched up in a single pass like the entities.
+    const auto& s_BeforeProperties = p_Before.Properties;
+    const auto& s_AfterProperties = p_After.Properties;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < s_BeforeProperties.size() || j < s_AfterProperties.size())
+    {
+        if (j == s_AfterProperties.size() || (i < s_BeforeProperties.size() && s_BeforeProperties[i].Id < s_AfterProperties[j].Id))
+        {
+            s_Changes << "    - " << s_BeforeProperties[i].Name << "\n";
+            ++i;
+        }
+        else if (i == s_BeforeProperties.size() || s_AfterProperties[j].Id < s_BeforeProperties[i].Id)
+        {
+            s_Changes << "    + " << s_AfterProperties[j].Name << ": " << FormatValue(s_AfterProperties[j].JsonValue, p_Options) << "\n";
+            ++j;
+        }
+        else
+        {
+            const auto& s_Before = s_BeforeProperties[i++];
+            const auto& s_After = s_AfterProperties[j++];
+
+            if (s_Before.Type != s_After.Type || s_Before.JsonValue != s_After.JsonValue)
+            {
+                s_Changes << "    " << s_After.Name << ": " << FormatValue(s_Before.JsonValue, p_Options)
+                    << " -> " << FormatValue(s_After.JsonValue, p_Options) << "\n";
+            }
+        }
+    }
+
+    const auto s_ChangeText = s_Changes.str();
+
+    if (s_ChangeText.empty())
+        return false;
+
+    if (!p_Options.SummaryOnly)
+        std::cout << "~ " << FormatEntity(p_After) << "\n" << s_ChangeText;
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <before.zesn> <after.zesn> [-summary] [-full]" << std::endl;
+        std::cerr << "  -summary  Only print how many entities were added, removed and changed." << std::endl;
+        std::cerr << "  -full     Don't cut off long property values." << std::endl;
+        return 1;
+    }
+
+    DiffOptions s_Options;
+
+    for (int i = 3; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-summary"))
+            s_Options.SummaryOnly = true;
+        else if (!strcmp(argv[i], "-full"))
+            s_Options.FullValues = true;
+        else
+        {
+            std::cerr << "Unknown option " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    const auto s_StartTime = std::chrono::steady_clock::now();
+
+    DiffStats s_Stats;
+
+    try
+    {
+        SceneSnapshot::Reader s_BeforeReader(argv[1]);
+        SceneSnapshot::Reader s_AfterReader(argv[2]);
+
+        SceneSnapshot::Entity s_Before;
+        SceneSnapshot::Entity s_After;
+
+        bool s_HasBefore = s_BeforeReader.ReadEntity(s_Before);
+        bool s_HasAfter = s_AfterReader.ReadEntity(s_After);
+
+        // Both snapshots are sorted by id and tblu, so they can be merged like sorted lists.
+        // Entities that share an id and tblu are matched up in the order they were written.
+        while (s_HasBefore || s_HasAfter)
+        {
+            if (!s_HasAfter || (s_HasBefore && SceneSnapshot::EntityLess(s_Before, s_After)))
+            {
+                if (!s_Options.SummaryOnly)
+                    std::cout << "- " << FormatEntity(s_Before) << "\n";
+
+                ++s_Stats.Removed;
+                s_HasBefore = s_BeforeReader.ReadEntity(s_Before);
+            }
+            else if (!s_HasBefore || SceneSnapshot::EntityLess(s_After, s_Before))
+            {
+                if (!s_Options.SummaryOnly)
+                    std::cout << "+ " << FormatEntity(s_After) << "\n";
+
+                ++s_Stats.Added;
+                s_HasAfter = s_AfterReader.ReadEntity(s_After);
+            }
+            else
+            {
+                if (DiffEntity(s_Before, s_After, s_Options))
+                    ++s_Stats.Changed;
+                else
+                    ++s_Stats.Unchanged;
+
+                s_HasBefore = s_BeforeReader.ReadEntity(s_Before);
+                s_HasAfter = s_AfterReader.ReadEntity(s_After);
+            }
+        }
+    }
+    catch (const std::exception& p_Exception)
+    {
+        std::cerr << p_Exception.what() << std::endl;
+        return 1;
+    }
+
+    const auto s_ElapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - s_StartTime);
+
+    std::cout << s_Stats.Added << " added, " << s_Stats.Removed << " removed, " << s_Stats.Changed << " changed, "
+        << s_Stats.Unchanged << " unchanged (" << s_ElapsedTime.count() << "ms)." << std::endl;
+
+    return 0;
+}
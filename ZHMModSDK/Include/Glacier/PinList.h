@@ -0,0 +1,1798 @@
+// The names and ids of known pins, in the form ZHM_PIN(Name, Id).
+// Included with ZHM_PIN defined by Pins.h, to declare ZHMPin, and by the pin registry, to build the table of pin names,
+// so both stay in sync. Intentionally has no include guard.
+ZHM_PIN(AI_Info_Displayed, 568878519)
+ZHM_PIN(Aborted, -506102458)
+ZHM_PIN(Abs, 282990406)
+ZHM_PIN(Accident, 1984411961)
+ZHM_PIN(AccidentKill, -420903384)
+ZHM_PIN(ActEvent4001, 707117500)
+ZHM_PIN(ActEvent4002, -1288925178)
+ZHM_PIN(ActEvent4003, -1003773808)
+ZHM_PIN(ActEvent4004, 1515140403)
+ZHM_PIN(ActEvent4005, 759694757)
+ZHM_PIN(ActEvent4006, -1270787041)
+ZHM_PIN(ActEvent4007, -1018796919)
+ZHM_PIN(Activate, 1326475003)
+ZHM_PIN(Activated, -1292013250)
+ZHM_PIN(ActivatedInputAction, 1690786288)
+ZHM_PIN(ActivatedVoid, -1275873675)
+ZHM_PIN(ActiveRegionChanged, -1471011051)
+ZHM_PIN(ActiveStage, 912576881)
+ZHM_PIN(Actor, -2051769859)
+ZHM_PIN(ActorBeingDumped, -2053706475)
+ZHM_PIN(ActorBeingPushed, -1088258052)
+ZHM_PIN(ActorBotherBody, -628534001)
+ZHM_PIN(ActorBotherHead, -1496143839)
+ZHM_PIN(ActorBotherIActor, 1563894)
+ZHM_PIN(ActorBotherPos, 2062966253)
+ZHM_PIN(ActorEntered, -1435515932)
+ZHM_PIN(ActorExited, 1213618955)
+ZHM_PIN(ActorId, -1569288146)
+ZHM_PIN(ActorKillBody, -1827480325)
+ZHM_PIN(ActorKillHead, -280419883)
+ZHM_PIN(ActorKillIActor, -459044272)
+ZHM_PIN(ActorKillPos, -2009537525)
+ZHM_PIN(ActorName, -867807090)
+ZHM_PIN(ActorPacifyBody, 274575217)
+ZHM_PIN(ActorPacifyHead, 1812353631)
+ZHM_PIN(ActorPacifyIActor, -322741928)
+ZHM_PIN(ActorPacifyPos, 349088028)
+ZHM_PIN(ActorPosition, 1520008257)
+ZHM_PIN(ActorSlapBody, 2012917919)
+ZHM_PIN(ActorSlapHead, 195120561)
+ZHM_PIN(ActorSlapIActor, -1590235800)
+ZHM_PIN(ActorSlapPos, 1855687559)
+ZHM_PIN(ActorType, 515602849)
+ZHM_PIN(AddedEntity, -92920395)
+ZHM_PIN(AddedKeyword, -1576697549)
+ZHM_PIN(AddedSignal, -2142047192)
+ZHM_PIN(AddedToPhysicsWorld, -522922342)
+ZHM_PIN(AgilityEnter, 2070210711)
+ZHM_PIN(AgilityIsLanding, 520726377)
+ZHM_PIN(AgilityIsMoving, 63625238)
+ZHM_PIN(AgilityLeave, 1503963177)
+ZHM_PIN(AgilityStart, 1567456630)
+ZHM_PIN(AgilityStop, 2055292938)
+ZHM_PIN(AimLookAt, -267339999)
+ZHM_PIN(Alert, -700683835)
+ZHM_PIN(AlertHigh, 1273080814)
+ZHM_PIN(AlertableActorOnScreen, 1674391351)
+ZHM_PIN(AlertableGuardOnScreen, -232332836)
+ZHM_PIN(AllBodiesHidden, -625856522)
+ZHM_PIN(AllPacifiedHidden, -10159224)
+ZHM_PIN(AllTargetsKilled, 1380215166)
+ZHM_PIN(AllTestsFinished, -539270975)
+ZHM_PIN(Alpha, 287381102)
+ZHM_PIN(Ambient, -1934828716)
+ZHM_PIN(AmmoPickup, -29460971)
+ZHM_PIN(AngleLookAt, 798120869)
+ZHM_PIN(AnimationPose, -1303585406)
+ZHM_PIN(Any, 1556001108)
+ZHM_PIN(Armed, 1893567523)
+ZHM_PIN(Arrest, 713307401)
+ZHM_PIN(AttackElbow, 1815403015)
+ZHM_PIN(AttackKick, -985146747)
+ZHM_PIN(AttackKnee, 1911178881)
+ZHM_PIN(AttentionMax, 534919292)
+ZHM_PIN(AttentionMaxPan, 1096896415)
+ZHM_PIN(AttentionOSDVisible, -86883465)
+ZHM_PIN(AttentionOff, -1456977994)
+ZHM_PIN(AttentionOn, -1789387362)
+ZHM_PIN(Attenuation, 2041014083)
+ZHM_PIN(AudibleAttentionMax, -1294148096)
+ZHM_PIN(AudibleAttentionMaxPan, -707815481)
+ZHM_PIN(AudioDone, 292280943)
+ZHM_PIN(AxisValue, -648446021)
+ZHM_PIN(BackCarriesItem, 1763896352)
+ZHM_PIN(BackwardVector, -315490537)
+ZHM_PIN(Barrel, -1647496575)
+ZHM_PIN(BeingFrisked, 2134761969)
+ZHM_PIN(BlendInActivated, -1555144145)
+ZHM_PIN(BlendInStart, 1903821738)
+ZHM_PIN(BlendInStop, -1268703308)
+ZHM_PIN(BloodPoolFound, -1962991728)
+ZHM_PIN(BodyBagPlaced, 185888315)
+ZHM_PIN(BodyDraggingSeen, -1878551637)
+ZHM_PIN(BodyFall, 1860519465)
+ZHM_PIN(BodyFound, 455064232)
+ZHM_PIN(BodyFoundAccident, 1851409203)
+ZHM_PIN(BodyFoundMurder, -1402020903)
+ZHM_PIN(BodyFoundPacify, -624635332)
+ZHM_PIN(BodyFoundPacifyId, 831738673)
+ZHM_PIN(BodyHidden, -377649393)
+ZHM_PIN(BodyInContainer, -650145594)
+ZHM_PIN(BodyOverRail, -1666588721)
+ZHM_PIN(Bodyshot, -1635729760)
+ZHM_PIN(BoneBreak, -1752585046)
+ZHM_PIN(BoneWeight, 1465110913)
+ZHM_PIN(BoxSize, 139393511)
+ZHM_PIN(BreakWeaponOnTarget, -803763413)
+ZHM_PIN(BulletFlyByHitman, -836715060)
+ZHM_PIN(BundleDestroyed, -699983294)
+ZHM_PIN(ButtonHoldComplete, 5742987)
+ZHM_PIN(ButtonHoldFraction, -1133515826)
+ZHM_PIN(ButtonHoldStart, -1593238588)
+ZHM_PIN(ButtonHoldTerminated, -992282053)
+ZHM_PIN(ButtonPressed, -802475407)
+ZHM_PIN(CC_AttackWindow_End, 524274499)
+ZHM_PIN(CC_AttackWindow_Start, 177582941)
+ZHM_PIN(CC_Break_Neck_NPC, -55375540)
+ZHM_PIN(CC_Choice, 73173307)
+ZHM_PIN(CC_End, 1942177871)
+ZHM_PIN(CC_End_Escape, 1560298195)
+ZHM_PIN(CC_End_Loose, 1826571955)
+ZHM_PIN(CC_End_Win, 1372148852)
+ZHM_PIN(CC_Failed, 1534882014)
+ZHM_PIN(CC_Fiber_Wire_Impact, -326007876)
+ZHM_PIN(CC_Final_Impact, 1329099068)
+ZHM_PIN(CC_Impact_Counter, -2116129107)
+ZHM_PIN(CC_Impact_Hitman, -1878461629)
+ZHM_PIN(CC_Impact_NPC, -743660826)
+ZHM_PIN(CC_Impact_NormalAttack, 1671095440)
+ZHM_PIN(CC_Miss, 946268862)
+ZHM_PIN(CC_Miss_Take_Down, -603469329)
+ZHM_PIN(CC_PerfectAttackActivated, -1069575058)
+ZHM_PIN(CC_PerfectAttackDeactivated, -2046375193)
+ZHM_PIN(CC_Prop_Kill_Back, -42667390)
+ZHM_PIN(CC_SlowdownWindow_End, -503263315)
+ZHM_PIN(CC_SlowdownWindow_Start, -855288807)
+ZHM_PIN(CC_Slowdown_Counter, 1692758668)
+ZHM_PIN(CC_Slowdown_Faction, 650341732)
+ZHM_PIN(CC_Slowdown_Takedown, -724124110)
+ZHM_PIN(CC_Start, -762232265)
+ZHM_PIN(CC_Start_AttackChain, -120500516)
+ZHM_PIN(CC_Start_Hitman, 34204949)
+ZHM_PIN(CC_Start_NPC, -2094678967)
+ZHM_PIN(CC_Strangle_Button, 808929138)
+ZHM_PIN(CC_Strangle_Fraction, -1100547987)
+ZHM_PIN(CC_Success, -1060162771)
+ZHM_PIN(CC_TakedownWindowHigh_Start, -1871263203)
+ZHM_PIN(CC_TakedownWindowLow_Start, 1240199351)
+ZHM_PIN(CC_TakedownWindow_End, 692388994)
+ZHM_PIN(CC_Time_Multiplier, 1127499902)
+ZHM_PIN(CPDoorOpen, 1808439326)
+ZHM_PIN(CanNotOpenCPDoor, 1644468085)
+ZHM_PIN(Cancelled, 2063890788)
+ZHM_PIN(Car, 1332781181)
+ZHM_PIN(CaughtArmed, -469256161)
+ZHM_PIN(ChallengeComplete, 225062519)
+ZHM_PIN(ChallengePartiallyComplete, 341488514)
+ZHM_PIN(ChangeAmmo, -1666275037)
+ZHM_PIN(ChangeFrame, -866671170)
+ZHM_PIN(Changed, 1817052262)
+ZHM_PIN(ChangedDisguise, -653677082)
+ZHM_PIN(ChangedDisguiseClean, 2010068019)
+ZHM_PIN(ChangedEntryValue, -1678200931)
+ZHM_PIN(ChannelA, -1028271776)
+ZHM_PIN(ChannelB, 1539080410)
+ZHM_PIN(Checkpoint_NewStart, -2112070682)
+ZHM_PIN(Checkpoint_Picklock_Fail, -1015371412)
+ZHM_PIN(Checkpoint_Picklock_Start, -734471094)
+ZHM_PIN(ChokeOutUsed, -1390283106)
+ZHM_PIN(CivilianGameTensionAlertedLow, -637245011)
+ZHM_PIN(Clamped, -66888597)
+ZHM_PIN(ClipEmpty, -59080782)
+ZHM_PIN(CloseCalled, -661915685)
+ZHM_PIN(CloseCombatEnded, 989278753)
+ZHM_PIN(Closed, 57362642)
+ZHM_PIN(ClosestDistance, -1050746610)
+ZHM_PIN(ClosestTrackPoint, -841255486)
+ZHM_PIN(ClosetPeekStart, -948588044)
+ZHM_PIN(ClosetPeekStop, -570524533)
+ZHM_PIN(ClothBundleSpawned, -1752077672)
+ZHM_PIN(ClothRustle, 1392066976)
+ZHM_PIN(ClothStretch, -1150367653)
+ZHM_PIN(ClothSwoosh, 1513232368)
+ZHM_PIN(Color, -1483249683)
+ZHM_PIN(ColorRGB, 1384014433)
+ZHM_PIN(Combat, -1963071826)
+ZHM_PIN(CombatHitmanHidden, -2049395358)
+ZHM_PIN(CombatHitmanSpotted, -1556250776)
+ZHM_PIN(Completed, -1207312691)
+ZHM_PIN(Condition0, 1424890451)
+ZHM_PIN(Condition1, 602483397)
+ZHM_PIN(Condition2, -1159693441)
+ZHM_PIN(Condition3, -840479767)
+ZHM_PIN(Condition4, 1401151050)
+ZHM_PIN(Condition5, 612691676)
+ZHM_PIN(Condition6, -1114783898)
+ZHM_PIN(Condition7, -896888848)
+ZHM_PIN(Condition8, 1513460321)
+ZHM_PIN(Condition9, 758293239)
+ZHM_PIN(ContainedItem, 1562825685)
+ZHM_PIN(ContainedItemBreakOut, -563669641)
+ZHM_PIN(ContainedItemDestroyed, -1827523941)
+ZHM_PIN(ContainedItemEjected, 1097579739)
+ZHM_PIN(ContainerFull, 1306673225)
+ZHM_PIN(ContainsVictim, 803123667)
+ZHM_PIN(ContextKillActor, 685215694)
+ZHM_PIN(ContextLink, 1024268177)
+ZHM_PIN(Continue, -359315319)
+ZHM_PIN(ControllerHintClosed, 740363042)
+ZHM_PIN(ControllerHintOpened, -2052038243)
+ZHM_PIN(Count, 1142451046)
+ZHM_PIN(CounterEnded, -1696953393)
+ZHM_PIN(CounterStarted, -1697650560)
+ZHM_PIN(CountersUpdated, -1588479283)
+ZHM_PIN(CoverDisabled, -1303173227)
+ZHM_PIN(CoverEnabled, -17155282)
+ZHM_PIN(CoverToCover, 1476479167)
+ZHM_PIN(CoverUsed, -1535163882)
+ZHM_PIN(CrippleBoxCanHolsterCurrentState, 1497540539)
+ZHM_PIN(CrippleBoxCanHolsterOnStateChanged, -504659651)
+ZHM_PIN(CrossBackward, 518928791)
+ZHM_PIN(CrossForward, -465848409)
+ZHM_PIN(CrowdActEnded, -1999675983)
+ZHM_PIN(CrowdActPossessionFailed, -2018743330)
+ZHM_PIN(CrowdActStarted, 1153685772)
+ZHM_PIN(CrowdActorDeselected, 1481361782)
+ZHM_PIN(CrowdActorDeselectedID, -1978753259)
+ZHM_PIN(CrowdActorDied, -1759036093)
+ZHM_PIN(CrowdActorSelected, -1284021646)
+ZHM_PIN(CrowdActorSelectedID, -1352217779)
+ZHM_PIN(CrowdActorSelectionFailed, -1348423010)
+ZHM_PIN(CrowdAlertFemaleRatio, -285549042)
+ZHM_PIN(CrowdAlertFemaleRatio_Back, -1848883523)
+ZHM_PIN(CrowdAlertFemaleRatio_Left, -2040176414)
+ZHM_PIN(CrowdAlertFemaleRatio_Right, -1185210963)
+ZHM_PIN(CrowdAlertMaleRatio, -628985965)
+ZHM_PIN(CrowdAlertMaleRatio_Back, -61061380)
+ZHM_PIN(CrowdAlertMaleRatio_Left, -336240477)
+ZHM_PIN(CrowdAlertMaleRatio_Right, -1192362837)
+ZHM_PIN(CrowdAlertNearestActor, -798497675)
+ZHM_PIN(CrowdAlertNearestActor_Back, 878100344)
+ZHM_PIN(CrowdAlertNearestActor_Left, 603953447)
+ZHM_PIN(CrowdAlertNearestActor_Right, 1391505771)
+ZHM_PIN(CrowdAlertRatio, -571754013)
+ZHM_PIN(CrowdAlertRatio_Back, 251012638)
+ZHM_PIN(CrowdAlertRatio_Left, 425656385)
+ZHM_PIN(CrowdAlertRatio_Right, -165948001)
+ZHM_PIN(CrowdAmbientFemaleRatio, 1968962682)
+ZHM_PIN(CrowdAmbientFemaleRatio_Back, -576060543)
+ZHM_PIN(CrowdAmbientFemaleRatio_Left, -905763362)
+ZHM_PIN(CrowdAmbientFemaleRatio_Right, -1770518673)
+ZHM_PIN(CrowdAmbientMaleRatio, -2139287253)
+ZHM_PIN(CrowdAmbientMaleRatio_Back, -1446554699)
+ZHM_PIN(CrowdAmbientMaleRatio_Left, -1100057110)
+ZHM_PIN(CrowdAmbientMaleRatio_Right, -1212637558)
+ZHM_PIN(CrowdAmbientNearestActor, -2020282254)
+ZHM_PIN(CrowdAmbientNearestActor_Back, 460694970)
+ZHM_PIN(CrowdAmbientNearestActor_Left, 215778277)
+ZHM_PIN(CrowdAmbientNearestActor_Right, 666186221)
+ZHM_PIN(CrowdAmbientRatio, -179502272)
+ZHM_PIN(CrowdAmbientRatio_Back, -887692578)
+ZHM_PIN(CrowdAmbientRatio_Left, -591412095)
+ZHM_PIN(CrowdAmbientRatio_Right, 1840969707)
+ZHM_PIN(CrowdBotherBody, -1775520393)
+ZHM_PIN(CrowdBotherHead, -361740199)
+ZHM_PIN(CrowdBotherPos, -1324975156)
+ZHM_PIN(CrowdCulledRatio, -1594045430)
+ZHM_PIN(CrowdCulledRatio_Back, -198483632)
+ZHM_PIN(CrowdCulledRatio_Left, -478001393)
+ZHM_PIN(CrowdCulledRatio_Right, 1736795215)
+ZHM_PIN(CrowdDensity1, 1398041051)
+ZHM_PIN(CrowdDensity1_Back, -755933144)
+ZHM_PIN(CrowdDensity1_Left, -984070537)
+ZHM_PIN(CrowdDensity1_Right, 964511552)
+ZHM_PIN(CrowdDensityTotal, -500227772)
+ZHM_PIN(CrowdDownFemaleRatio, -356242227)
+ZHM_PIN(CrowdDownFemaleRatio_Back, 1502545668)
+ZHM_PIN(CrowdDownFemaleRatio_Left, 1311121755)
+ZHM_PIN(CrowdDownFemaleRatio_Right, 187585988)
+ZHM_PIN(CrowdDownMaleRatio, -605363106)
+ZHM_PIN(CrowdDownMaleRatio_Back, -2007043979)
+ZHM_PIN(CrowdDownMaleRatio_Left, -1611147734)
+ZHM_PIN(CrowdDownMaleRatio_Right, 754828697)
+ZHM_PIN(CrowdDownNearestActor, -770815603)
+ZHM_PIN(CrowdDownNearestActor_Back, -2044463343)
+ZHM_PIN(CrowdDownNearestActor_Left, -1853173426)
+ZHM_PIN(CrowdDownNearestActor_Right, 1714167263)
+ZHM_PIN(CrowdDownRatio, 153055956)
+ZHM_PIN(CrowdDownRatio_Back, -350031720)
+ZHM_PIN(CrowdDownRatio_Left, -57944377)
+ZHM_PIN(CrowdDownRatio_Right, -232446116)
+ZHM_PIN(CrowdKillBody, 42430795)
+ZHM_PIN(CrowdKillHead, 2128383077)
+ZHM_PIN(CrowdKillPos, 2046411589)
+ZHM_PIN(CrowdScaredFemaleRatio, -1935361479)
+ZHM_PIN(CrowdScaredFemaleRatio_Back, 123750624)
+ZHM_PIN(CrowdScaredFemaleRatio_Left, 281636543)
+ZHM_PIN(CrowdScaredFemaleRatio_Right, -1407738646)
+ZHM_PIN(CrowdScaredMaleRatio, 1894773892)
+ZHM_PIN(CrowdScaredMaleRatio_Back, 1346004955)
+ZHM_PIN(CrowdScaredMaleRatio_Left, 1200832900)
+ZHM_PIN(CrowdScaredMaleRatio_Right, 491466721)
+ZHM_PIN(CrowdScaredNearestActor, 1756897054)
+ZHM_PIN(CrowdScaredNearestActor_Back, 555367999)
+ZHM_PIN(CrowdScaredNearestActor_Left, 917706848)
+ZHM_PIN(CrowdScaredNearestActor_Right, -1168299559)
+ZHM_PIN(CrowdScaredRatio, -1127989984)
+ZHM_PIN(CrowdScaredRatio_Back, -1919955390)
+ZHM_PIN(CrowdScaredRatio_Left, -1708726243)
+ZHM_PIN(CrowdScaredRatio_Right, -1807371864)
+ZHM_PIN(CurrentAmbience, -799826532)
+ZHM_PIN(CurrentGait, 1338905183)
+ZHM_PIN(CurrentHealth, 1412363848)
+ZHM_PIN(CurrentLocale, -613149757)
+ZHM_PIN(CurrentMapRotationZ, -2093962150)
+ZHM_PIN(CurrentRegion, -1785322451)
+ZHM_PIN(CurrentTextLocale, 1843705076)
+ZHM_PIN(CutSequenceEnded, 1643864777)
+ZHM_PIN(CutSequenceStarted, 356773627)
+ZHM_PIN(DataEnd, -1497880383)
+ZHM_PIN(DataStart, 975389649)
+ZHM_PIN(Deactivate, -1318334333)
+ZHM_PIN(Deactivated, -320998522)
+ZHM_PIN(Dead, 1293411866)
+ZHM_PIN(DeadBodySeenAccident, -458839207)
+ZHM_PIN(DeadBodySeenMurder, -2068219174)
+ZHM_PIN(DeadBodySeenMurderId, -507874564)
+ZHM_PIN(DeadlyThrowActivated, -426470935)
+ZHM_PIN(DeadlyThrowImpact, 1640406207)
+ZHM_PIN(DeadlyThrowOff, 1891030449)
+ZHM_PIN(DeadlyThrowOn, -577714569)
+ZHM_PIN(Death, 646380074)
+ZHM_PIN(DeathContext, 1239111071)
+ZHM_PIN(DeepTrespassing, 567961179)
+ZHM_PIN(Default, 753088835)
+ZHM_PIN(Deselected, -1616614488)
+ZHM_PIN(DetectedKill, 1962060764)
+ZHM_PIN(DetectedPacified, -912301622)
+ZHM_PIN(DialogOpened, -1145455599)
+ZHM_PIN(Died, 543283834)
+ZHM_PIN(DiffusePower, 1573485654)
+ZHM_PIN(Disable, -2131200819)
+ZHM_PIN(Disabled, 2106068149)
+ZHM_PIN(DisarmedEnemy, -1116585443)
+ZHM_PIN(Discharge_Shot, 2070772009)
+ZHM_PIN(Discharge_ShotCompletelySilenced, -260429516)
+ZHM_PIN(Discharge_ShotSilenced, -388105389)
+ZHM_PIN(Discharge_ShotSuperSilenced, 551274368)
+ZHM_PIN(DisguiseAttentionMax, -1056929777)
+ZHM_PIN(DisguiseAttentionMaxPan, -1122519900)
+ZHM_PIN(DisguiseBeingInvestigated, -348666816)
+ZHM_PIN(DisguiseBlendInActivated, 314179056)
+ZHM_PIN(DisguiseBlown, -1185561239)
+ZHM_PIN(DisguiseBroken, 1707574743)
+ZHM_PIN(DisguiseHealth, 1236667056)
+ZHM_PIN(DisguiseSuspicious, 925476141)
+ZHM_PIN(DisguiseTaken, -614291559)
+ZHM_PIN(DisplayingObjectivesBarWithoutChanges, -1134510055)
+ZHM_PIN(Distance, -437978921)
+ZHM_PIN(DistanceChanged, -954305844)
+ZHM_PIN(DistanceToAlertableActor, -2108459676)
+ZHM_PIN(DistanceToAlertableGuard, 1765027921)
+ZHM_PIN(DistanceToEngagedActor, 1532297061)
+ZHM_PIN(DivideByZero, 2037073175)
+ZHM_PIN(Done, -1340125291)
+ZHM_PIN(DoorBroken, -772212179)
+ZHM_PIN(DoorCancelLockpicking, 1659962880)
+ZHM_PIN(DoorClose, 1128938921)
+ZHM_PIN(DoorCloseByAny, -1997098449)
+ZHM_PIN(DoorCloseByHitmanFirst, 425629881)
+ZHM_PIN(DoorCloseNoOperator, -329466639)
+ZHM_PIN(DoorClosed, 932453309)
+ZHM_PIN(DoorHidePadlock, 1578516374)
+ZHM_PIN(DoorLocked, -645816632)
+ZHM_PIN(DoorOpen, -356658476)
+ZHM_PIN(DoorOpenByAny, -924408374)
+ZHM_PIN(DoorOpenByAnyIn, 1572932265)
+ZHM_PIN(DoorOpenByAnyOut, -2021247034)
+ZHM_PIN(DoorOpenByHitmanFirst, 724716334)
+ZHM_PIN(DoorShowPadlock, -2134327380)
+ZHM_PIN(DoorStartLockpicking, -164539140)
+ZHM_PIN(DoorUnlocked, -394641512)
+ZHM_PIN(Dot, 1038040643)
+ZHM_PIN(Down, -1127399675)
+ZHM_PIN(DownToAmbient, 117742386)
+ZHM_PIN(DraggedBodyElevationChanged, 2074838923)
+ZHM_PIN(DraggingDirChanged, -2003012526)
+ZHM_PIN(DraggingStart, -1189861868)
+ZHM_PIN(DraggingStartMoving, -72451378)
+ZHM_PIN(DraggingStop, 219488646)
+ZHM_PIN(DraggingStopMoving, 1674256447)
+ZHM_PIN(DumpsterEndDumpingBody, -1813427075)
+ZHM_PIN(DumpsterFull, -1817898037)
+ZHM_PIN(DumpsterStartDumpingBody, 14523148)
+ZHM_PIN(Duration, 2133451414)
+ZHM_PIN(DynamicRangeModeHigh, -1392667734)
+ZHM_PIN(DynamicRangeModeLow, 48530779)
+ZHM_PIN(DynamicRangeModeMedium, -1690959454)
+ZHM_PIN(EjectCartridge, 737444799)
+ZHM_PIN(EjectCartridgeHitman, -1802303860)
+ZHM_PIN(EjectCartridgeNPC, -1269338067)
+ZHM_PIN(EliminateSilentUsed, -319493704)
+ZHM_PIN(EliminateUsed, -1405221831)
+ZHM_PIN(Else, -175506763)
+ZHM_PIN(EmptyShot, -1685454249)
+ZHM_PIN(Enable, -200487676)
+ZHM_PIN(EnablePickup, 876426755)
+ZHM_PIN(Enabled, -1622900200)
+ZHM_PIN(EndFire, 213599210)
+ZHM_PIN(EnemiesIsAlerted, -2086941451)
+ZHM_PIN(EnemiesIsAlertedArmed, 763010601)
+ZHM_PIN(EnemiesIsEngaged, 470876117)
+ZHM_PIN(EnemiesIsInCombat, 283673254)
+ZHM_PIN(EnterAimAt, 1702818852)
+ZHM_PIN(EnterCloset, -501533549)
+ZHM_PIN(EnterCover, 841871514)
+ZHM_PIN(EnterLookAt, -1221529608)
+ZHM_PIN(EnterPeeking, 2133029193)
+ZHM_PIN(EnterPeekingDone, 2099462537)
+ZHM_PIN(EnterSafeZoneAny, -1598662432)
+ZHM_PIN(EnterSniperMode, 767749257)
+ZHM_PIN(EnterVent, 2014155688)
+ZHM_PIN(EnvironmentKill, -23863353)
+ZHM_PIN(Equal, -278250765)
+ZHM_PIN(Equipped, -334056610)
+ZHM_PIN(EquippedBulletCount, 1199302009)
+ZHM_PIN(EquippedHasBullets, -959828560)
+ZHM_PIN(EquippedIsFirearm, -783088667)
+ZHM_PIN(EquippedIsNotFirearm, -1624733959)
+ZHM_PIN(EquippedIsOutOfBullets, 1303120889)
+ZHM_PIN(EventData, -745274665)
+ZHM_PIN(EventOccurred, 384083638)
+ZHM_PIN(EventReceived, 1920686262)
+ZHM_PIN(EventRegistered, 1198473998)
+ZHM_PIN(Executed, 4174937)
+ZHM_PIN(ExecutedData, 558719109)
+ZHM_PIN(ExitAimAt, 1587332160)
+ZHM_PIN(ExitCloset, -1459653662)
+ZHM_PIN(ExitCover, 164610302)
+ZHM_PIN(ExitLookAt, -36394871)
+ZHM_PIN(ExitPeeking, 1483461796)
+ZHM_PIN(ExitPeekingDone, 456079233)
+ZHM_PIN(ExitSafeZoneAny, -960876824)
+ZHM_PIN(ExitSniperMode, 663694931)
+ZHM_PIN(ExitVent, -199409784)
+ZHM_PIN(Explosion, -211360833)
+ZHM_PIN(ExplosionAtPos, 632274062)
+ZHM_PIN(ExplosionDistance, 155403932)
+ZHM_PIN(ExplosionKill, 1589487333)
+ZHM_PIN(FaceExpression, -1324515458)
+ZHM_PIN(FadeHero, -1256261497)
+ZHM_PIN(Failed, -1725454783)
+ZHM_PIN(Fiber_Wire_Kill, -351066002)
+ZHM_PIN(Fiberwire, -770161904)
+ZHM_PIN(FiberwireKill, 1863890672)
+ZHM_PIN(FilterOut, -1232937292)
+ZHM_PIN(Finish, 660991534)
+ZHM_PIN(Finished, 1597622634)
+ZHM_PIN(Fired, 1386177760)
+ZHM_PIN(FireworksBox, -1374258395)
+ZHM_PIN(FirstSMGShot, -37494971)
+ZHM_PIN(Fixed, 1594417462)
+ZHM_PIN(FloatCount, -50705461)
+ZHM_PIN(FloatValue, 1683249053)
+ZHM_PIN(FocusAdded, 1378500269)
+ZHM_PIN(FocusBecameEmpty, -1637335013)
+ZHM_PIN(FocusBecameFull, -165392267)
+ZHM_PIN(FocusBurnRate, -1288131943)
+ZHM_PIN(FocusEmpty, -246246526)
+ZHM_PIN(FocusFull, 2088773795)
+ZHM_PIN(FocusGainValue, 477273571)
+ZHM_PIN(FocusGained, -915024457)
+ZHM_PIN(FocusLost, -591759191)
+ZHM_PIN(FocusValue, -2065500558)
+ZHM_PIN(ForwardSpawn_Enabled, -1118864578)
+ZHM_PIN(ForwardSpawn_Restored, -1644061124)
+ZHM_PIN(ForwardVector, -1919612564)
+ZHM_PIN(FoundCount, -577623905)
+ZHM_PIN(FoundNode, -1503722376)
+ZHM_PIN(FoundNothing, -952146913)
+ZHM_PIN(FoundSomething, 1244037837)
+ZHM_PIN(FriskFailed, -728921708)
+ZHM_PIN(FriskSuccess, 1447651930)
+ZHM_PIN(FuseBoxDisabled, 466106320)
+ZHM_PIN(FuseBoxDisabledFirstTime, -1657209505)
+ZHM_PIN(FuseBoxFixed, 1214886053)
+ZHM_PIN(GameTension, 1085555817)
+ZHM_PIN(GameTensionAgitated, -908919179)
+ZHM_PIN(GameTensionAlertedHigh, -1827032565)
+ZHM_PIN(GameTensionAlertedLow, 1405352445)
+ZHM_PIN(GameTensionAmbient, 2014866673)
+ZHM_PIN(GameTensionArrest, 1250345247)
+ZHM_PIN(GameTensionCivilian, -753556020)
+ZHM_PIN(GameTensionCivilianHM, -1326975249)
+ZHM_PIN(GameTensionCivilianHM_Agitated, 1092387038)
+ZHM_PIN(GameTensionCivilianHM_AlertedHigh, -1957381171)
+ZHM_PIN(GameTensionCivilianHM_AlertedLow, -1450358742)
+ZHM_PIN(GameTensionCivilianHM_Ambient, -1103355607)
+ZHM_PIN(GameTensionCivilianHM_Arrest, 1645390629)
+ZHM_PIN(GameTensionCivilianHM_Combat, -1033144190)
+ZHM_PIN(GameTensionCivilianHM_Hunting, 772161269)
+ZHM_PIN(GameTensionCivilianHM_Searching, -694054276)
+ZHM_PIN(GameTensionCivilian_Agitated, 1548262553)
+ZHM_PIN(GameTensionCivilian_AlertedHigh, 1961945125)
+ZHM_PIN(GameTensionCivilian_AlertedLow, 45404403)
+ZHM_PIN(GameTensionCivilian_Ambient, 1563427385)
+ZHM_PIN(GameTensionCivilian_Arrest, 221948333)
+ZHM_PIN(GameTensionCivilian_Combat, -1388086774)
+ZHM_PIN(GameTensionCivilian_Hunting, -854975003)
+ZHM_PIN(GameTensionCivilian_Searching, 1040454227)
+ZHM_PIN(GameTensionCombat, -352382280)
+ZHM_PIN(GameTensionGuardHM, -1444146584)
+ZHM_PIN(GameTensionGuardHM_Agitated, 1651294570)
+ZHM_PIN(GameTensionGuardHM_AlertedHigh, -261823910)
+ZHM_PIN(GameTensionGuardHM_AlertedLow, 687829472)
+ZHM_PIN(GameTensionGuardHM_Ambient, 387590878)
+ZHM_PIN(GameTensionGuardHM_Arrest, -122220599)
+ZHM_PIN(GameTensionGuardHM_Combat, 1489951854)
+ZHM_PIN(GameTensionGuardHM_Hunting, -2027932414)
+ZHM_PIN(GameTensionGuardHM_Searching, 445552040)
+ZHM_PIN(GameTensionHunting, -400395475)
+ZHM_PIN(GameTensionSearching, -1758648734)
+ZHM_PIN(GameTensionSearchingHitmanClear, 758302041)
+ZHM_PIN(GasCanister, -1023175525)
+ZHM_PIN(GasTank, 1300108658)
+ZHM_PIN(Generic00, 829621742)
+ZHM_PIN(Generic01, 1182020984)
+ZHM_PIN(Generic02, -545430334)
+ZHM_PIN(Generic03, -1468378028)
+ZHM_PIN(Generic04, 907985399)
+ZHM_PIN(Generic05, 1092219233)
+ZHM_PIN(Generic06, -669998885)
+ZHM_PIN(Generic07, -1357410227)
+ZHM_PIN(GentlePush, -1527339089)
+ZHM_PIN(GentlePushSignal, 613534905)
+ZHM_PIN(GetDelayValue, 739878568)
+ZHM_PIN(GetFalse, 594118689)
+ZHM_PIN(GetTrue, 874606784)
+ZHM_PIN(GetValue, 366196773)
+ZHM_PIN(GhostPosition, 1219583217)
+ZHM_PIN(GlobalHintClosed, 2003437284)
+ZHM_PIN(GlobalHintOpened, -553948069)
+ZHM_PIN(Glow, 1246633515)
+ZHM_PIN(GlowColor1, -373482213)
+ZHM_PIN(GlowColor2, 1890864289)
+ZHM_PIN(GlowType, -1248553897)
+ZHM_PIN(Grab, -1347921612)
+ZHM_PIN(GroundSoundMaterialChanged, -710441975)
+ZHM_PIN(GuardKill, 965540297)
+ZHM_PIN(HMFootstepMaterialChanged, -1603299529)
+ZHM_PIN(HMJump_Timemultiplier, 229787503)
+ZHM_PIN(HMMovementIndex, 1548839364)
+ZHM_PIN(HMState_CloseDoor, 1850578665)
+ZHM_PIN(HMState_Jump, 1876105409)
+ZHM_PIN(HMState_JumpFail, -1916201527)
+ZHM_PIN(HMState_JumpLand, -1544623272)
+ZHM_PIN(HMState_JumpLandGrab, -1954255608)
+ZHM_PIN(HMState_LeftStep, 1990263798)
+ZHM_PIN(HMState_OpenDoor, -1471094560)
+ZHM_PIN(HMState_RightStep, 1395943075)
+ZHM_PIN(HMState_StartRun, 826208500)
+ZHM_PIN(HMState_StartSneak, -1675689571)
+ZHM_PIN(HMState_StartWindowKill, -1453132734)
+ZHM_PIN(HMState_StopRun, 642604247)
+ZHM_PIN(HMState_StopSneak, -36270516)
+ZHM_PIN(HMState_SwingAtWill, 1255625420)
+ZHM_PIN(HM_BurstShot, -590398782)
+ZHM_PIN(HM_BurstShotSilenced, -715694365)
+ZHM_PIN(HM_EndBurstShot, -1128219479)
+ZHM_PIN(HM_HitNPC, 1482210449)
+ZHM_PIN(HM_HitNPCAt, 1432274234)
+ZHM_PIN(HM_HitNPCCloseCombatShot, 1828869218)
+ZHM_PIN(HM_HitNPCHeadShot, 805179315)
+ZHM_PIN(HM_HitNPCHeadShotAt, -1601956214)
+ZHM_PIN(HM_HitNPCHeadShot_IActor, -861002280)
+ZHM_PIN(HM_HitNPCKilled, 1292662490)
+ZHM_PIN(HM_HitNPCKilledAt, 1029860622)
+ZHM_PIN(HM_HitNPCKilled_IActor, 1568033874)
+ZHM_PIN(HM_SingleShot, -2139709845)
+ZHM_PIN(HM_SingleShotSilenced, 328676686)
+ZHM_PIN(HM_WeaponEquipped, -1372955741)
+ZHM_PIN(HM_WeaponPickedUp, -663008724)
+ZHM_PIN(HM_WeaponSwapped, -556847978)
+ZHM_PIN(HM_WeaponUnequipped, 1469564587)
+ZHM_PIN(HangToStand, 985949464)
+ZHM_PIN(HardPush, 1183799905)
+ZHM_PIN(HardPushSignal, 59165769)
+ZHM_PIN(HasNoUnconsciousWitness, 550123105)
+ZHM_PIN(HasStartupState, 406552669)
+ZHM_PIN(HasUnconsciousWitness, 1422716826)
+ZHM_PIN(HaveActiveParticles, -748757626)
+ZHM_PIN(HaveUnhiddenBodies, 1887953933)
+ZHM_PIN(HaveUnhiddenPacified, 1910895628)
+ZHM_PIN(Headshot, 1670201254)
+ZHM_PIN(HeadshotKill, -1162163257)
+ZHM_PIN(Heartbeat, -2004062342)
+ZHM_PIN(Hero, -235093576)
+ZHM_PIN(HeroOpacity, -160410446)
+ZHM_PIN(Hide, 78341141)
+ZHM_PIN(HideClip, 1872092723)
+ZHM_PIN(HideInCloset, -358688682)
+ZHM_PIN(HideInClosetFirstTime, 1280091494)
+ZHM_PIN(HideIngameHUD, 361076031)
+ZHM_PIN(HidingObjectivesBar, -272042513)
+ZHM_PIN(HighClamped, 1889383050)
+ZHM_PIN(Hit, 1654612129)
+ZHM_PIN(HitFirstTime, -279160026)
+ZHM_PIN(HitTarget, -1530826384)
+ZHM_PIN(HitmanAimBegin, 245403319)
+ZHM_PIN(HitmanAimEnd, -1375783880)
+ZHM_PIN(HitmanBumping, 1423077949)
+ZHM_PIN(HitmanCCBegin, 953385256)
+ZHM_PIN(HitmanCCEnd, -2107502275)
+ZHM_PIN(HitmanCivilianKill, 358101749)
+ZHM_PIN(HitmanCrouchBegin, -899561097)
+ZHM_PIN(HitmanCrouchEnd, -1436174888)
+ZHM_PIN(HitmanFullAttention, 1175586220)
+ZHM_PIN(HitmanGuardKill, -1117048868)
+ZHM_PIN(HitmanGuardSilenced, 746398392)
+ZHM_PIN(HitmanHiddenSignal, -845084892)
+ZHM_PIN(HitmanInCoverBegin, 1496738344)
+ZHM_PIN(HitmanInCoverEnd, 677263008)
+ZHM_PIN(HitmanInSight, -725745345)
+ZHM_PIN(HitmanInVision, -369573832)
+ZHM_PIN(HitmanLedgePullKill, 109377731)
+ZHM_PIN(HitmanNotHiddenSignal, -303027400)
+ZHM_PIN(HitmanNotSuspiciousSignal, -2019264715)
+ZHM_PIN(HitmanPush, 1740298503)
+ZHM_PIN(HitmanPushSignal, -719860216)
+ZHM_PIN(HitmanSBBegin, -1806578109)
+ZHM_PIN(HitmanSBEnd, 1514070490)
+ZHM_PIN(HitmanSeenEnter, -455539512)
+ZHM_PIN(HitmanSeenLeave, -971422602)
+ZHM_PIN(HitmanSpotted, 1578567825)
+ZHM_PIN(HitmanSuspiciousSignal, 888302667)
+ZHM_PIN(HitmanTrespassingSpotted, -255728412)
+ZHM_PIN(HitmanVisibleWeaponBegin, -1298841599)
+ZHM_PIN(HitmanVisibleWeaponEnd, 1405138378)
+ZHM_PIN(HitmanWindowPullKill, -1711572528)
+ZHM_PIN(HitmanWindowPushKill, -1627689122)
+ZHM_PIN(HoldingIllegalWeapon, 454411213)
+ZHM_PIN(HoverMapIcon, 1980019510)
+ZHM_PIN(Hue, -296215282)
+ZHM_PIN(IActor, -637307673)
+ZHM_PIN(IdleEnd, 1213240230)
+ZHM_PIN(IdleStart, 1277966941)
+ZHM_PIN(IdleStop, 986529745)
+ZHM_PIN(IdleTimeOut, -686867597)
+ZHM_PIN(Impact, -1012546255)
+ZHM_PIN(ImpactBack, -1022198080)
+ZHM_PIN(ImpactFrontSide, -843937183)
+ZHM_PIN(InDisguise, 586420442)
+ZHM_PIN(InDisguiseZone, -257494807)
+ZHM_PIN(InLoop, -1614913817)
+ZHM_PIN(InPosition, -805550112)
+ZHM_PIN(InSequence, -615091138)
+ZHM_PIN(InTrespassArea, 1227186950)
+ZHM_PIN(InTrespassEntryArea, -268470332)
+ZHM_PIN(InactiveStage, 795905437)
+ZHM_PIN(Index, 1102202885)
+ZHM_PIN(Inside, -1118636158)
+ZHM_PIN(InsideCone, -414278610)
+ZHM_PIN(InsideCrimeScene, -1376604755)
+ZHM_PIN(Insideness, -1288063146)
+ZHM_PIN(InstinctActive, -720458858)
+ZHM_PIN(InstinctTimeMultiplier, 343275158)
+ZHM_PIN(InstinctUnavailable, -371033702)
+ZHM_PIN(Instinct_CC_End, -1296969382)
+ZHM_PIN(Instinct_CC_Impact, 94065591)
+ZHM_PIN(Instinct_CC_Start, 1828146865)
+ZHM_PIN(Instinct_CC_Take_Down, 544656839)
+ZHM_PIN(IntegerCount, -90444440)
+ZHM_PIN(IntegerValue, 1647702334)
+ZHM_PIN(IntelWithinFocus, -428760741)
+ZHM_PIN(Intensity, 1799567921)
+ZHM_PIN(Interrupted, 1515570823)
+ZHM_PIN(Invert, -172069903)
+ZHM_PIN(InvestigateCautious, 1039203169)
+ZHM_PIN(InvestigateCurious, -220989773)
+ZHM_PIN(IsCheckedWhenFrisked, -307256461)
+ZHM_PIN(IsCrouchRunning, -46244187)
+ZHM_PIN(IsCrouchWalking, 2053083869)
+ZHM_PIN(IsCrouchWalkingSlowly, 2048834806)
+ZHM_PIN(IsHeadshot, 1319394243)
+ZHM_PIN(IsInState, -235248669)
+ZHM_PIN(IsLastTriggeredAndNotTracked, -1506462954)
+ZHM_PIN(IsNPC, -987680797)
+ZHM_PIN(IsNotTarget, 742505934)
+ZHM_PIN(IsPerceivedAsWeapon, 1558130473)
+ZHM_PIN(IsPerceptibleOnRelease, 1836057372)
+ZHM_PIN(IsPlayer, -1610149143)
+ZHM_PIN(IsRunning, -887662580)
+ZHM_PIN(IsTarget, 2121353072)
+ZHM_PIN(IsVisible, -1635370694)
+ZHM_PIN(IsWalking, 1282839668)
+ZHM_PIN(IsWalkingSlowly, 915501286)
+ZHM_PIN(Item, -1087796704)
+ZHM_PIN(ItemAutoDroppedDueToMovement, 533846672)
+ZHM_PIN(ItemCount, 1409080613)
+ZHM_PIN(ItemFound, -2035596751)
+ZHM_PIN(ItemImpactBack, 1328591349)
+ZHM_PIN(ItemImpactFront, -1951187174)
+ZHM_PIN(ItemImpactLow, 1861092119)
+ZHM_PIN(ItemOnDeadlyThrow, -1981452847)
+ZHM_PIN(ItemPrimingStart, 1368560113)
+ZHM_PIN(ItemPrimingStop, 863434689)
+ZHM_PIN(ItemPullOut, 1339332540)
+ZHM_PIN(ItemReady, -22012696)
+ZHM_PIN(ItemShot, 1480402715)
+ZHM_PIN(ItemSlitThroat, -953034060)
+ZHM_PIN(ItemSoundGeneric01, 2077361705)
+ZHM_PIN(ItemSoundGeneric02, -488941677)
+ZHM_PIN(ItemSoundGeneric03, -1780717819)
+ZHM_PIN(ItemSpawned, 1065559647)
+ZHM_PIN(ItemStashed, 805146540)
+ZHM_PIN(ItemStuckInActor, -1881841305)
+ZHM_PIN(ItemUsed, -1971467080)
+ZHM_PIN(Joined, 1381043253)
+ZHM_PIN(KeycardPickup, 1998214659)
+ZHM_PIN(KeycardUse, 1025953972)
+ZHM_PIN(Keyword, -1792128857)
+ZHM_PIN(Keyword2, 1391633934)
+ZHM_PIN(Keyword3, 636851864)
+ZHM_PIN(KeywordCount, -430289529)
+ZHM_PIN(Kill, -1491338921)
+ZHM_PIN(KillData, 9101000)
+ZHM_PIN(KillItemCategory, 2113411094)
+ZHM_PIN(KillItemInstanceId, 807301811)
+ZHM_PIN(KillItemRepositoryId, 1557748295)
+ZHM_PIN(KillOutfit, 976093743)
+ZHM_PIN(KillType, 564624002)
+ZHM_PIN(KillWeapon, 1629434824)
+ZHM_PIN(KillerHero, -1244593319)
+ZHM_PIN(KillerNPC, -104552758)
+ZHM_PIN(KnockOutByHandUsed, -353824332)
+ZHM_PIN(Knockout, 1205879537)
+ZHM_PIN(LH_Hide, 1650502497)
+ZHM_PIN(LH_Place, -489553373)
+ZHM_PIN(LH_Retrieve, 116417107)
+ZHM_PIN(LH_Show, -185091765)
+ZHM_PIN(LH_Swap, -479533781)
+ZHM_PIN(LabelMatch, 1708788742)
+ZHM_PIN(LadderSlideStart, 1261191006)
+ZHM_PIN(LadderSlideStop, 1460413909)
+ZHM_PIN(LastEnemyKilled, -1233920200)
+ZHM_PIN(LastGuardKilled, -818965661)
+ZHM_PIN(Last_AI_In_Alerted_Kill, 1367919509)
+ZHM_PIN(Last_AI_In_Checkpoint_Kill, -402772856)
+ZHM_PIN(Last_AI_In_Combat_Kill, -1614740663)
+ZHM_PIN(LateralShift, 685402414)
+ZHM_PIN(Leaving, -1017725606)
+ZHM_PIN(LeftHandShot, -1123206723)
+ZHM_PIN(Lerp, -208250086)
+ZHM_PIN(LidClose, -2101799572)
+ZHM_PIN(LidClosed, -597958998)
+ZHM_PIN(LidOpen, 2022227178)
+ZHM_PIN(LidOpened, 1976218645)
+ZHM_PIN(LoadingTransitionDelayEnded, -1047713806)
+ZHM_PIN(LoadingTransitionDelayStarted, 793187498)
+ZHM_PIN(LocaleChanged, 1458046379)
+ZHM_PIN(Log, -1217253851)
+ZHM_PIN(LoopCounter, 725665862)
+ZHM_PIN(LooseTargetEncounterCutStarted, -303824650)
+ZHM_PIN(LosingSight, -779965090)
+ZHM_PIN(LowClamped, 590142129)
+ZHM_PIN(LowHealth, -2044772471)
+ZHM_PIN(MainEventEnded, 1035909196)
+ZHM_PIN(MapLevelDown, 74310512)
+ZHM_PIN(MapLevelUp, 410687938)
+ZHM_PIN(Mark_Local, -704703072)
+ZHM_PIN(Mark_Remote, 586129293)
+ZHM_PIN(Marker, -2057099832)
+ZHM_PIN(MaxDimension, 264153972)
+ZHM_PIN(MaxFacingAlertableActor, 1239476130)
+ZHM_PIN(MaxIndex, -1701150800)
+ZHM_PIN(MaxNumberOfTargets, -1946434418)
+ZHM_PIN(MaxTensionAlertedHigh, -2109774548)
+ZHM_PIN(MaxTensionAlertedLow, 1948221990)
+ZHM_PIN(MaxTensionAmbient, 700075045)
+ZHM_PIN(MaxTensionArrest, 916860718)
+ZHM_PIN(MaxTensionCombat, -1763705719)
+ZHM_PIN(MaxValue, 127811717)
+ZHM_PIN(MenuClosed, 1470268665)
+ZHM_PIN(MenuOpened, -30151098)
+ZHM_PIN(MinDimension, -1613907042)
+ZHM_PIN(MinIndex, 2096812113)
+ZHM_PIN(MinValue, -503386268)
+ZHM_PIN(Mine, -912622419)
+ZHM_PIN(MockUpAudioDisabled, 796291951)
+ZHM_PIN(MockUpAudioEnabled, 165244587)
+ZHM_PIN(MultiplayerSessionPopulated, -1658034508)
+ZHM_PIN(MusicStarted, 267473092)
+ZHM_PIN(NPCAlerted, -1162215180)
+ZHM_PIN(NPCAllShots, 659581906)
+ZHM_PIN(NPCCivilianAlerted, 716918858)
+ZHM_PIN(NPCCivilianScared, -1125966295)
+ZHM_PIN(NPCDead, -153697742)
+ZHM_PIN(NPCFirstBurstShot, 1659528123)
+ZHM_PIN(NPCHasExclamationMark, -1130533795)
+ZHM_PIN(NPCHasQuestionMark, 1113154192)
+ZHM_PIN(NPCHasWhiteDot, -2078547565)
+ZHM_PIN(NPCLoopShot, -1736477448)
+ZHM_PIN(NPCScared, 44970278)
+ZHM_PIN(NPCShot, -1326185555)
+ZHM_PIN(NPCWeaponFire, -2133599519)
+ZHM_PIN(NPC_BurstShot, -1217947856)
+ZHM_PIN(NPC_BurstShotSilenced, 1439181477)
+ZHM_PIN(NPC_EndBurstShot, -920325630)
+ZHM_PIN(NPC_HitHM, 1625061782)
+ZHM_PIN(NPC_HitHMAt, -250520250)
+ZHM_PIN(NPC_SingleShot, -743528970)
+ZHM_PIN(NPC_SingleShotSilenced, -1935126881)
+ZHM_PIN(NavigateSlots, 1799849892)
+ZHM_PIN(NavigateTabs, -1652989951)
+ZHM_PIN(NavigatedBetweenEntries, -1421277450)
+ZHM_PIN(NeckSnap, 1462450912)
+ZHM_PIN(Negate, 1278047498)
+ZHM_PIN(NewObjectiveAtStartHudDisplayed, 1933746956)
+ZHM_PIN(NewObjectiveDuringLevelHudDisplayed, -1502611781)
+ZHM_PIN(NextPageTabSelected, 1437582101)
+ZHM_PIN(NoContainerItem, -1746883515)
+ZHM_PIN(NoEmptyContainerItem, -1637405133)
+ZHM_PIN(NoEquipContainedItem, -1611828696)
+ZHM_PIN(NoMoreInteractive, 847762711)
+ZHM_PIN(NoPageTabAvailable, 47062522)
+ZHM_PIN(NoPlaceItem, 1448984542)
+ZHM_PIN(Node, 625821563)
+ZHM_PIN(Nodes, -587453704)
+ZHM_PIN(NonTargetKilled, -1452807755)
+ZHM_PIN(NormalShot, 1361843442)
+ZHM_PIN(NotEqual, -1657753213)
+ZHM_PIN(NumOccupiedSpots, 1349044087)
+ZHM_PIN(NumOccupiedSpotsFemale, -1830520908)
+ZHM_PIN(NumOccupiedSpotsMale, 1375266604)
+ZHM_PIN(NumOccupiedSpotsMalePercent, -1499286996)
+ZHM_PIN(NumberOfPickups, 1562625588)
+ZHM_PIN(ObjectEvent01, 94562626)
+ZHM_PIN(ObjectEvent02, -1666467592)
+ZHM_PIN(ObjectEvent03, -341014418)
+ZHM_PIN(ObjectEvent04, 1976049101)
+ZHM_PIN(ObjectiveActivate, -1174865207)
+ZHM_PIN(ObjectiveCompleted, 1881696209)
+ZHM_PIN(ObjectiveCompletedHudDisplayed, 1145662121)
+ZHM_PIN(ObjectiveFailed, -45201040)
+ZHM_PIN(ObjectiveFailedHudDisplayed, 940811552)
+ZHM_PIN(ObjectiveUpdate, -69148801)
+ZHM_PIN(OccludersAny, -360419740)
+ZHM_PIN(OccludersNone, -103963262)
+ZHM_PIN(Off, 334568355)
+ZHM_PIN(On, -1674441366)
+ZHM_PIN(OnAbort, -527968007)
+ZHM_PIN(OnAbortEntering, -481945564)
+ZHM_PIN(OnAbortStart, 1115170616)
+ZHM_PIN(OnAborted, 1593493705)
+ZHM_PIN(OnAccidentDeath, -403749932)
+ZHM_PIN(OnAccidentStarted, 1135192372)
+ZHM_PIN(OnActDone, -749289650)
+ZHM_PIN(OnActTimeout, -727937483)
+ZHM_PIN(OnActionA, -1123210116)
+ZHM_PIN(OnActionB, 604274118)
+ZHM_PIN(OnActionFailed, -1514768424)
+ZHM_PIN(OnActionNotUsable, -768318508)
+ZHM_PIN(OnActionUsed, 1051948010)
+ZHM_PIN(OnActionX, -647592772)
+ZHM_PIN(OnActionY, -1369328598)
+ZHM_PIN(OnActivate, 849926143)
+ZHM_PIN(OnActivateByHM, -2088851856)
+ZHM_PIN(OnActivateHit, -898421636)
+ZHM_PIN(OnActivateImpact, -1283142240)
+ZHM_PIN(OnActivated, -1242755690)
+ZHM_PIN(OnActivatedByForwardSpawn, -134830924)
+ZHM_PIN(OnActive, -1285136377)
+ZHM_PIN(OnActor, 1581726244)
+ZHM_PIN(OnActorAIEvent, 874048805)
+ZHM_PIN(OnActorAdded, -263928463)
+ZHM_PIN(OnActorBodybagged, 570925775)
+ZHM_PIN(OnActorCast, -2016547882)
+ZHM_PIN(OnActorChanged, 861716970)
+ZHM_PIN(OnActorContained, -843094653)
+ZHM_PIN(OnActorDead, 2018515716)
+ZHM_PIN(OnActorEnteredStage1, -95505457)
+ZHM_PIN(OnActorEnteredStage1Signal, 132224878)
+ZHM_PIN(OnActorEnteredStage2, 1665655413)
+ZHM_PIN(OnActorEnteredStage2Signal, 906595827)
+ZHM_PIN(OnActorEnteredStage3, 339792611)
+ZHM_PIN(OnActorEnteredStage3Signal, -1870756281)
+ZHM_PIN(OnActorHit, -1865775991)
+ZHM_PIN(OnActorImpact, -722976504)
+ZHM_PIN(OnActorInvestigated, -1841541141)
+ZHM_PIN(OnActorInvestigating, -982840025)
+ZHM_PIN(OnActorInvestigationTerminated, 1708739909)
+ZHM_PIN(OnActorNotAdded, -1669994159)
+ZHM_PIN(OnActorNotContained, -561815560)
+ZHM_PIN(OnActorNotRemoved, -1986059747)
+ZHM_PIN(OnActorPacified, -389497813)
+ZHM_PIN(OnActorPickup, 1367324914)
+ZHM_PIN(OnActorReacted, -1570668358)
+ZHM_PIN(OnActorReleased, -429728114)
+ZHM_PIN(OnActorRemoved, 784533101)
+ZHM_PIN(OnActorRevived, 479788834)
+ZHM_PIN(OnActorSeen, 824662072)
+ZHM_PIN(OnActorSet, 739018516)
+ZHM_PIN(OnActorSpawned, -1714946488)
+ZHM_PIN(OnActorTagged, 754850106)
+ZHM_PIN(OnActorUntagged, -891162325)
+ZHM_PIN(OnActorWillReact, 1845519255)
+ZHM_PIN(OnAdded, -779224010)
+ZHM_PIN(OnAlarm, 1856842240)
+ZHM_PIN(OnAlerted, 775991576)
+ZHM_PIN(OnAlive, 168375950)
+ZHM_PIN(OnAllEscortsDied, 76695108)
+ZHM_PIN(OnAmbient, 864251611)
+ZHM_PIN(OnAnchorsLost, -1363691560)
+ZHM_PIN(OnArrival, 729272487)
+ZHM_PIN(OnAttach, 649191556)
+ZHM_PIN(OnAttachToHitman, -2015245018)
+ZHM_PIN(OnAttachToNPC, -758786914)
+ZHM_PIN(OnAttached, -328617510)
+ZHM_PIN(OnAvailable, 544103054)
+ZHM_PIN(OnBaseScoreUpdate, -831627984)
+ZHM_PIN(OnBecomeInvisible, 873895432)
+ZHM_PIN(OnBecomeVisible, -1755695355)
+ZHM_PIN(OnBehaviorEnded, -1768105670)
+ZHM_PIN(OnBehaviorStarted, 1986118118)
+ZHM_PIN(OnBloodyKill, -1906994849)
+ZHM_PIN(OnBodyBagged, 1354378407)
+ZHM_PIN(OnBodyDumped, 1700244329)
+ZHM_PIN(OnBodyFlushed, 1282824030)
+ZHM_PIN(OnBodyFound, 470795776)
+ZHM_PIN(OnBodyHidden, 829930665)
+ZHM_PIN(OnBodyNoticed, -140764611)
+ZHM_PIN(OnBroken, 450048113)
+ZHM_PIN(OnBusy, 656542102)
+ZHM_PIN(OnCameraDestroyed, 1604174492)
+ZHM_PIN(OnCaptured, -856133169)
+ZHM_PIN(OnCastRole, -978178278)
+ZHM_PIN(OnChallengeCompleted, -1997943776)
+ZHM_PIN(OnChange, -1204854235)
+ZHM_PIN(OnChangedOutfit, 622322646)
+ZHM_PIN(OnCheckLastKnownPosition, 1445168156)
+ZHM_PIN(OnCleared, -121614)
+ZHM_PIN(OnClosed, -54537759)
+ZHM_PIN(OnCollision, -567485003)
+ZHM_PIN(OnCollisionEnergyReached, -154796102)
+ZHM_PIN(OnCombat, 1965653917)
+ZHM_PIN(OnCombatEnded, -279094532)
+ZHM_PIN(OnCombatStarted, -1620043147)
+ZHM_PIN(OnComplete, -962002063)
+ZHM_PIN(OnCompleted, -1088839067)
+ZHM_PIN(OnCompletedByForwardSpawn, 1942744048)
+ZHM_PIN(OnCompliedAfterWarning, -1500696205)
+ZHM_PIN(OnCompromised, -1679036120)
+ZHM_PIN(OnConsumed, 4280612)
+ZHM_PIN(OnContained, -1231575231)
+ZHM_PIN(OnContainerDestroyed, -62857159)
+ZHM_PIN(OnCooldown, 1521352587)
+ZHM_PIN(OnCorneredBegin, -234127033)
+ZHM_PIN(OnCorneredEnd, -1650835615)
+ZHM_PIN(OnCured, 1531134062)
+ZHM_PIN(OnCurious, 297579369)
+ZHM_PIN(OnCurrent, -1402882024)
+ZHM_PIN(OnDeactivate, 1768024869)
+ZHM_PIN(OnDead, 94234928)
+ZHM_PIN(OnDeadlyHeavyItem, -857297884)
+ZHM_PIN(OnDeadlyLightItem, 1681488391)
+ZHM_PIN(OnDeath, -42616333)
+ZHM_PIN(OnDeathNPC, 1925278096)
+ZHM_PIN(OnDestroyed, 1585261621)
+ZHM_PIN(OnDetach, 737988357)
+ZHM_PIN(OnDetached, 1696606404)
+ZHM_PIN(OnDidEnterCombat, 83379023)
+ZHM_PIN(OnDisabled, 3194289)
+ZHM_PIN(OnDollyTargetingFirstPoint, 1491731690)
+ZHM_PIN(OnDollyTargetingLastPoint, 1513902964)
+ZHM_PIN(OnDone, -124436289)
+ZHM_PIN(OnDrainHealthDone, 121027555)
+ZHM_PIN(OnDrainHealthStarted, 422905798)
+ZHM_PIN(OnDramaNewBehavior, 646635467)
+ZHM_PIN(OnDramaResuming, -1861010259)
+ZHM_PIN(OnDrop, -1733450442)
+ZHM_PIN(OnDropByHero, -238204392)
+ZHM_PIN(OnDying, -918821082)
+ZHM_PIN(OnEffectActivated, -1173589239)
+ZHM_PIN(OnEffectDeactivated, -1831585169)
+ZHM_PIN(OnEject, -1895960560)
+ZHM_PIN(OnEmoteStarted, -219356110)
+ZHM_PIN(OnEnabled, 543897495)
+ZHM_PIN(OnEnd, 8918262)
+ZHM_PIN(OnEndDumpingBody, -743900411)
+ZHM_PIN(OnEnded, 1269873298)
+ZHM_PIN(OnEnter, -1555911501)
+ZHM_PIN(OnEnterConnector, 1449840198)
+ZHM_PIN(OnEnterDeadZone, 848947988)
+ZHM_PIN(OnEnterDrama, -1350900147)
+ZHM_PIN(OnEnterRole, -1519468559)
+ZHM_PIN(OnEnterScopeMode, 35076535)
+ZHM_PIN(OnEntered, 50633126)
+ZHM_PIN(OnEntering, -845739812)
+ZHM_PIN(OnEqual, 882473258)
+ZHM_PIN(OnErased, 367619116)
+ZHM_PIN(OnEscaping, -1966822982)
+ZHM_PIN(OnEscapingEnd, 330567444)
+ZHM_PIN(OnEvacuationStandDown, -181619023)
+ZHM_PIN(OnEvacuationStarted, -741973037)
+ZHM_PIN(OnEvent, 563897978)
+ZHM_PIN(OnEvent1, 858647539)
+ZHM_PIN(OnEvent2, -1440433591)
+ZHM_PIN(OnEvent3, -584873249)
+ZHM_PIN(OnEvent4, 1128734588)
+ZHM_PIN(OnEvent5, 876621802)
+ZHM_PIN(OnEvent6, -1387692464)
+ZHM_PIN(OnEvent7, -632402234)
+ZHM_PIN(OnEvent8, 1257329495)
+ZHM_PIN(OnExfiltrationStarted, 217988953)
+ZHM_PIN(OnExit, 2091983898)
+ZHM_PIN(OnExitDeadZone, -1530843111)
+ZHM_PIN(OnExitRole, 1406590589)
+ZHM_PIN(OnExitScopeMode, 2083528145)
+ZHM_PIN(OnFacing, 1970836876)
+ZHM_PIN(OnFail, 1855949661)
+ZHM_PIN(OnFailed, 1727217522)
+ZHM_PIN(OnFailedAcknowledge, -1193896217)
+ZHM_PIN(OnFailedGreeting, -1967166223)
+ZHM_PIN(OnFailedResponse, -232275039)
+ZHM_PIN(OnFailure, 1359581138)
+ZHM_PIN(OnFalse, 838796525)
+ZHM_PIN(OnFinishedTargetZoom, -1713826198)
+ZHM_PIN(OnFireProjectiles, 772916758)
+ZHM_PIN(OnFireProjectilesLocal, -529353601)
+ZHM_PIN(OnFireProjectilesRemote, 884399465)
+ZHM_PIN(OnFirst, -2008841590)
+ZHM_PIN(OnFirstDeathNPC, -632210996)
+ZHM_PIN(OnFirstShotHero, -156095054)
+ZHM_PIN(OnFirstShotNPC, -217897054)
+ZHM_PIN(OnFlushBodyEnd, -99566844)
+ZHM_PIN(OnFlushBodyStart, -441909620)
+ZHM_PIN(OnForcedAnim, -1383861814)
+ZHM_PIN(OnFoundTargetDead, -1666290840)
+ZHM_PIN(OnFoundTargetUnconscious, -1915792055)
+ZHM_PIN(OnFracture, 118728372)
+ZHM_PIN(OnFree, -1516871204)
+ZHM_PIN(OnFriskClean, -264948597)
+ZHM_PIN(OnFriskPrompt, 394545725)
+ZHM_PIN(OnGet, -45151945)
+ZHM_PIN(OnGetAccessoryItem, 867211928)
+ZHM_PIN(OnGetCondition, 1903670151)
+ZHM_PIN(OnGetEntityRef, 132643818)
+ZHM_PIN(OnGetGroupID, -46769646)
+ZHM_PIN(OnGetHealth, -1552753751)
+ZHM_PIN(OnGetIActor, -1341683349)
+ZHM_PIN(OnGetItem, 1776921820)
+ZHM_PIN(OnGetItemNotFound, -1748633027)
+ZHM_PIN(OnGetItemUsed, -565706918)
+ZHM_PIN(OnGetOutfit, 1605004987)
+ZHM_PIN(OnGetSetpieceUsed, 1022313745)
+ZHM_PIN(OnGetTally, -1649758442)
+ZHM_PIN(OnGetTallyRemaining, -980503988)
+ZHM_PIN(OnGetThisSetpiece, 1240186283)
+ZHM_PIN(OnGreeting, -1037207559)
+ZHM_PIN(OnGreetingNotAllowed, 678819475)
+ZHM_PIN(OnHandleBreakRecorder, -185684057)
+ZHM_PIN(OnHandleDisableCamera, 1665111029)
+ZHM_PIN(OnHardWarning, -1641081384)
+ZHM_PIN(OnHearAccident, -696584937)
+ZHM_PIN(OnHearBulletImpact, 778894965)
+ZHM_PIN(OnHearExplosion, 789631804)
+ZHM_PIN(OnHearGunshot, -591347568)
+ZHM_PIN(OnHeroEnterCover, 1487201008)
+ZHM_PIN(OnHeroLeaveCover, 1515904216)
+ZHM_PIN(OnHide, 1277258559)
+ZHM_PIN(OnHintCancelled, 1017020647)
+ZHM_PIN(OnHintStarted, 1332731774)
+ZHM_PIN(OnHit, 1520828678)
+ZHM_PIN(OnHitByImpulse, 727781548)
+ZHM_PIN(OnHitByImpulseInfo, -1602603006)
+ZHM_PIN(OnHitByItem, 2079324756)
+ZHM_PIN(OnHitInfo, 1022429191)
+ZHM_PIN(OnHit_AfterInfo, 216641334)
+ZHM_PIN(OnHitmanEnter, 1386118309)
+ZHM_PIN(OnHitmanExit, 1954771147)
+ZHM_PIN(OnHitmanLeave, 1885223963)
+ZHM_PIN(OnHolster, 2083796512)
+ZHM_PIN(OnIActor, 634908116)
+ZHM_PIN(OnIActorChanged, 891410217)
+ZHM_PIN(OnImpact, 1014062082)
+ZHM_PIN(OnImpactInfo, -1117801210)
+ZHM_PIN(OnInfectedPercentageChanged, 1711448864)
+ZHM_PIN(OnInitialDetach, -455373190)
+ZHM_PIN(OnInitialFracture, -1368425044)
+ZHM_PIN(OnInteractedWith, 752719815)
+ZHM_PIN(OnInteractionBegin, -1777755137)
+ZHM_PIN(OnInteractionEnd, 690018546)
+ZHM_PIN(OnInteractionInterrupted, -749604974)
+ZHM_PIN(OnInteractorSet, -1625437246)
+ZHM_PIN(OnInterrupted, 1698220641)
+ZHM_PIN(OnInvestigated, -865202040)
+ZHM_PIN(OnInvestigating, 294547354)
+ZHM_PIN(OnInvestigatorAssigned, -1022399313)
+ZHM_PIN(OnInvisible, -1315612428)
+ZHM_PIN(OnIsFullyInCrowd, -852902449)
+ZHM_PIN(OnIsFullyInVegetation, 1837472079)
+ZHM_PIN(OnItem, -140278518)
+ZHM_PIN(OnItemChanged, -1435167461)
+ZHM_PIN(OnItemConsumed, 1401673392)
+ZHM_PIN(OnItemDestroyed, -1454591505)
+ZHM_PIN(OnItemFocus, -1275744506)
+ZHM_PIN(OnItemGrabbed, -1335202394)
+ZHM_PIN(OnItemPlaced, 1293427614)
+ZHM_PIN(OnItemPrimed, 1575096216)
+ZHM_PIN(OnItemPrimedAndReady, 1991070726)
+ZHM_PIN(OnItemRemovedPinID, 1023852986)
+ZHM_PIN(OnItemSet, -622495679)
+ZHM_PIN(OnItemStashed, 277906250)
+ZHM_PIN(OnItemsSpawned, 842439472)
+ZHM_PIN(OnJoinNPC, 1529578993)
+ZHM_PIN(OnKill, -275646851)
+ZHM_PIN(OnKnight, -59688267)
+ZHM_PIN(OnKnockdownHeavyItem, 3824552)
+ZHM_PIN(OnKnockdownLightItem, -1461351029)
+ZHM_PIN(OnLast, -1570567756)
+ZHM_PIN(OnLeave, -2122126323)
+ZHM_PIN(OnLeaveConnector, 2032675858)
+ZHM_PIN(OnLeaveDrama, -1383802779)
+ZHM_PIN(OnLeaving, 2088306901)
+ZHM_PIN(OnLeft, -1830860932)
+ZHM_PIN(OnLethalImpact, 474007645)
+ZHM_PIN(OnLinkedEntityApplied, -1608386473)
+ZHM_PIN(OnLockdownEnd, -1852068474)
+ZHM_PIN(OnLocked, 313152660)
+ZHM_PIN(OnLostOwnership, -1759653618)
+ZHM_PIN(OnLostSightTimeout, 636979187)
+ZHM_PIN(OnMaxInfected, 1987231655)
+ZHM_PIN(OnMaxSightAttentionToPlayer, 1765886123)
+ZHM_PIN(OnModifierActivated, -1530573641)
+ZHM_PIN(OnModifierDeactivated, 1593084589)
+ZHM_PIN(OnMove, 126261100)
+ZHM_PIN(OnMoveBegin, 1843923125)
+ZHM_PIN(OnMoveEnd, 1135050202)
+ZHM_PIN(OnMovementForced, 577516054)
+ZHM_PIN(OnMurdered, 936557110)
+ZHM_PIN(OnNegative, -1421463508)
+ZHM_PIN(OnNegativeSide, -1441016962)
+ZHM_PIN(OnNeutral, -726242845)
+ZHM_PIN(OnNext, -325603288)
+ZHM_PIN(OnNoAccessoryItem, -850631781)
+ZHM_PIN(OnNoContainedItem, -461696720)
+ZHM_PIN(OnNoEquipContainedItem, -1641871525)
+ZHM_PIN(OnNoEquipItem, -221047883)
+ZHM_PIN(OnNoItem, -28580308)
+ZHM_PIN(OnNoReceiversRegistered, -877548521)
+ZHM_PIN(OnNonTargetObjectiveCompleted, -980639079)
+ZHM_PIN(OnNotAdded, 94143899)
+ZHM_PIN(OnNotAvailable, 371785044)
+ZHM_PIN(OnNotContained, -2133786469)
+ZHM_PIN(OnNotCurrent, -1643026635)
+ZHM_PIN(OnNotEqual, -527957881)
+ZHM_PIN(OnNotFacing, -573875296)
+ZHM_PIN(OnNotRemoved, -57759421)
+ZHM_PIN(OnNotSpotted, -138516913)
+ZHM_PIN(OnOpened, 1429125982)
+ZHM_PIN(OnOriginalASet, 1245553575)
+ZHM_PIN(OnOriginalBSet, 1485311049)
+ZHM_PIN(OnOriginalSet, 291655855)
+ZHM_PIN(OnOutfitChanged, -1828129505)
+ZHM_PIN(OnOutfitReacquired, -1778719741)
+ZHM_PIN(OnOutfitSpawned, 965987005)
+ZHM_PIN(OnOutfitTaken, -1939378710)
+ZHM_PIN(OnPacified, 1898041569)
+ZHM_PIN(OnPacify, -1843281055)
+ZHM_PIN(OnPacifyHeavyItem, 117978418)
+ZHM_PIN(OnPacifyLightItem, -1344806127)
+ZHM_PIN(OnPassedFilter, 1705640944)
+ZHM_PIN(OnPause, -844562896)
+ZHM_PIN(OnPauseDrama, 1731459193)
+ZHM_PIN(OnPauseRole, 992021443)
+ZHM_PIN(OnPickup, -1176066568)
+ZHM_PIN(OnPlaced, -2063305321)
+ZHM_PIN(OnPlay, -1238270290)
+ZHM_PIN(OnPlayerAdded, 1286610166)
+ZHM_PIN(OnPlayerInRangeToSpreadToNPC, 1438940519)
+ZHM_PIN(OnPlayerRemoved, -1525752219)
+ZHM_PIN(OnPointInsideVolume, 512719904)
+ZHM_PIN(OnPositionReached, -43223067)
+ZHM_PIN(OnPositive, -835696841)
+ZHM_PIN(OnPositiveSide, 939538066)
+ZHM_PIN(OnPressed, 1808151657)
+ZHM_PIN(OnPressedIActor, -1224892120)
+ZHM_PIN(OnProjectionTurnedOff, -318768411)
+ZHM_PIN(OnProjectionTurnedOn, -1648804941)
+ZHM_PIN(OnPutInContainer, -2054205379)
+ZHM_PIN(OnQueueCompleted, -1460174207)
+ZHM_PIN(OnQueueStarted, -375483467)
+ZHM_PIN(OnRayEnter, -1327064583)
+ZHM_PIN(OnRayLeave, -1842947769)
+ZHM_PIN(OnReached, 1465952941)
+ZHM_PIN(OnReacted, 1113387193)
+ZHM_PIN(OnReady, 849865074)
+ZHM_PIN(OnReadyActor, -1667835020)
+ZHM_PIN(OnReadyActorAsEntity, -1144733493)
+ZHM_PIN(OnReadyInRangeVR, 144993298)
+ZHM_PIN(OnReadyItem, -239242570)
+ZHM_PIN(OnReadySetpiece, -756333442)
+ZHM_PIN(OnRecorded, -1616357964)
+ZHM_PIN(OnReenterRole, -2056240241)
+ZHM_PIN(OnRefillHealth, 1553941996)
+ZHM_PIN(OnRelease, -287994098)
+ZHM_PIN(OnReleased, 2139861572)
+ZHM_PIN(OnReleasedIActor, 1094220222)
+ZHM_PIN(OnRemoved, -822184338)
+ZHM_PIN(OnRemovedFromContainer, 480444469)
+ZHM_PIN(OnRequestPutInContainer, -825207485)
+ZHM_PIN(OnReset, 1253036944)
+ZHM_PIN(OnResize, -2012835289)
+ZHM_PIN(OnResponderSet, -565834386)
+ZHM_PIN(OnResponding, 1516818844)
+ZHM_PIN(OnRestart, -1754550764)
+ZHM_PIN(OnResume, -1732686683)
+ZHM_PIN(OnResumed, 1056548071)
+ZHM_PIN(OnResumingRole, -29808219)
+ZHM_PIN(OnRise, 1980127314)
+ZHM_PIN(OnRoleJoined, -1193135888)
+ZHM_PIN(OnRoleLeft, -1483602292)
+ZHM_PIN(OnRunningRole, -465221243)
+ZHM_PIN(OnSafeRoomBegin, 1734557530)
+ZHM_PIN(OnSafeRoomCompromised, 23683920)
+ZHM_PIN(OnSafeRoomEnd, 1691818368)
+ZHM_PIN(OnScoringEvent, 1937260849)
+ZHM_PIN(OnSearchStarted, -384414973)
+ZHM_PIN(OnSeeActorAgitatedBystander, 529829651)
+ZHM_PIN(OnSeeActorCombat, -763378547)
+ZHM_PIN(OnSeeActorGettingHelp, -1261062885)
+ZHM_PIN(OnSeeActorScared, 997384895)
+ZHM_PIN(OnSeeAgitatedBystander, 1853264409)
+ZHM_PIN(OnSeeCombat, -797139163)
+ZHM_PIN(OnSeeDead, 1439090185)
+ZHM_PIN(OnSeeDeadByAccident, -867404387)
+ZHM_PIN(OnSeeGettingHelp, -654428876)
+ZHM_PIN(OnSeePlayerIllegalInteraction, -100985269)
+ZHM_PIN(OnSeePlayerSevereIllegalInteraction, -2099455851)
+ZHM_PIN(OnSeeScared, 963754263)
+ZHM_PIN(OnSeeUnconscious, -1484026584)
+ZHM_PIN(OnSelected, 476540116)
+ZHM_PIN(OnSelectedMuzzleExtension, -1045702739)
+ZHM_PIN(OnSelectedScope, 1728342797)
+ZHM_PIN(OnSelectedSkin, 1947040389)
+ZHM_PIN(OnSet, -429915493)
+ZHM_PIN(OnSetAmmoScopeType, 680827495)
+ZHM_PIN(OnSetItem, -92793855)
+ZHM_PIN(OnSetKinematic, 1724970827)
+ZHM_PIN(OnSetVisible, 2133605281)
+ZHM_PIN(OnSetZoomLevel, 493696567)
+ZHM_PIN(OnShatter, 1638871716)
+ZHM_PIN(OnShot, 1136601263)
+ZHM_PIN(OnShotDamageReached, 576686960)
+ZHM_PIN(OnShotVolumeIntersection, -430887806)
+ZHM_PIN(OnShow, -625575659)
+ZHM_PIN(OnShowExitObjective, 1795390607)
+ZHM_PIN(OnSit, 1255493015)
+ZHM_PIN(OnSituation, 1775002817)
+ZHM_PIN(OnSleep, 352431729)
+ZHM_PIN(OnSniperScoringActive, 665298592)
+ZHM_PIN(OnSoundEventExplosion, -441796898)
+ZHM_PIN(OnSpawn, -1975737542)
+ZHM_PIN(OnSpawnPointFound, 1447772045)
+ZHM_PIN(OnSpeedChanged, 66930855)
+ZHM_PIN(OnSpotted, -976307870)
+ZHM_PIN(OnSpreadingActorDied, 635826224)
+ZHM_PIN(OnStandDown, 1826132528)
+ZHM_PIN(OnStart, -2058667694)
+ZHM_PIN(OnStartDumpingBody, -1304555876)
+ZHM_PIN(OnStartIntermediateFailed, 1607045)
+ZHM_PIN(OnStartIntermediateOnActorFailed, -734433535)
+ZHM_PIN(OnStartPriming, -1475845322)
+ZHM_PIN(OnStartRotating, -2035506635)
+ZHM_PIN(OnStarted, -1006363959)
+ZHM_PIN(OnStartedActor, -158663110)
+ZHM_PIN(OnStateChanged, -841036301)
+ZHM_PIN(OnStep, -1425973720)
+ZHM_PIN(OnStone, 51538423)
+ZHM_PIN(OnStop, 1374598818)
+ZHM_PIN(OnStopPriming, 845267402)
+ZHM_PIN(OnStopRotating, 842888608)
+ZHM_PIN(OnStopped, -701184769)
+ZHM_PIN(OnSuccess, 529683361)
+ZHM_PIN(OnTakeDamage, 869191507)
+ZHM_PIN(OnTallyChanged, -1357577400)
+ZHM_PIN(OnTargetDead, 1480320355)
+ZHM_PIN(OnTargetInRange, -1464832188)
+ZHM_PIN(OnTargetOutOfRange, 2098926056)
+ZHM_PIN(OnTargetUnconscious, 1270588714)
+ZHM_PIN(OnTerminate, -378268133)
+ZHM_PIN(OnThrown, 948046233)
+ZHM_PIN(OnTimeOut, -912343199)
+ZHM_PIN(OnTimeToSearch, -1165569847)
+ZHM_PIN(OnTransitionBegin, 1286978543)
+ZHM_PIN(OnTransitionEnd, 1743617244)
+ZHM_PIN(OnTriggeredEvent01, -1422766636)
+ZHM_PIN(OnTriggeredEvent02, 842734702)
+ZHM_PIN(OnTriggeredEvent03, 1161571576)
+ZHM_PIN(OnTriggeredEvent04, -614942373)
+ZHM_PIN(OnTriggeredEvent05, -1403024947)
+ZHM_PIN(OnTriggeredEvent06, 894883959)
+ZHM_PIN(OnTriggeredEvent07, 1112664289)
+ZHM_PIN(OnTriggeredEvent08, -756091536)
+ZHM_PIN(OnTrue, 356838553)
+ZHM_PIN(OnTumble, -1632330718)
+ZHM_PIN(OnTurnOff, 443402761)
+ZHM_PIN(OnTurnOn, -1230009242)
+ZHM_PIN(OnUnlocked, -2050634427)
+ZHM_PIN(OnUnnoticableKill, -1319688669)
+ZHM_PIN(OnUnpause, 1894295355)
+ZHM_PIN(OnUnpauseDrama, -2028481419)
+ZHM_PIN(OnUsed, -1845509364)
+ZHM_PIN(OnVRQuickDeath, -627571827)
+ZHM_PIN(OnValue, 121976041)
+ZHM_PIN(OnValueChanged, 1750683033)
+ZHM_PIN(OnVelocityChanged, 718045457)
+ZHM_PIN(OnVictimDeath, -301482151)
+ZHM_PIN(OnVictimDeathActor, 806634092)
+ZHM_PIN(OnVictimsInAccident, 1053830114)
+ZHM_PIN(OnVisible, 170026058)
+ZHM_PIN(OnWake, -841981567)
+ZHM_PIN(OnWarning, 819728597)
+ZHM_PIN(OnWeaponBroken, 333595650)
+ZHM_PIN(OnWillReact, 354984277)
+ZHM_PIN(OnWrap, 1149399241)
+ZHM_PIN(OpenCalled, 1894516874)
+ZHM_PIN(OpenMap, -91776405)
+ZHM_PIN(Opened, -1426447763)
+ZHM_PIN(Out00, -368595208)
+ZHM_PIN(Out01, -1660903826)
+ZHM_PIN(Out02, 67751892)
+ZHM_PIN(Out03, 1930362690)
+ZHM_PIN(Out04, -311792927)
+ZHM_PIN(Out05, -1704109449)
+ZHM_PIN(Out06, 56888269)
+ZHM_PIN(Out07, 1952660315)
+ZHM_PIN(Out08, -455334198)
+ZHM_PIN(Out1, -1434156796)
+ZHM_PIN(Out2, 864932030)
+ZHM_PIN(Out3, 1149952040)
+ZHM_PIN(Out4, -621906549)
+ZHM_PIN(Out5, -1377221347)
+ZHM_PIN(Out6, 887100583)
+ZHM_PIN(Out7, 1139221553)
+ZHM_PIN(Out8, -749192800)
+ZHM_PIN(OutB, 1669898626)
+ZHM_PIN(OutG, 333600013)
+ZHM_PIN(OutOfSight, -55426879)
+ZHM_PIN(OutPeer, 1526892808)
+ZHM_PIN(OutR, 2118103526)
+ZHM_PIN(OutRGB, -764329266)
+ZHM_PIN(OutRGBA, -1344864130)
+ZHM_PIN(OutSelf, -2102441518)
+ZHM_PIN(OutSignal, -640187692)
+ZHM_PIN(OutSignalData, 1999668437)
+ZHM_PIN(OutX, -1628808968)
+ZHM_PIN(OutY, -370317202)
+ZHM_PIN(OutZ, 1894005204)
+ZHM_PIN(OutfitID, -388877218)
+ZHM_PIN(OutfitRecovered, -1234400111)
+ZHM_PIN(OutfitTaken, -1291165428)
+ZHM_PIN(Output, -881716824)
+ZHM_PIN(Output1, 1528477308)
+ZHM_PIN(Output2, -1038882874)
+ZHM_PIN(Output3, -1256925360)
+ZHM_PIN(Output4, 728777459)
+ZHM_PIN(Output5, 1551331941)
+ZHM_PIN(OutputBool, 1899454797)
+ZHM_PIN(OutputEvent, 770077621)
+ZHM_PIN(OutputFloat, -538105977)
+ZHM_PIN(OutputInt, 379953986)
+ZHM_PIN(OutputModeHeadphones, -264168899)
+ZHM_PIN(OutputModeStereo, -1088273687)
+ZHM_PIN(OutputModeSystem, -666659963)
+ZHM_PIN(OutputTargetLocation, -1953855137)
+ZHM_PIN(Outside, 2052572218)
+ZHM_PIN(OutsideCone, 1641153220)
+ZHM_PIN(OutsideMonitorDistance, -2142302164)
+ZHM_PIN(OverTheShoulderCam, -375017870)
+ZHM_PIN(OwnedByHitman, -429425519)
+ZHM_PIN(OwnedByNPC, -1944252597)
+ZHM_PIN(Pacified, 211378661)
+ZHM_PIN(PacifiedData, 205533496)
+ZHM_PIN(PageBack, -1252123340)
+ZHM_PIN(PageClosed, -1601218488)
+ZHM_PIN(PageOpen, 2095079335)
+ZHM_PIN(PageOpened, 152974071)
+ZHM_PIN(PageSelectionChanged, 1235981324)
+ZHM_PIN(ParentRepositoryId, -788483810)
+ZHM_PIN(PausedControllerHintClosed, 191518696)
+ZHM_PIN(PausedControllerHintOpened, -1560593065)
+ZHM_PIN(PetrolCan, -1673580814)
+ZHM_PIN(Pig, -199961673)
+ZHM_PIN(Pigeon, -1981005522)
+ZHM_PIN(PipeSlideStart, -493529472)
+ZHM_PIN(PipeSlideStop, 1389078585)
+ZHM_PIN(Pitch, -430009891)
+ZHM_PIN(Play, -21270140)
+ZHM_PIN(PlaySound, -308354839)
+ZHM_PIN(PlayerAllShots, 723052756)
+ZHM_PIN(PlayerEndBurstShot, -1765717906)
+ZHM_PIN(PlayerFirstBurstShot, 357548882)
+ZHM_PIN(PlayerLoopShot, -1808271362)
+ZHM_PIN(PlayerSecondBurstShot, 818309893)
+ZHM_PIN(PlayerShot, 1948417164)
+ZHM_PIN(PollValue, -1272672686)
+ZHM_PIN(Port0Out, -1987055444)
+ZHM_PIN(Port1Out, 825464777)
+ZHM_PIN(Port2Out, 595998759)
+ZHM_PIN(Port3Out, -1690673342)
+ZHM_PIN(Position, -1084586333)
+ZHM_PIN(PositionOutput, 15622449)
+ZHM_PIN(Power, 1783312036)
+ZHM_PIN(PrecisionAimedKill, -1856877869)
+ZHM_PIN(Pressed, -722894362)
+ZHM_PIN(PressedWFrameTime, 1441079950)
+ZHM_PIN(PreviousPageTabSelected, 140167633)
+ZHM_PIN(PrimaryObjectiveCompleted, 269519631)
+ZHM_PIN(PrimaryObjectiveFailed, 471294817)
+ZHM_PIN(PrincipalTargetAngleHoriz, 716099570)
+ZHM_PIN(PrincipalTargetAngleVert, 282713860)
+ZHM_PIN(PrincipalTargetDistance, 969704402)
+ZHM_PIN(PrincipalTargetIndex, -140795354)
+ZHM_PIN(PrincipalTargetVisible, 1266359275)
+ZHM_PIN(Progress, -612921328)
+ZHM_PIN(ProjectileBodyShot, -536165175)
+ZHM_PIN(ProjectileCrowdBodyShot, 95116165)
+ZHM_PIN(ProjectileCrowdHeadShot, -123282813)
+ZHM_PIN(ProjectileHeadShot, 487015887)
+ZHM_PIN(ProjectileMissed, 373206903)
+ZHM_PIN(ProjectileMultiKillTargets, -376123929)
+ZHM_PIN(PromptPositionIndex, -1962363066)
+ZHM_PIN(PropKill, -841181530)
+ZHM_PIN(PunchBody, -694237316)
+ZHM_PIN(PunchFace, 136492969)
+ZHM_PIN(QuestItemPickup, -889955828)
+ZHM_PIN(RH_Hide, 1434537202)
+ZHM_PIN(RH_Place, -1948049094)
+ZHM_PIN(RH_Retrieve, -93287010)
+ZHM_PIN(RH_Show, -1021944104)
+ZHM_PIN(RH_Swap, -729087304)
+ZHM_PIN(RayLength, 1745842852)
+ZHM_PIN(Reached, -397467870)
+ZHM_PIN(ReachedArea, -1277745106)
+ZHM_PIN(ReachedZero, -811735852)
+ZHM_PIN(ReactionTriggered, 886011295)
+ZHM_PIN(ReactionTriggeredAtPos, 777456276)
+ZHM_PIN(ReceivedKeyword, 1621342873)
+ZHM_PIN(Received_ZString, -2017128801)
+ZHM_PIN(Received_ZVariant, 1054888328)
+ZHM_PIN(Received_bool, 909758687)
+ZHM_PIN(Received_float32, 1214028898)
+ZHM_PIN(Received_int32, -290253850)
+ZHM_PIN(Received_void, -1312604253)
+ZHM_PIN(Recovered, 504409269)
+ZHM_PIN(ReleasedItem, 1008625752)
+ZHM_PIN(Reload_Red, -1287872021)
+ZHM_PIN(Reload_White, 425456961)
+ZHM_PIN(RemoteTriggered, 2067827374)
+ZHM_PIN(RemovalOfObjectiveHudDisplayed, -253701457)
+ZHM_PIN(RemovedEntity, -1309489175)
+ZHM_PIN(RemovedKeyword, -1064101874)
+ZHM_PIN(RemovedSignal, -875161996)
+ZHM_PIN(ReportItemUsed, 1405626397)
+ZHM_PIN(ReportOwner, -1506485425)
+ZHM_PIN(ReportOwnerPosition, -2035339568)
+ZHM_PIN(RepositoryID, -2101769880)
+ZHM_PIN(RepositoryId, -1177048672)
+ZHM_PIN(RequestFailed, -42550003)
+ZHM_PIN(RequestSucceeded, -249322226)
+ZHM_PIN(ResetTestCase, 1533737095)
+ZHM_PIN(Result, 348570661)
+ZHM_PIN(RightHandHoldsFirearm, -649033386)
+ZHM_PIN(RightHandHoldsMelee, 1231615495)
+ZHM_PIN(RightHandIsReloading, 1217701313)
+ZHM_PIN(RightHandPredictionForce, -571729293)
+ZHM_PIN(RoomID, -1733941728)
+ZHM_PIN(RoomId, -1547172120)
+ZHM_PIN(RotationOutput, 802925910)
+ZHM_PIN(RoundingCover, -158875635)
+ZHM_PIN(Run, 1748754976)
+ZHM_PIN(RunTestCase, -1075015717)
+ZHM_PIN(RunUsed, -1392877180)
+ZHM_PIN(Same, 1549950586)
+ZHM_PIN(ScoreAwesome, -306766848)
+ZHM_PIN(ScoreCommon, 1470683812)
+ZHM_PIN(ScoreFail, -1641677355)
+ZHM_PIN(ScoreFair, 1680523446)
+ZHM_PIN(ScoreGood, 1954977806)
+ZHM_PIN(ScoreStartUpdate, 1669728585)
+ZHM_PIN(ScoreStopUpdate, 1283346791)
+ZHM_PIN(SecondaryObjectiveCompleted, 1780719647)
+ZHM_PIN(SecondaryObjectiveFailed, 1316272349)
+ZHM_PIN(SecurityCameraAttentionMax, 421316178)
+ZHM_PIN(SecurityCameraAttentionMaxPan, -1551354021)
+ZHM_PIN(SecurityTapePickup, -500730549)
+ZHM_PIN(Selected, 1642061264)
+ZHM_PIN(SelectionChanged, 1111174197)
+ZHM_PIN(SendDestinationPosition, -2129830719)
+ZHM_PIN(SendEventName, 388400141)
+ZHM_PIN(SendSourcePosition, -781516592)
+ZHM_PIN(SendValue, 1738882331)
+ZHM_PIN(SetActor, -1272936135)
+ZHM_PIN(SetCinemaMode, -635959245)
+ZHM_PIN(SetCinemaModeHighFramerate, 1934358366)
+ZHM_PIN(SetCrosshair, 351444829)
+ZHM_PIN(SetGlowType, -1058268134)
+ZHM_PIN(SetIActor, 1178330814)
+ZHM_PIN(SetImageRID, 395925583)
+ZHM_PIN(SetLength, -1696003619)
+ZHM_PIN(SetOpenCalled, -698857560)
+ZHM_PIN(SetParticleAlpha, 21618847)
+ZHM_PIN(SetParticleColor, -1207987940)
+ZHM_PIN(SetReticleMax, 1547664996)
+ZHM_PIN(SetReticleMin, 1613906237)
+ZHM_PIN(SetUpTestCase, -1697060939)
+ZHM_PIN(SetValue, -316504076)
+ZHM_PIN(ShotBegin, 1056173252)
+ZHM_PIN(ShotEnd, 1396300407)
+ZHM_PIN(ShotFired, -685231563)
+ZHM_PIN(ShotFiredIntoCrowd, 1471438046)
+ZHM_PIN(ShotInterval, -770267586)
+ZHM_PIN(ShotsPerMinute, -1637854294)
+ZHM_PIN(ShotsPerSecondHero, -682630777)
+ZHM_PIN(ShotsPerSecondNPC, -1170495594)
+ZHM_PIN(Show, -1841531329)
+ZHM_PIN(ShowClip, -1730884389)
+ZHM_PIN(ShowHint, 20110319)
+ZHM_PIN(ShowRecenterHint, -211197357)
+ZHM_PIN(ShowTargetsMustBeDead, 429965353)
+ZHM_PIN(Signal, 1939902659)
+ZHM_PIN(SignalData, -215926486)
+ZHM_PIN(SignalDistance, 1500202446)
+ZHM_PIN(SignalMatched, -1552504240)
+ZHM_PIN(SilentTakedownHardShakeEvent, 165549998)
+ZHM_PIN(SilentTakedownPrimingStart, 1154500282)
+ZHM_PIN(SilentTakedownPrimingStop, -1416825444)
+ZHM_PIN(SilentTakedownStartMovement, 1625388711)
+ZHM_PIN(SilentTakedownStopMovement, 2057674236)
+ZHM_PIN(SkullCrack, -1144039635)
+ZHM_PIN(SliderChanged, 1817884957)
+ZHM_PIN(SnapNeckBrokenNeckEvent, -1092124814)
+ZHM_PIN(SnapNeckPrimingStart, 66065153)
+ZHM_PIN(SnapNeckPrimingStop, 957755762)
+ZHM_PIN(SnapNeckStartMovement, 1008024822)
+ZHM_PIN(SnapNeckStopMovement, 1032177735)
+ZHM_PIN(SniperModeZoomIn, 1469732300)
+ZHM_PIN(SniperModeZoomLevel, -1544434904)
+ZHM_PIN(SniperModeZoomOut, -1168836274)
+ZHM_PIN(SniperSlowDownStart, 700499291)
+ZHM_PIN(SniperSlowDownStop, 1726742409)
+ZHM_PIN(SomeoneDied, -2132331931)
+ZHM_PIN(SomeonePacified, 404568849)
+ZHM_PIN(SomeoneScared, 8062158)
+ZHM_PIN(SoundEvent01, -1082151796)
+ZHM_PIN(SoundEvent02, 645332278)
+ZHM_PIN(SoundEvent03, 1366412704)
+ZHM_PIN(SoundEvent04, -820684797)
+ZHM_PIN(SoundSignalEmitted, -1686475288)
+ZHM_PIN(SoundTensionAmbient, -2039808820)
+ZHM_PIN(SpatialEntity, -380133019)
+ZHM_PIN(SpawnPhysicsClip, -629426625)
+ZHM_PIN(Speaking, 755042572)
+ZHM_PIN(SplashAtPos, 632825129)
+ZHM_PIN(SpottedByHitman, -1007550032)
+ZHM_PIN(SpottedEnteringCloset, 758776178)
+ZHM_PIN(SpottedThroughDisguise, -412484405)
+ZHM_PIN(Sqrt, -407973018)
+ZHM_PIN(StandToHang, 932817369)
+ZHM_PIN(Start, 1589148299)
+ZHM_PIN(StartCoverTakedown, -1824138053)
+ZHM_PIN(StartExecuteKill, -1639716792)
+ZHM_PIN(StartFiberwireKill, -1538036500)
+ZHM_PIN(StartLedgePullKill, -655954206)
+ZHM_PIN(StartLedgePushKill, -538511252)
+ZHM_PIN(StartPropKill, -97558275)
+ZHM_PIN(StartPropKillSilent, 1279019102)
+ZHM_PIN(StartSubdueTakedown, -372825993)
+ZHM_PIN(StartSurrender, -343837528)
+ZHM_PIN(StartWindowPullKill, -716436584)
+ZHM_PIN(StartWindowPushKill, -766763754)
+ZHM_PIN(Start_FWKill, -1236192982)
+ZHM_PIN(Start_FWLong, -1963995605)
+ZHM_PIN(Start_FWShort, 1615657199)
+ZHM_PIN(Start_KnifeBack, 1112265468)
+ZHM_PIN(Start_KnifeFront, -228393763)
+ZHM_PIN(Start_KnifeLeft, 1440937123)
+ZHM_PIN(Start_KnifeRight, -1202459841)
+ZHM_PIN(Started, 2066460486)
+ZHM_PIN(StateEntered, 1424871421)
+ZHM_PIN(StateExitedOrDisabled, -1051489536)
+ZHM_PIN(StateOut, 457748702)
+ZHM_PIN(StateOutSent, -1410942516)
+ZHM_PIN(StealthKill, -1938540444)
+ZHM_PIN(StepCounter, 1546520778)
+ZHM_PIN(Stop, 426031496)
+ZHM_PIN(StopEventEnded, 704810564)
+ZHM_PIN(StopSurrender, 1478187868)
+ZHM_PIN(Stop_FWLong, 1723681392)
+ZHM_PIN(Stop_FWShort, -1676074473)
+ZHM_PIN(Stop_KnifeBack, -131563818)
+ZHM_PIN(Stop_KnifeFront, 694376103)
+ZHM_PIN(Stop_KnifeLeft, -276735863)
+ZHM_PIN(Stop_KnifeRight, 1666335045)
+ZHM_PIN(Stopped, 1763406192)
+ZHM_PIN(StrayBullet, -1025481403)
+ZHM_PIN(StrengthAtOrigin, -1395824486)
+ZHM_PIN(StuckItemPulledOut, 501935096)
+ZHM_PIN(SubSound, -1165336308)
+ZHM_PIN(SubtitleChanged, 1750929202)
+ZHM_PIN(SwipeActivated, 1706378131)
+ZHM_PIN(SwooshLong, -817107053)
+ZHM_PIN(SwooshShort, -1514969232)
+ZHM_PIN(SyncBar, 488567492)
+ZHM_PIN(SyncBeat, 2140711869)
+ZHM_PIN(SyncEntry, 1742924931)
+ZHM_PIN(SyncExit, 1047013679)
+ZHM_PIN(SyncGrid, -2076085226)
+ZHM_PIN(SyncPoint, -77167913)
+ZHM_PIN(SyncUserCue, 1001479005)
+ZHM_PIN(TakeDamage, -339413771)
+ZHM_PIN(TakeHealthPack, -1599236937)
+ZHM_PIN(TakeOutNonLethal, -1641100752)
+ZHM_PIN(TakingNewDisguise, 1627761601)
+ZHM_PIN(TargetAccidentKill, 1646838764)
+ZHM_PIN(TargetDied, -314056027)
+ZHM_PIN(TargetKilled, 213230084)
+ZHM_PIN(TargetPacified, 2128429355)
+ZHM_PIN(TargetPosition, -853629331)
+ZHM_PIN(TearDownTestCase, 1242953680)
+ZHM_PIN(TellActiveReceiverCount, 1066095348)
+ZHM_PIN(TellReceiverCount, -1300901283)
+ZHM_PIN(Text, -1682372359)
+ZHM_PIN(TextLocaleChanged, -798878922)
+ZHM_PIN(Then, -1854992692)
+ZHM_PIN(ThresholdPassed, 231249837)
+ZHM_PIN(ThroughWallKill, 1621108147)
+ZHM_PIN(ThrowActivated, -254758250)
+ZHM_PIN(ThrowArcOff, 498342933)
+ZHM_PIN(ThrowArcOn, 45975906)
+ZHM_PIN(ThrowImpact, -303658819)
+ZHM_PIN(TimeMultiplierInBlendIn, -1769221630)
+ZHM_PIN(TimeOut, 1991314158)
+ZHM_PIN(TimeOutPending, -1969265683)
+ZHM_PIN(TimerEnded, 559811855)
+ZHM_PIN(TimerStarted, 1441702495)
+ZHM_PIN(TimersUpdated, -1208855358)
+ZHM_PIN(ToBlack, 1026739556)
+ZHM_PIN(ToGame, -1612559760)
+ZHM_PIN(Toggle, 575056061)
+ZHM_PIN(Toggled, 758104917)
+ZHM_PIN(ToggledOff, 847269377)
+ZHM_PIN(ToggledOn, 1502812766)
+ZHM_PIN(TotalCoverValue, -2087473529)
+ZHM_PIN(TotalSeconds, -914542825)
+ZHM_PIN(Tracked, -1760909726)
+ZHM_PIN(Transform, -180157682)
+ZHM_PIN(TrespassEscortAck, 1270701846)
+ZHM_PIN(TrespassEscortArrest, 49199309)
+ZHM_PIN(TrespassEscortOk, 649692372)
+ZHM_PIN(TrespassEscortOutActive, 1395243991)
+ZHM_PIN(TrespassEscortRequest, 1745607207)
+ZHM_PIN(TrespassEscortRequestRepeat, -405604071)
+ZHM_PIN(TrespassEscortStandDown, -568017300)
+ZHM_PIN(TrespassEscortStayClose, 623830022)
+ZHM_PIN(Trespassing, -488520781)
+ZHM_PIN(TrespassingAttentionMax, -398903749)
+ZHM_PIN(TrespassingAttentionMaxPan, -1154026753)
+ZHM_PIN(Trigger, -707381567)
+ZHM_PIN(TriggerBeforeRaycast, 1777100653)
+ZHM_PIN(TriggerPressed, 2074030651)
+ZHM_PIN(TriggerRelease, -24344228)
+ZHM_PIN(Triggered, 249007644)
+ZHM_PIN(TriggeredStealthSituation, -1426741825)
+ZHM_PIN(TurnLightOn, 1601692283)
+ZHM_PIN(TutorialEnd, 1364874445)
+ZHM_PIN(TutorialHintClosed, 209335169)
+ZHM_PIN(TutorialHintOpened, -1511302850)
+ZHM_PIN(TutorialStart, -819608024)
+ZHM_PIN(TypeRepositoryId, -1152600142)
+ZHM_PIN(UIAbortConversation, 316088787)
+ZHM_PIN(UIScrollOption, -1677454559)
+ZHM_PIN(UISelectOption, 1441342114)
+ZHM_PIN(UISkipLine, 450168469)
+ZHM_PIN(Unclamped, -1249961833)
+ZHM_PIN(Unequipped, 1481929005)
+ZHM_PIN(Unmark_Local, -1534646197)
+ZHM_PIN(Unmark_Remote, 356965440)
+ZHM_PIN(UnnoticedKill, -1835169493)
+ZHM_PIN(UnnoticedPacified, 1122758015)
+ZHM_PIN(UnsetCurrentAmbience, -1495113914)
+ZHM_PIN(Untracked, -562634082)
+ZHM_PIN(Up, -703542574)
+ZHM_PIN(UpToOrange, 1261253234)
+ZHM_PIN(UpToWhite, 428401809)
+ZHM_PIN(UpdatedPriority, 2069308737)
+ZHM_PIN(UseHealthStation, 800312554)
+ZHM_PIN(VR_CrowdImpact_Bother, -595822949)
+ZHM_PIN(VR_CrowdImpact_Kill, -402125284)
+ZHM_PIN(VR_ItemDrop, 227216306)
+ZHM_PIN(VR_ItemEquip, 33672954)
+ZHM_PIN(VR_ItemHolster, 2021757299)
+ZHM_PIN(VR_ItemStuckInActor, 1738520523)
+ZHM_PIN(VR_ItemThrowDeadly, -764265622)
+ZHM_PIN(VR_ItemThrowNormal, -1403561483)
+ZHM_PIN(VR_NPCImpact_Bother, 808301223)
+ZHM_PIN(VR_NPCImpact_Kill, 108932144)
+ZHM_PIN(VR_NPCImpact_Pacify, -1309663220)
+ZHM_PIN(VR_NPCImpact_Slap, 884454313)
+ZHM_PIN(VR_PrimeMelee, 1336182176)
+ZHM_PIN(VR_SnapNeckKillEvent, -1943654082)
+ZHM_PIN(VR_StartDraggingBody, -1710618329)
+ZHM_PIN(VR_StartPrecisionAim, 1291932997)
+ZHM_PIN(VR_StartSilentTakedown, 439972190)
+ZHM_PIN(VR_StartSnapNeck, -429132175)
+ZHM_PIN(VR_StartThreateningHandPose, -1245904875)
+ZHM_PIN(VR_StopDraggingBody, 499376918)
+ZHM_PIN(VR_StopPrecisionAim, -892813452)
+ZHM_PIN(VR_StopSilentTakedown, -1665402301)
+ZHM_PIN(VR_StopSnapNeck, -582766038)
+ZHM_PIN(VR_StopThreateningHandPose, -1728212417)
+ZHM_PIN(VR_StuckItemPulledOut, 1894287286)
+ZHM_PIN(VR_UnprimeMelee, -1464759458)
+ZHM_PIN(VR_UpdateDragBodyForce, -588832793)
+ZHM_PIN(VR_UpdateSilentTakedown, -1881262729)
+ZHM_PIN(Value, -592021712)
+ZHM_PIN(ValueChanged, 554657752)
+ZHM_PIN(Vector2, 701129125)
+ZHM_PIN(Vector3, 1590513971)
+ZHM_PIN(VectorMagnitude, -2024537553)
+ZHM_PIN(VectorValue, -1607050401)
+ZHM_PIN(VentEnter, -1964776811)
+ZHM_PIN(VentExit, 70687331)
+ZHM_PIN(VentPeekStart, 580178702)
+ZHM_PIN(VentPeekStop, -383612090)
+ZHM_PIN(VisiblyArmed, 717110842)
+ZHM_PIN(W, 655174618)
+ZHM_PIN(Warn1, 845057677)
+ZHM_PIN(Warn2, -1420304585)
+ZHM_PIN(WarnOffPath, -273817656)
+ZHM_PIN(WarnStopped, -345710127)
+ZHM_PIN(WarzoneBegin, -1035962704)
+ZHM_PIN(WaypointActFinished, 1101493748)
+ZHM_PIN(WaypointReached, -302761652)
+ZHM_PIN(Weapon, 1855955664)
+ZHM_PIN(WeaponAimStart, -1362076449)
+ZHM_PIN(WeaponAimStop, 2127669528)
+ZHM_PIN(WeaponEquip, 1343552391)
+ZHM_PIN(WeaponEquipAssaultRifle, -2026016605)
+ZHM_PIN(WeaponEquipDualPistols, -694644666)
+ZHM_PIN(WeaponEquipIllegal, 2046825726)
+ZHM_PIN(WeaponEquipLegal, -778681208)
+ZHM_PIN(WeaponEquipMelee, -49021063)
+ZHM_PIN(WeaponEquipShotgun, 1301965115)
+ZHM_PIN(WeaponEquipSinglePistol, 1146775227)
+ZHM_PIN(WeaponEquipSniperRifle, 675988200)
+ZHM_PIN(WeaponEquipSuspicious, 1643955720)
+ZHM_PIN(WeaponEquipped, -267556161)
+ZHM_PIN(WeaponFire, 1486310636)
+ZHM_PIN(WeaponFireEmpty, 534685362)
+ZHM_PIN(WeaponFireWhileCrippled, -1968477833)
+ZHM_PIN(WeaponPlayerEquipped, -15234501)
+ZHM_PIN(WeaponPlayerUnEquipped, -424863856)
+ZHM_PIN(WeaponPrecisionAim, -380837929)
+ZHM_PIN(WeaponPrecisionAimComplete, -1222848155)
+ZHM_PIN(WeaponPrecisionAimReset, 578987726)
+ZHM_PIN(WeaponReload, 447155298)
+ZHM_PIN(WeaponScroll, 1426652340)
+ZHM_PIN(WeaponSilencersEquip, -173047304)
+ZHM_PIN(WeaponSilencersUnequip, -2048813032)
+ZHM_PIN(WeaponStartReload, -1369784344)
+ZHM_PIN(WeaponSwap, 635093058)
+ZHM_PIN(WeaponSwapped, 654786286)
+ZHM_PIN(WeaponUnEquip, 1549266876)
+ZHM_PIN(WeaponUnEquipIllegal, 497432826)
+ZHM_PIN(WeaponUnEquipLegal, 108360002)
+ZHM_PIN(WeaponUnEquipSuspicious, 1618019264)
+ZHM_PIN(WeaponUnEquipped, 424191933)
+ZHM_PIN(Weight, 6377591)
+ZHM_PIN(WentAboveMax, 1350067353)
+ZHM_PIN(WentBelowMin, 908688100)
+ZHM_PIN(WentIntoRange, -187877283)
+ZHM_PIN(WireDetach, 445890690)
+ZHM_PIN(WithinProximityChanged, 155523603)
+ZHM_PIN(WithinThreshold, -538528601)
+ZHM_PIN(WorldPosition, -1758920068)
+ZHM_PIN(Wounded, 1979450136)
+ZHM_PIN(X, -1213057461)
+ZHM_PIN(Y, -1061878051)
+ZHM_PIN(Z, 1505515367)
+ZHM_PIN(ZoomMapIn, 1033081092)
+ZHM_PIN(ZoomMapOut, 797030920)
+ZHM_PIN(nAcknowledge, -273794410)
+ZHM_PIN(reportSetpieceUsed, -1061239543)
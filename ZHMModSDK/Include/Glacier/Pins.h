@@ -2,1799 +2,7 @@
 
 enum class ZHMPin
 {
-    AI_Info_Displayed = 568878519,
-    Aborted = -506102458,
-    Abs = 282990406,
-    Accident = 1984411961,
-    AccidentKill = -420903384,
-    ActEvent4001 = 707117500,
-    ActEvent4002 = -1288925178,
-    ActEvent4003 = -1003773808,
-    ActEvent4004 = 1515140403,
-    ActEvent4005 = 759694757,
-    ActEvent4006 = -1270787041,
-    ActEvent4007 = -1018796919,
-    Activate = 1326475003,
-    Activated = -1292013250,
-    ActivatedInputAction = 1690786288,
-    ActivatedVoid = -1275873675,
-    ActiveRegionChanged = -1471011051,
-    ActiveStage = 912576881,
-    Actor = -2051769859,
-    ActorBeingDumped = -2053706475,
-    ActorBeingPushed = -1088258052,
-    ActorBotherBody = -628534001,
-    ActorBotherHead = -1496143839,
-    ActorBotherIActor = 1563894,
-    ActorBotherPos = 2062966253,
-    ActorEntered = -1435515932,
-    ActorExited = 1213618955,
-    ActorId = -1569288146,
-    ActorKillBody = -1827480325,
-    ActorKillHead = -280419883,
-    ActorKillIActor = -459044272,
-    ActorKillPos = -2009537525,
-    ActorName = -867807090,
-    ActorPacifyBody = 274575217,
-    ActorPacifyHead = 1812353631,
-    ActorPacifyIActor = -322741928,
-    ActorPacifyPos = 349088028,
-    ActorPosition = 1520008257,
-    ActorSlapBody = 2012917919,
-    ActorSlapHead = 195120561,
-    ActorSlapIActor = -1590235800,
-    ActorSlapPos = 1855687559,
-    ActorType = 515602849,
-    AddedEntity = -92920395,
-    AddedKeyword = -1576697549,
-    AddedSignal = -2142047192,
-    AddedToPhysicsWorld = -522922342,
-    AgilityEnter = 2070210711,
-    AgilityIsLanding = 520726377,
-    AgilityIsMoving = 63625238,
-    AgilityLeave = 1503963177,
-    AgilityStart = 1567456630,
-    AgilityStop = 2055292938,
-    AimLookAt = -267339999,
-    Alert = -700683835,
-    AlertHigh = 1273080814,
-    AlertableActorOnScreen = 1674391351,
-    AlertableGuardOnScreen = -232332836,
-    AllBodiesHidden = -625856522,
-    AllPacifiedHidden = -10159224,
-    AllTargetsKilled = 1380215166,
-    AllTestsFinished = -539270975,
-    Alpha = 287381102,
-    Ambient = -1934828716,
-    AmmoPickup = -29460971,
-    AngleLookAt = 798120869,
-    AnimationPose = -1303585406,
-    Any = 1556001108,
-    Armed = 1893567523,
-    Arrest = 713307401,
-    AttackElbow = 1815403015,
-    AttackKick = -985146747,
-    AttackKnee = 1911178881,
-    AttentionMax = 534919292,
-    AttentionMaxPan = 1096896415,
-    AttentionOSDVisible = -86883465,
-    AttentionOff = -1456977994,
-    AttentionOn = -1789387362,
-    Attenuation = 2041014083,
-    AudibleAttentionMax = -1294148096,
-    AudibleAttentionMaxPan = -707815481,
-    AudioDone = 292280943,
-    AxisValue = -648446021,
-    BackCarriesItem = 1763896352,
-    BackwardVector = -315490537,
-    Barrel = -1647496575,
-    BeingFrisked = 2134761969,
-    BlendInActivated = -1555144145,
-    BlendInStart = 1903821738,
-    BlendInStop = -1268703308,
-    BloodPoolFound = -1962991728,
-    BodyBagPlaced = 185888315,
-    BodyDraggingSeen = -1878551637,
-    BodyFall = 1860519465,
-    BodyFound = 455064232,
-    BodyFoundAccident = 1851409203,
-    BodyFoundMurder = -1402020903,
-    BodyFoundPacify = -624635332,
-    BodyFoundPacifyId = 831738673,
-    BodyHidden = -377649393,
-    BodyInContainer = -650145594,
-    BodyOverRail = -1666588721,
-    Bodyshot = -1635729760,
-    BoneBreak = -1752585046,
-    BoneWeight = 1465110913,
-    BoxSize = 139393511,
-    BreakWeaponOnTarget = -803763413,
-    BulletFlyByHitman = -836715060,
-    BundleDestroyed = -699983294,
-    ButtonHoldComplete = 5742987,
-    ButtonHoldFraction = -1133515826,
-    ButtonHoldStart = -1593238588,
-    ButtonHoldTerminated = -992282053,
-    ButtonPressed = -802475407,
-    CC_AttackWindow_End = 524274499,
-    CC_AttackWindow_Start = 177582941,
-    CC_Break_Neck_NPC = -55375540,
-    CC_Choice = 73173307,
-    CC_End = 1942177871,
-    CC_End_Escape = 1560298195,
-    CC_End_Loose = 1826571955,
-    CC_End_Win = 1372148852,
-    CC_Failed = 1534882014,
-    CC_Fiber_Wire_Impact = -326007876,
-    CC_Final_Impact = 1329099068,
-    CC_Impact_Counter = -2116129107,
-    CC_Impact_Hitman = -1878461629,
-    CC_Impact_NPC = -743660826,
-    CC_Impact_NormalAttack = 1671095440,
-    CC_Miss = 946268862,
-    CC_Miss_Take_Down = -603469329,
-    CC_PerfectAttackActivated = -1069575058,
-    CC_PerfectAttackDeactivated = -2046375193,
-    CC_Prop_Kill_Back = -42667390,
-    CC_SlowdownWindow_End = -503263315,
-    CC_SlowdownWindow_Start = -855288807,
-    CC_Slowdown_Counter = 1692758668,
-    CC_Slowdown_Faction = 650341732,
-    CC_Slowdown_Takedown = -724124110,
-    CC_Start = -762232265,
-    CC_Start_AttackChain = -120500516,
-    CC_Start_Hitman = 34204949,
-    CC_Start_NPC = -2094678967,
-    CC_Strangle_Button = 808929138,
-    CC_Strangle_Fraction = -1100547987,
-    CC_Success = -1060162771,
-    CC_TakedownWindowHigh_Start = -1871263203,
-    CC_TakedownWindowLow_Start = 1240199351,
-    CC_TakedownWindow_End = 692388994,
-    CC_Time_Multiplier = 1127499902,
-    CPDoorOpen = 1808439326,
-    CanNotOpenCPDoor = 1644468085,
-    Cancelled = 2063890788,
-    Car = 1332781181,
-    CaughtArmed = -469256161,
-    ChallengeComplete = 225062519,
-    ChallengePartiallyComplete = 341488514,
-    ChangeAmmo = -1666275037,
-    ChangeFrame = -866671170,
-    Changed = 1817052262,
-    ChangedDisguise = -653677082,
-    ChangedDisguiseClean = 2010068019,
-    ChangedEntryValue = -1678200931,
-    ChannelA = -1028271776,
-    ChannelB = 1539080410,
-    Checkpoint_NewStart = -2112070682,
-    Checkpoint_Picklock_Fail = -1015371412,
-    Checkpoint_Picklock_Start = -734471094,
-    ChokeOutUsed = -1390283106,
-    CivilianGameTensionAlertedLow = -637245011,
-    Clamped = -66888597,
-    ClipEmpty = -59080782,
-    CloseCalled = -661915685,
-    CloseCombatEnded = 989278753,
-    Closed = 57362642,
-    ClosestDistance = -1050746610,
-    ClosestTrackPoint = -841255486,
-    ClosetPeekStart = -948588044,
-    ClosetPeekStop = -570524533,
-    ClothBundleSpawned = -1752077672,
-    ClothRustle = 1392066976,
-    ClothStretch = -1150367653,
-    ClothSwoosh = 1513232368,
-    Color = -1483249683,
-    ColorRGB = 1384014433,
-    Combat = -1963071826,
-    CombatHitmanHidden = -2049395358,
-    CombatHitmanSpotted = -1556250776,
-    Completed = -1207312691,
-    Condition0 = 1424890451,
-    Condition1 = 602483397,
-    Condition2 = -1159693441,
-    Condition3 = -840479767,
-    Condition4 = 1401151050,
-    Condition5 = 612691676,
-    Condition6 = -1114783898,
-    Condition7 = -896888848,
-    Condition8 = 1513460321,
-    Condition9 = 758293239,
-    ContainedItem = 1562825685,
-    ContainedItemBreakOut = -563669641,
-    ContainedItemDestroyed = -1827523941,
-    ContainedItemEjected = 1097579739,
-    ContainerFull = 1306673225,
-    ContainsVictim = 803123667,
-    ContextKillActor = 685215694,
-    ContextLink = 1024268177,
-    Continue = -359315319,
-    ControllerHintClosed = 740363042,
-    ControllerHintOpened = -2052038243,
-    Count = 1142451046,
-    CounterEnded = -1696953393,
-    CounterStarted = -1697650560,
-    CountersUpdated = -1588479283,
-    CoverDisabled = -1303173227,
-    CoverEnabled = -17155282,
-    CoverToCover = 1476479167,
-    CoverUsed = -1535163882,
-    CrippleBoxCanHolsterCurrentState = 1497540539,
-    CrippleBoxCanHolsterOnStateChanged = -504659651,
-    CrossBackward = 518928791,
-    CrossForward = -465848409,
-    CrowdActEnded = -1999675983,
-    CrowdActPossessionFailed = -2018743330,
-    CrowdActStarted = 1153685772,
-    CrowdActorDeselected = 1481361782,
-    CrowdActorDeselectedID = -1978753259,
-    CrowdActorDied = -1759036093,
-    CrowdActorSelected = -1284021646,
-    CrowdActorSelectedID = -1352217779,
-    CrowdActorSelectionFailed = -1348423010,
-    CrowdAlertFemaleRatio = -285549042,
-    CrowdAlertFemaleRatio_Back = -1848883523,
-    CrowdAlertFemaleRatio_Left = -2040176414,
-    CrowdAlertFemaleRatio_Right = -1185210963,
-    CrowdAlertMaleRatio = -628985965,
-    CrowdAlertMaleRatio_Back = -61061380,
-    CrowdAlertMaleRatio_Left = -336240477,
-    CrowdAlertMaleRatio_Right = -1192362837,
-    CrowdAlertNearestActor = -798497675,
-    CrowdAlertNearestActor_Back = 878100344,
-    CrowdAlertNearestActor_Left = 603953447,
-    CrowdAlertNearestActor_Right = 1391505771,
-    CrowdAlertRatio = -571754013,
-    CrowdAlertRatio_Back = 251012638,
-    CrowdAlertRatio_Left = 425656385,
-    CrowdAlertRatio_Right = -165948001,
-    CrowdAmbientFemaleRatio = 1968962682,
-    CrowdAmbientFemaleRatio_Back = -576060543,
-    CrowdAmbientFemaleRatio_Left = -905763362,
-    CrowdAmbientFemaleRatio_Right = -1770518673,
-    CrowdAmbientMaleRatio = -2139287253,
-    CrowdAmbientMaleRatio_Back = -1446554699,
-    CrowdAmbientMaleRatio_Left = -1100057110,
-    CrowdAmbientMaleRatio_Right = -1212637558,
-    CrowdAmbientNearestActor = -2020282254,
-    CrowdAmbientNearestActor_Back = 460694970,
-    CrowdAmbientNearestActor_Left = 215778277,
-    CrowdAmbientNearestActor_Right = 666186221,
-    CrowdAmbientRatio = -179502272,
-    CrowdAmbientRatio_Back = -887692578,
-    CrowdAmbientRatio_Left = -591412095,
-    CrowdAmbientRatio_Right = 1840969707,
-    CrowdBotherBody = -1775520393,
-    CrowdBotherHead = -361740199,
-    CrowdBotherPos = -1324975156,
-    CrowdCulledRatio = -1594045430,
-    CrowdCulledRatio_Back = -198483632,
-    CrowdCulledRatio_Left = -478001393,
-    CrowdCulledRatio_Right = 1736795215,
-    CrowdDensity1 = 1398041051,
-    CrowdDensity1_Back = -755933144,
-    CrowdDensity1_Left = -984070537,
-    CrowdDensity1_Right = 964511552,
-    CrowdDensityTotal = -500227772,
-    CrowdDownFemaleRatio = -356242227,
-    CrowdDownFemaleRatio_Back = 1502545668,
-    CrowdDownFemaleRatio_Left = 1311121755,
-    CrowdDownFemaleRatio_Right = 187585988,
-    CrowdDownMaleRatio = -605363106,
-    CrowdDownMaleRatio_Back = -2007043979,
-    CrowdDownMaleRatio_Left = -1611147734,
-    CrowdDownMaleRatio_Right = 754828697,
-    CrowdDownNearestActor = -770815603,
-    CrowdDownNearestActor_Back = -2044463343,
-    CrowdDownNearestActor_Left = -1853173426,
-    CrowdDownNearestActor_Right = 1714167263,
-    CrowdDownRatio = 153055956,
-    CrowdDownRatio_Back = -350031720,
-    CrowdDownRatio_Left = -57944377,
-    CrowdDownRatio_Right = -232446116,
-    CrowdKillBody = 42430795,
-    CrowdKillHead = 2128383077,
-    CrowdKillPos = 2046411589,
-    CrowdScaredFemaleRatio = -1935361479,
-    CrowdScaredFemaleRatio_Back = 123750624,
-    CrowdScaredFemaleRatio_Left = 281636543,
-    CrowdScaredFemaleRatio_Right = -1407738646,
-    CrowdScaredMaleRatio = 1894773892,
-    CrowdScaredMaleRatio_Back = 1346004955,
-    CrowdScaredMaleRatio_Left = 1200832900,
-    CrowdScaredMaleRatio_Right = 491466721,
-    CrowdScaredNearestActor = 1756897054,
-    CrowdScaredNearestActor_Back = 555367999,
-    CrowdScaredNearestActor_Left = 917706848,
-    CrowdScaredNearestActor_Right = -1168299559,
-    CrowdScaredRatio = -1127989984,
-    CrowdScaredRatio_Back = -1919955390,
-    CrowdScaredRatio_Left = -1708726243,
-    CrowdScaredRatio_Right = -1807371864,
-    CurrentAmbience = -799826532,
-    CurrentGait = 1338905183,
-    CurrentHealth = 1412363848,
-    CurrentLocale = -613149757,
-    CurrentMapRotationZ = -2093962150,
-    CurrentRegion = -1785322451,
-    CurrentTextLocale = 1843705076,
-    CutSequenceEnded = 1643864777,
-    CutSequenceStarted = 356773627,
-    DataEnd = -1497880383,
-    DataStart = 975389649,
-    Deactivate = -1318334333,
-    Deactivated = -320998522,
-    Dead = 1293411866,
-    DeadBodySeenAccident = -458839207,
-    DeadBodySeenMurder = -2068219174,
-    DeadBodySeenMurderId = -507874564,
-    DeadlyThrowActivated = -426470935,
-    DeadlyThrowImpact = 1640406207,
-    DeadlyThrowOff = 1891030449,
-    DeadlyThrowOn = -577714569,
-    Death = 646380074,
-    DeathContext = 1239111071,
-    DeepTrespassing = 567961179,
-    Default = 753088835,
-    Deselected = -1616614488,
-    DetectedKill = 1962060764,
-    DetectedPacified = -912301622,
-    DialogOpened = -1145455599,
-    Died = 543283834,
-    DiffusePower = 1573485654,
-    Disable = -2131200819,
-    Disabled = 2106068149,
-    DisarmedEnemy = -1116585443,
-    Discharge_Shot = 2070772009,
-    Discharge_ShotCompletelySilenced = -260429516,
-    Discharge_ShotSilenced = -388105389,
-    Discharge_ShotSuperSilenced = 551274368,
-    DisguiseAttentionMax = -1056929777,
-    DisguiseAttentionMaxPan = -1122519900,
-    DisguiseBeingInvestigated = -348666816,
-    DisguiseBlendInActivated = 314179056,
-    DisguiseBlown = -1185561239,
-    DisguiseBroken = 1707574743,
-    DisguiseHealth = 1236667056,
-    DisguiseSuspicious = 925476141,
-    DisguiseTaken = -614291559,
-    DisplayingObjectivesBarWithoutChanges = -1134510055,
-    Distance = -437978921,
-    DistanceChanged = -954305844,
-    DistanceToAlertableActor = -2108459676,
-    DistanceToAlertableGuard = 1765027921,
-    DistanceToEngagedActor = 1532297061,
-    DivideByZero = 2037073175,
-    Done = -1340125291,
-    DoorBroken = -772212179,
-    DoorCancelLockpicking = 1659962880,
-    DoorClose = 1128938921,
-    DoorCloseByAny = -1997098449,
-    DoorCloseByHitmanFirst = 425629881,
-    DoorCloseNoOperator = -329466639,
-    DoorClosed = 932453309,
-    DoorHidePadlock = 1578516374,
-    DoorLocked = -645816632,
-    DoorOpen = -356658476,
-    DoorOpenByAny = -924408374,
-    DoorOpenByAnyIn = 1572932265,
-    DoorOpenByAnyOut = -2021247034,
-    DoorOpenByHitmanFirst = 724716334,
-    DoorShowPadlock = -2134327380,
-    DoorStartLockpicking = -164539140,
-    DoorUnlocked = -394641512,
-    Dot = 1038040643,
-    Down = -1127399675,
-    DownToAmbient = 117742386,
-    DraggedBodyElevationChanged = 2074838923,
-    DraggingDirChanged = -2003012526,
-    DraggingStart = -1189861868,
-    DraggingStartMoving = -72451378,
-    DraggingStop = 219488646,
-    DraggingStopMoving = 1674256447,
-    DumpsterEndDumpingBody = -1813427075,
-    DumpsterFull = -1817898037,
-    DumpsterStartDumpingBody = 14523148,
-    Duration = 2133451414,
-    DynamicRangeModeHigh = -1392667734,
-    DynamicRangeModeLow = 48530779,
-    DynamicRangeModeMedium = -1690959454,
-    EjectCartridge = 737444799,
-    EjectCartridgeHitman = -1802303860,
-    EjectCartridgeNPC = -1269338067,
-    EliminateSilentUsed = -319493704,
-    EliminateUsed = -1405221831,
-    Else = -175506763,
-    EmptyShot = -1685454249,
-    Enable = -200487676,
-    EnablePickup = 876426755,
-    Enabled = -1622900200,
-    EndFire = 213599210,
-    EnemiesIsAlerted = -2086941451,
-    EnemiesIsAlertedArmed = 763010601,
-    EnemiesIsEngaged = 470876117,
-    EnemiesIsInCombat = 283673254,
-    EnterAimAt = 1702818852,
-    EnterCloset = -501533549,
-    EnterCover = 841871514,
-    EnterLookAt = -1221529608,
-    EnterPeeking = 2133029193,
-    EnterPeekingDone = 2099462537,
-    EnterSafeZoneAny = -1598662432,
-    EnterSniperMode = 767749257,
-    EnterVent = 2014155688,
-    EnvironmentKill = -23863353,
-    Equal = -278250765,
-    Equipped = -334056610,
-    EquippedBulletCount = 1199302009,
-    EquippedHasBullets = -959828560,
-    EquippedIsFirearm = -783088667,
-    EquippedIsNotFirearm = -1624733959,
-    EquippedIsOutOfBullets = 1303120889,
-    EventData = -745274665,
-    EventOccurred = 384083638,
-    EventReceived = 1920686262,
-    EventRegistered = 1198473998,
-    Executed = 4174937,
-    ExecutedData = 558719109,
-    ExitAimAt = 1587332160,
-    ExitCloset = -1459653662,
-    ExitCover = 164610302,
-    ExitLookAt = -36394871,
-    ExitPeeking = 1483461796,
-    ExitPeekingDone = 456079233,
-    ExitSafeZoneAny = -960876824,
-    ExitSniperMode = 663694931,
-    ExitVent = -199409784,
-    Explosion = -211360833,
-    ExplosionAtPos = 632274062,
-    ExplosionDistance = 155403932,
-    ExplosionKill = 1589487333,
-    FaceExpression = -1324515458,
-    FadeHero = -1256261497,
-    Failed = -1725454783,
-    Fiber_Wire_Kill = -351066002,
-    Fiberwire = -770161904,
-    FiberwireKill = 1863890672,
-    FilterOut = -1232937292,
-    Finish = 660991534,
-    Finished = 1597622634,
-    Fired = 1386177760,
-    FireworksBox = -1374258395,
-    FirstSMGShot = -37494971,
-    Fixed = 1594417462,
-    FloatCount = -50705461,
-    FloatValue = 1683249053,
-    FocusAdded = 1378500269,
-    FocusBecameEmpty = -1637335013,
-    FocusBecameFull = -165392267,
-    FocusBurnRate = -1288131943,
-    FocusEmpty = -246246526,
-    FocusFull = 2088773795,
-    FocusGainValue = 477273571,
-    FocusGained = -915024457,
-    FocusLost = -591759191,
-    FocusValue = -2065500558,
-    ForwardSpawn_Enabled = -1118864578,
-    ForwardSpawn_Restored = -1644061124,
-    ForwardVector = -1919612564,
-    FoundCount = -577623905,
-    FoundNode = -1503722376,
-    FoundNothing = -952146913,
-    FoundSomething = 1244037837,
-    FriskFailed = -728921708,
-    FriskSuccess = 1447651930,
-    FuseBoxDisabled = 466106320,
-    FuseBoxDisabledFirstTime = -1657209505,
-    FuseBoxFixed = 1214886053,
-    GameTension = 1085555817,
-    GameTensionAgitated = -908919179,
-    GameTensionAlertedHigh = -1827032565,
-    GameTensionAlertedLow = 1405352445,
-    GameTensionAmbient = 2014866673,
-    GameTensionArrest = 1250345247,
-    GameTensionCivilian = -753556020,
-    GameTensionCivilianHM = -1326975249,
-    GameTensionCivilianHM_Agitated = 1092387038,
-    GameTensionCivilianHM_AlertedHigh = -1957381171,
-    GameTensionCivilianHM_AlertedLow = -1450358742,
-    GameTensionCivilianHM_Ambient = -1103355607,
-    GameTensionCivilianHM_Arrest = 1645390629,
-    GameTensionCivilianHM_Combat = -1033144190,
-    GameTensionCivilianHM_Hunting = 772161269,
-    GameTensionCivilianHM_Searching = -694054276,
-    GameTensionCivilian_Agitated = 1548262553,
-    GameTensionCivilian_AlertedHigh = 1961945125,
-    GameTensionCivilian_AlertedLow = 45404403,
-    GameTensionCivilian_Ambient = 1563427385,
-    GameTensionCivilian_Arrest = 221948333,
-    GameTensionCivilian_Combat = -1388086774,
-    GameTensionCivilian_Hunting = -854975003,
-    GameTensionCivilian_Searching = 1040454227,
-    GameTensionCombat = -352382280,
-    GameTensionGuardHM = -1444146584,
-    GameTensionGuardHM_Agitated = 1651294570,
-    GameTensionGuardHM_AlertedHigh = -261823910,
-    GameTensionGuardHM_AlertedLow = 687829472,
-    GameTensionGuardHM_Ambient = 387590878,
-    GameTensionGuardHM_Arrest = -122220599,
-    GameTensionGuardHM_Combat = 1489951854,
-    GameTensionGuardHM_Hunting = -2027932414,
-    GameTensionGuardHM_Searching = 445552040,
-    GameTensionHunting = -400395475,
-    GameTensionSearching = -1758648734,
-    GameTensionSearchingHitmanClear = 758302041,
-    GasCanister = -1023175525,
-    GasTank = 1300108658,
-    Generic00 = 829621742,
-    Generic01 = 1182020984,
-    Generic02 = -545430334,
-    Generic03 = -1468378028,
-    Generic04 = 907985399,
-    Generic05 = 1092219233,
-    Generic06 = -669998885,
-    Generic07 = -1357410227,
-    GentlePush = -1527339089,
-    GentlePushSignal = 613534905,
-    GetDelayValue = 739878568,
-    GetFalse = 594118689,
-    GetTrue = 874606784,
-    GetValue = 366196773,
-    GhostPosition = 1219583217,
-    GlobalHintClosed = 2003437284,
-    GlobalHintOpened = -553948069,
-    Glow = 1246633515,
-    GlowColor1 = -373482213,
-    GlowColor2 = 1890864289,
-    GlowType = -1248553897,
-    Grab = -1347921612,
-    GroundSoundMaterialChanged = -710441975,
-    GuardKill = 965540297,
-    HMFootstepMaterialChanged = -1603299529,
-    HMJump_Timemultiplier = 229787503,
-    HMMovementIndex = 1548839364,
-    HMState_CloseDoor = 1850578665,
-    HMState_Jump = 1876105409,
-    HMState_JumpFail = -1916201527,
-    HMState_JumpLand = -1544623272,
-    HMState_JumpLandGrab = -1954255608,
-    HMState_LeftStep = 1990263798,
-    HMState_OpenDoor = -1471094560,
-    HMState_RightStep = 1395943075,
-    HMState_StartRun = 826208500,
-    HMState_StartSneak = -1675689571,
-    HMState_StartWindowKill = -1453132734,
-    HMState_StopRun = 642604247,
-    HMState_StopSneak = -36270516,
-    HMState_SwingAtWill = 1255625420,
-    HM_BurstShot = -590398782,
-    HM_BurstShotSilenced = -715694365,
-    HM_EndBurstShot = -1128219479,
-    HM_HitNPC = 1482210449,
-    HM_HitNPCAt = 1432274234,
-    HM_HitNPCCloseCombatShot = 1828869218,
-    HM_HitNPCHeadShot = 805179315,
-    HM_HitNPCHeadShotAt = -1601956214,
-    HM_HitNPCHeadShot_IActor = -861002280,
-    HM_HitNPCKilled = 1292662490,
-    HM_HitNPCKilledAt = 1029860622,
-    HM_HitNPCKilled_IActor = 1568033874,
-    HM_SingleShot = -2139709845,
-    HM_SingleShotSilenced = 328676686,
-    HM_WeaponEquipped = -1372955741,
-    HM_WeaponPickedUp = -663008724,
-    HM_WeaponSwapped = -556847978,
-    HM_WeaponUnequipped = 1469564587,
-    HangToStand = 985949464,
-    HardPush = 1183799905,
-    HardPushSignal = 59165769,
-    HasNoUnconsciousWitness = 550123105,
-    HasStartupState = 406552669,
-    HasUnconsciousWitness = 1422716826,
-    HaveActiveParticles = -748757626,
-    HaveUnhiddenBodies = 1887953933,
-    HaveUnhiddenPacified = 1910895628,
-    Headshot = 1670201254,
-    HeadshotKill = -1162163257,
-    Heartbeat = -2004062342,
-    Hero = -235093576,
-    HeroOpacity = -160410446,
-    Hide = 78341141,
-    HideClip = 1872092723,
-    HideInCloset = -358688682,
-    HideInClosetFirstTime = 1280091494,
-    HideIngameHUD = 361076031,
-    HidingObjectivesBar = -272042513,
-    HighClamped = 1889383050,
-    Hit = 1654612129,
-    HitFirstTime = -279160026,
-    HitTarget = -1530826384,
-    HitmanAimBegin = 245403319,
-    HitmanAimEnd = -1375783880,
-    HitmanBumping = 1423077949,
-    HitmanCCBegin = 953385256,
-    HitmanCCEnd = -2107502275,
-    HitmanCivilianKill = 358101749,
-    HitmanCrouchBegin = -899561097,
-    HitmanCrouchEnd = -1436174888,
-    HitmanFullAttention = 1175586220,
-    HitmanGuardKill = -1117048868,
-    HitmanGuardSilenced = 746398392,
-    HitmanHiddenSignal = -845084892,
-    HitmanInCoverBegin = 1496738344,
-    HitmanInCoverEnd = 677263008,
-    HitmanInSight = -725745345,
-    HitmanInVision = -369573832,
-    HitmanLedgePullKill = 109377731,
-    HitmanNotHiddenSignal = -303027400,
-    HitmanNotSuspiciousSignal = -2019264715,
-    HitmanPush = 1740298503,
-    HitmanPushSignal = -719860216,
-    HitmanSBBegin = -1806578109,
-    HitmanSBEnd = 1514070490,
-    HitmanSeenEnter = -455539512,
-    HitmanSeenLeave = -971422602,
-    HitmanSpotted = 1578567825,
-    HitmanSuspiciousSignal = 888302667,
-    HitmanTrespassingSpotted = -255728412,
-    HitmanVisibleWeaponBegin = -1298841599,
-    HitmanVisibleWeaponEnd = 1405138378,
-    HitmanWindowPullKill = -1711572528,
-    HitmanWindowPushKill = -1627689122,
-    HoldingIllegalWeapon = 454411213,
-    HoverMapIcon = 1980019510,
-    Hue = -296215282,
-    IActor = -637307673,
-    IdleEnd = 1213240230,
-    IdleStart = 1277966941,
-    IdleStop = 986529745,
-    IdleTimeOut = -686867597,
-    Impact = -1012546255,
-    ImpactBack = -1022198080,
-    ImpactFrontSide = -843937183,
-    InDisguise = 586420442,
-    InDisguiseZone = -257494807,
-    InLoop = -1614913817,
-    InPosition = -805550112,
-    InSequence = -615091138,
-    InTrespassArea = 1227186950,
-    InTrespassEntryArea = -268470332,
-    InactiveStage = 795905437,
-    Index = 1102202885,
-    Inside = -1118636158,
-    InsideCone = -414278610,
-    InsideCrimeScene = -1376604755,
-    Insideness = -1288063146,
-    InstinctActive = -720458858,
-    InstinctTimeMultiplier = 343275158,
-    InstinctUnavailable = -371033702,
-    Instinct_CC_End = -1296969382,
-    Instinct_CC_Impact = 94065591,
-    Instinct_CC_Start = 1828146865,
-    Instinct_CC_Take_Down = 544656839,
-    IntegerCount = -90444440,
-    IntegerValue = 1647702334,
-    IntelWithinFocus = -428760741,
-    Intensity = 1799567921,
-    Interrupted = 1515570823,
-    Invert = -172069903,
-    InvestigateCautious = 1039203169,
-    InvestigateCurious = -220989773,
-    IsCheckedWhenFrisked = -307256461,
-    IsCrouchRunning = -46244187,
-    IsCrouchWalking = 2053083869,
-    IsCrouchWalkingSlowly = 2048834806,
-    IsHeadshot = 1319394243,
-    IsInState = -235248669,
-    IsLastTriggeredAndNotTracked = -1506462954,
-    IsNPC = -987680797,
-    IsNotTarget = 742505934,
-    IsPerceivedAsWeapon = 1558130473,
-    IsPerceptibleOnRelease = 1836057372,
-    IsPlayer = -1610149143,
-    IsRunning = -887662580,
-    IsTarget = 2121353072,
-    IsVisible = -1635370694,
-    IsWalking = 1282839668,
-    IsWalkingSlowly = 915501286,
-    Item = -1087796704,
-    ItemAutoDroppedDueToMovement = 533846672,
-    ItemCount = 1409080613,
-    ItemFound = -2035596751,
-    ItemImpactBack = 1328591349,
-    ItemImpactFront = -1951187174,
-    ItemImpactLow = 1861092119,
-    ItemOnDeadlyThrow = -1981452847,
-    ItemPrimingStart = 1368560113,
-    ItemPrimingStop = 863434689,
-    ItemPullOut = 1339332540,
-    ItemReady = -22012696,
-    ItemShot = 1480402715,
-    ItemSlitThroat = -953034060,
-    ItemSoundGeneric01 = 2077361705,
-    ItemSoundGeneric02 = -488941677,
-    ItemSoundGeneric03 = -1780717819,
-    ItemSpawned = 1065559647,
-    ItemStashed = 805146540,
-    ItemStuckInActor = -1881841305,
-    ItemUsed = -1971467080,
-    Joined = 1381043253,
-    KeycardPickup = 1998214659,
-    KeycardUse = 1025953972,
-    Keyword = -1792128857,
-    Keyword2 = 1391633934,
-    Keyword3 = 636851864,
-    KeywordCount = -430289529,
-    Kill = -1491338921,
-    KillData = 9101000,
-    KillItemCategory = 2113411094,
-    KillItemInstanceId = 807301811,
-    KillItemRepositoryId = 1557748295,
-    KillOutfit = 976093743,
-    KillType = 564624002,
-    KillWeapon = 1629434824,
-    KillerHero = -1244593319,
-    KillerNPC = -104552758,
-    KnockOutByHandUsed = -353824332,
-    Knockout = 1205879537,
-    LH_Hide = 1650502497,
-    LH_Place = -489553373,
-    LH_Retrieve = 116417107,
-    LH_Show = -185091765,
-    LH_Swap = -479533781,
-    LabelMatch = 1708788742,
-    LadderSlideStart = 1261191006,
-    LadderSlideStop = 1460413909,
-    LastEnemyKilled = -1233920200,
-    LastGuardKilled = -818965661,
-    Last_AI_In_Alerted_Kill = 1367919509,
-    Last_AI_In_Checkpoint_Kill = -402772856,
-    Last_AI_In_Combat_Kill = -1614740663,
-    LateralShift = 685402414,
-    Leaving = -1017725606,
-    LeftHandShot = -1123206723,
-    Lerp = -208250086,
-    LidClose = -2101799572,
-    LidClosed = -597958998,
-    LidOpen = 2022227178,
-    LidOpened = 1976218645,
-    LoadingTransitionDelayEnded = -1047713806,
-    LoadingTransitionDelayStarted = 793187498,
-    LocaleChanged = 1458046379,
-    Log = -1217253851,
-    LoopCounter = 725665862,
-    LooseTargetEncounterCutStarted = -303824650,
-    LosingSight = -779965090,
-    LowClamped = 590142129,
-    LowHealth = -2044772471,
-    MainEventEnded = 1035909196,
-    MapLevelDown = 74310512,
-    MapLevelUp = 410687938,
-    Mark_Local = -704703072,
-    Mark_Remote = 586129293,
-    Marker = -2057099832,
-    MaxDimension = 264153972,
-    MaxFacingAlertableActor = 1239476130,
-    MaxIndex = -1701150800,
-    MaxNumberOfTargets = -1946434418,
-    MaxTensionAlertedHigh = -2109774548,
-    MaxTensionAlertedLow = 1948221990,
-    MaxTensionAmbient = 700075045,
-    MaxTensionArrest = 916860718,
-    MaxTensionCombat = -1763705719,
-    MaxValue = 127811717,
-    MenuClosed = 1470268665,
-    MenuOpened = -30151098,
-    MinDimension = -1613907042,
-    MinIndex = 2096812113,
-    MinValue = -503386268,
-    Mine = -912622419,
-    MockUpAudioDisabled = 796291951,
-    MockUpAudioEnabled = 165244587,
-    MultiplayerSessionPopulated = -1658034508,
-    MusicStarted = 267473092,
-    NPCAlerted = -1162215180,
-    NPCAllShots = 659581906,
-    NPCCivilianAlerted = 716918858,
-    NPCCivilianScared = -1125966295,
-    NPCDead = -153697742,
-    NPCFirstBurstShot = 1659528123,
-    NPCHasExclamationMark = -1130533795,
-    NPCHasQuestionMark = 1113154192,
-    NPCHasWhiteDot = -2078547565,
-    NPCLoopShot = -1736477448,
-    NPCScared = 44970278,
-    NPCShot = -1326185555,
-    NPCWeaponFire = -2133599519,
-    NPC_BurstShot = -1217947856,
-    NPC_BurstShotSilenced = 1439181477,
-    NPC_EndBurstShot = -920325630,
-    NPC_HitHM = 1625061782,
-    NPC_HitHMAt = -250520250,
-    NPC_SingleShot = -743528970,
-    NPC_SingleShotSilenced = -1935126881,
-    NavigateSlots = 1799849892,
-    NavigateTabs = -1652989951,
-    NavigatedBetweenEntries = -1421277450,
-    NeckSnap = 1462450912,
-    Negate = 1278047498,
-    NewObjectiveAtStartHudDisplayed = 1933746956,
-    NewObjectiveDuringLevelHudDisplayed = -1502611781,
-    NextPageTabSelected = 1437582101,
-    NoContainerItem = -1746883515,
-    NoEmptyContainerItem = -1637405133,
-    NoEquipContainedItem = -1611828696,
-    NoMoreInteractive = 847762711,
-    NoPageTabAvailable = 47062522,
-    NoPlaceItem = 1448984542,
-    Node = 625821563,
-    Nodes = -587453704,
-    NonTargetKilled = -1452807755,
-    NormalShot = 1361843442,
-    NotEqual = -1657753213,
-    NumOccupiedSpots = 1349044087,
-    NumOccupiedSpotsFemale = -1830520908,
-    NumOccupiedSpotsMale = 1375266604,
-    NumOccupiedSpotsMalePercent = -1499286996,
-    NumberOfPickups = 1562625588,
-    ObjectEvent01 = 94562626,
-    ObjectEvent02 = -1666467592,
-    ObjectEvent03 = -341014418,
-    ObjectEvent04 = 1976049101,
-    ObjectiveActivate = -1174865207,
-    ObjectiveCompleted = 1881696209,
-    ObjectiveCompletedHudDisplayed = 1145662121,
-    ObjectiveFailed = -45201040,
-    ObjectiveFailedHudDisplayed = 940811552,
-    ObjectiveUpdate = -69148801,
-    OccludersAny = -360419740,
-    OccludersNone = -103963262,
-    Off = 334568355,
-    On = -1674441366,
-    OnAbort = -527968007,
-    OnAbortEntering = -481945564,
-    OnAbortStart = 1115170616,
-    OnAborted = 1593493705,
-    OnAccidentDeath = -403749932,
-    OnAccidentStarted = 1135192372,
-    OnActDone = -749289650,
-    OnActTimeout = -727937483,
-    OnActionA = -1123210116,
-    OnActionB = 604274118,
-    OnActionFailed = -1514768424,
-    OnActionNotUsable = -768318508,
-    OnActionUsed = 1051948010,
-    OnActionX = -647592772,
-    OnActionY = -1369328598,
-    OnActivate = 849926143,
-    OnActivateByHM = -2088851856,
-    OnActivateHit = -898421636,
-    OnActivateImpact = -1283142240,
-    OnActivated = -1242755690,
-    OnActivatedByForwardSpawn = -134830924,
-    OnActive = -1285136377,
-    OnActor = 1581726244,
-    OnActorAIEvent = 874048805,
-    OnActorAdded = -263928463,
-    OnActorBodybagged = 570925775,
-    OnActorCast = -2016547882,
-    OnActorChanged = 861716970,
-    OnActorContained = -843094653,
-    OnActorDead = 2018515716,
-    OnActorEnteredStage1 = -95505457,
-    OnActorEnteredStage1Signal = 132224878,
-    OnActorEnteredStage2 = 1665655413,
-    OnActorEnteredStage2Signal = 906595827,
-    OnActorEnteredStage3 = 339792611,
-    OnActorEnteredStage3Signal = -1870756281,
-    OnActorHit = -1865775991,
-    OnActorImpact = -722976504,
-    OnActorInvestigated = -1841541141,
-    OnActorInvestigating = -982840025,
-    OnActorInvestigationTerminated = 1708739909,
-    OnActorNotAdded = -1669994159,
-    OnActorNotContained = -561815560,
-    OnActorNotRemoved = -1986059747,
-    OnActorPacified = -389497813,
-    OnActorPickup = 1367324914,
-    OnActorReacted = -1570668358,
-    OnActorReleased = -429728114,
-    OnActorRemoved = 784533101,
-    OnActorRevived = 479788834,
-    OnActorSeen = 824662072,
-    OnActorSet = 739018516,
-    OnActorSpawned = -1714946488,
-    OnActorTagged = 754850106,
-    OnActorUntagged = -891162325,
-    OnActorWillReact = 1845519255,
-    OnAdded = -779224010,
-    OnAlarm = 1856842240,
-    OnAlerted = 775991576,
-    OnAlive = 168375950,
-    OnAllEscortsDied = 76695108,
-    OnAmbient = 864251611,
-    OnAnchorsLost = -1363691560,
-    OnArrival = 729272487,
-    OnAttach = 649191556,
-    OnAttachToHitman = -2015245018,
-    OnAttachToNPC = -758786914,
-    OnAttached = -328617510,
-    OnAvailable = 544103054,
-    OnBaseScoreUpdate = -831627984,
-    OnBecomeInvisible = 873895432,
-    OnBecomeVisible = -1755695355,
-    OnBehaviorEnded = -1768105670,
-    OnBehaviorStarted = 1986118118,
-    OnBloodyKill = -1906994849,
-    OnBodyBagged = 1354378407,
-    OnBodyDumped = 1700244329,
-    OnBodyFlushed = 1282824030,
-    OnBodyFound = 470795776,
-    OnBodyHidden = 829930665,
-    OnBodyNoticed = -140764611,
-    OnBroken = 450048113,
-    OnBusy = 656542102,
-    OnCameraDestroyed = 1604174492,
-    OnCaptured = -856133169,
-    OnCastRole = -978178278,
-    OnChallengeCompleted = -1997943776,
-    OnChange = -1204854235,
-    OnChangedOutfit = 622322646,
-    OnCheckLastKnownPosition = 1445168156,
-    OnCleared = -121614,
-    OnClosed = -54537759,
-    OnCollision = -567485003,
-    OnCollisionEnergyReached = -154796102,
-    OnCombat = 1965653917,
-    OnCombatEnded = -279094532,
-    OnCombatStarted = -1620043147,
-    OnComplete = -962002063,
-    OnCompleted = -1088839067,
-    OnCompletedByForwardSpawn = 1942744048,
-    OnCompliedAfterWarning = -1500696205,
-    OnCompromised = -1679036120,
-    OnConsumed = 4280612,
-    OnContained = -1231575231,
-    OnContainerDestroyed = -62857159,
-    OnCooldown = 1521352587,
-    OnCorneredBegin = -234127033,
-    OnCorneredEnd = -1650835615,
-    OnCured = 1531134062,
-    OnCurious = 297579369,
-    OnCurrent = -1402882024,
-    OnDeactivate = 1768024869,
-    OnDead = 94234928,
-    OnDeadlyHeavyItem = -857297884,
-    OnDeadlyLightItem = 1681488391,
-    OnDeath = -42616333,
-    OnDeathNPC = 1925278096,
-    OnDestroyed = 1585261621,
-    OnDetach = 737988357,
-    OnDetached = 1696606404,
-    OnDidEnterCombat = 83379023,
-    OnDisabled = 3194289,
-    OnDollyTargetingFirstPoint = 1491731690,
-    OnDollyTargetingLastPoint = 1513902964,
-    OnDone = -124436289,
-    OnDrainHealthDone = 121027555,
-    OnDrainHealthStarted = 422905798,
-    OnDramaNewBehavior = 646635467,
-    OnDramaResuming = -1861010259,
-    OnDrop = -1733450442,
-    OnDropByHero = -238204392,
-    OnDying = -918821082,
-    OnEffectActivated = -1173589239,
-    OnEffectDeactivated = -1831585169,
-    OnEject = -1895960560,
-    OnEmoteStarted = -219356110,
-    OnEnabled = 543897495,
-    OnEnd = 8918262,
-    OnEndDumpingBody = -743900411,
-    OnEnded = 1269873298,
-    OnEnter = -1555911501,
-    OnEnterConnector = 1449840198,
-    OnEnterDeadZone = 848947988,
-    OnEnterDrama = -1350900147,
-    OnEnterRole = -1519468559,
-    OnEnterScopeMode = 35076535,
-    OnEntered = 50633126,
-    OnEntering = -845739812,
-    OnEqual = 882473258,
-    OnErased = 367619116,
-    OnEscaping = -1966822982,
-    OnEscapingEnd = 330567444,
-    OnEvacuationStandDown = -181619023,
-    OnEvacuationStarted = -741973037,
-    OnEvent = 563897978,
-    OnEvent1 = 858647539,
-    OnEvent2 = -1440433591,
-    OnEvent3 = -584873249,
-    OnEvent4 = 1128734588,
-    OnEvent5 = 876621802,
-    OnEvent6 = -1387692464,
-    OnEvent7 = -632402234,
-    OnEvent8 = 1257329495,
-    OnExfiltrationStarted = 217988953,
-    OnExit = 2091983898,
-    OnExitDeadZone = -1530843111,
-    OnExitRole = 1406590589,
-    OnExitScopeMode = 2083528145,
-    OnFacing = 1970836876,
-    OnFail = 1855949661,
-    OnFailed = 1727217522,
-    OnFailedAcknowledge = -1193896217,
-    OnFailedGreeting = -1967166223,
-    OnFailedResponse = -232275039,
-    OnFailure = 1359581138,
-    OnFalse = 838796525,
-    OnFinishedTargetZoom = -1713826198,
-    OnFireProjectiles = 772916758,
-    OnFireProjectilesLocal = -529353601,
-    OnFireProjectilesRemote = 884399465,
-    OnFirst = -2008841590,
-    OnFirstDeathNPC = -632210996,
-    OnFirstShotHero = -156095054,
-    OnFirstShotNPC = -217897054,
-    OnFlushBodyEnd = -99566844,
-    OnFlushBodyStart = -441909620,
-    OnForcedAnim = -1383861814,
-    OnFoundTargetDead = -1666290840,
-    OnFoundTargetUnconscious = -1915792055,
-    OnFracture = 118728372,
-    OnFree = -1516871204,
-    OnFriskClean = -264948597,
-    OnFriskPrompt = 394545725,
-    OnGet = -45151945,
-    OnGetAccessoryItem = 867211928,
-    OnGetCondition = 1903670151,
-    OnGetEntityRef = 132643818,
-    OnGetGroupID = -46769646,
-    OnGetHealth = -1552753751,
-    OnGetIActor = -1341683349,
-    OnGetItem = 1776921820,
-    OnGetItemNotFound = -1748633027,
-    OnGetItemUsed = -565706918,
-    OnGetOutfit = 1605004987,
-    OnGetSetpieceUsed = 1022313745,
-    OnGetTally = -1649758442,
-    OnGetTallyRemaining = -980503988,
-    OnGetThisSetpiece = 1240186283,
-    OnGreeting = -1037207559,
-    OnGreetingNotAllowed = 678819475,
-    OnHandleBreakRecorder = -185684057,
-    OnHandleDisableCamera = 1665111029,
-    OnHardWarning = -1641081384,
-    OnHearAccident = -696584937,
-    OnHearBulletImpact = 778894965,
-    OnHearExplosion = 789631804,
-    OnHearGunshot = -591347568,
-    OnHeroEnterCover = 1487201008,
-    OnHeroLeaveCover = 1515904216,
-    OnHide = 1277258559,
-    OnHintCancelled = 1017020647,
-    OnHintStarted = 1332731774,
-    OnHit = 1520828678,
-    OnHitByImpulse = 727781548,
-    OnHitByImpulseInfo = -1602603006,
-    OnHitByItem = 2079324756,
-    OnHitInfo = 1022429191,
-    OnHit_AfterInfo = 216641334,
-    OnHitmanEnter = 1386118309,
-    OnHitmanExit = 1954771147,
-    OnHitmanLeave = 1885223963,
-    OnHolster = 2083796512,
-    OnIActor = 634908116,
-    OnIActorChanged = 891410217,
-    OnImpact = 1014062082,
-    OnImpactInfo = -1117801210,
-    OnInfectedPercentageChanged = 1711448864,
-    OnInitialDetach = -455373190,
-    OnInitialFracture = -1368425044,
-    OnInteractedWith = 752719815,
-    OnInteractionBegin = -1777755137,
-    OnInteractionEnd = 690018546,
-    OnInteractionInterrupted = -749604974,
-    OnInteractorSet = -1625437246,
-    OnInterrupted = 1698220641,
-    OnInvestigated = -865202040,
-    OnInvestigating = 294547354,
-    OnInvestigatorAssigned = -1022399313,
-    OnInvisible = -1315612428,
-    OnIsFullyInCrowd = -852902449,
-    OnIsFullyInVegetation = 1837472079,
-    OnItem = -140278518,
-    OnItemChanged = -1435167461,
-    OnItemConsumed = 1401673392,
-    OnItemDestroyed = -1454591505,
-    OnItemFocus = -1275744506,
-    OnItemGrabbed = -1335202394,
-    OnItemPlaced = 1293427614,
-    OnItemPrimed = 1575096216,
-    OnItemPrimedAndReady = 1991070726,
-    OnItemRemovedPinID = 1023852986,
-    OnItemSet = -622495679,
-    OnItemStashed = 277906250,
-    OnItemsSpawned = 842439472,
-    OnJoinNPC = 1529578993,
-    OnKill = -275646851,
-    OnKnight = -59688267,
-    OnKnockdownHeavyItem = 3824552,
-    OnKnockdownLightItem = -1461351029,
-    OnLast = -1570567756,
-    OnLeave = -2122126323,
-    OnLeaveConnector = 2032675858,
-    OnLeaveDrama = -1383802779,
-    OnLeaving = 2088306901,
-    OnLeft = -1830860932,
-    OnLethalImpact = 474007645,
-    OnLinkedEntityApplied = -1608386473,
-    OnLockdownEnd = -1852068474,
-    OnLocked = 313152660,
-    OnLostOwnership = -1759653618,
-    OnLostSightTimeout = 636979187,
-    OnMaxInfected = 1987231655,
-    OnMaxSightAttentionToPlayer = 1765886123,
-    OnModifierActivated = -1530573641,
-    OnModifierDeactivated = 1593084589,
-    OnMove = 126261100,
-    OnMoveBegin = 1843923125,
-    OnMoveEnd = 1135050202,
-    OnMovementForced = 577516054,
-    OnMurdered = 936557110,
-    OnNegative = -1421463508,
-    OnNegativeSide = -1441016962,
-    OnNeutral = -726242845,
-    OnNext = -325603288,
-    OnNoAccessoryItem = -850631781,
-    OnNoContainedItem = -461696720,
-    OnNoEquipContainedItem = -1641871525,
-    OnNoEquipItem = -221047883,
-    OnNoItem = -28580308,
-    OnNoReceiversRegistered = -877548521,
-    OnNonTargetObjectiveCompleted = -980639079,
-    OnNotAdded = 94143899,
-    OnNotAvailable = 371785044,
-    OnNotContained = -2133786469,
-    OnNotCurrent = -1643026635,
-    OnNotEqual = -527957881,
-    OnNotFacing = -573875296,
-    OnNotRemoved = -57759421,
-    OnNotSpotted = -138516913,
-    OnOpened = 1429125982,
-    OnOriginalASet = 1245553575,
-    OnOriginalBSet = 1485311049,
-    OnOriginalSet = 291655855,
-    OnOutfitChanged = -1828129505,
-    OnOutfitReacquired = -1778719741,
-    OnOutfitSpawned = 965987005,
-    OnOutfitTaken = -1939378710,
-    OnPacified = 1898041569,
-    OnPacify = -1843281055,
-    OnPacifyHeavyItem = 117978418,
-    OnPacifyLightItem = -1344806127,
-    OnPassedFilter = 1705640944,
-    OnPause = -844562896,
-    OnPauseDrama = 1731459193,
-    OnPauseRole = 992021443,
-    OnPickup = -1176066568,
-    OnPlaced = -2063305321,
-    OnPlay = -1238270290,
-    OnPlayerAdded = 1286610166,
-    OnPlayerInRangeToSpreadToNPC = 1438940519,
-    OnPlayerRemoved = -1525752219,
-    OnPointInsideVolume = 512719904,
-    OnPositionReached = -43223067,
-    OnPositive = -835696841,
-    OnPositiveSide = 939538066,
-    OnPressed = 1808151657,
-    OnPressedIActor = -1224892120,
-    OnProjectionTurnedOff = -318768411,
-    OnProjectionTurnedOn = -1648804941,
-    OnPutInContainer = -2054205379,
-    OnQueueCompleted = -1460174207,
-    OnQueueStarted = -375483467,
-    OnRayEnter = -1327064583,
-    OnRayLeave = -1842947769,
-    OnReached = 1465952941,
-    OnReacted = 1113387193,
-    OnReady = 849865074,
-    OnReadyActor = -1667835020,
-    OnReadyActorAsEntity = -1144733493,
-    OnReadyInRangeVR = 144993298,
-    OnReadyItem = -239242570,
-    OnReadySetpiece = -756333442,
-    OnRecorded = -1616357964,
-    OnReenterRole = -2056240241,
-    OnRefillHealth = 1553941996,
-    OnRelease = -287994098,
-    OnReleased = 2139861572,
-    OnReleasedIActor = 1094220222,
-    OnRemoved = -822184338,
-    OnRemovedFromContainer = 480444469,
-    OnRequestPutInContainer = -825207485,
-    OnReset = 1253036944,
-    OnResize = -2012835289,
-    OnResponderSet = -565834386,
-    OnResponding = 1516818844,
-    OnRestart = -1754550764,
-    OnResume = -1732686683,
-    OnResumed = 1056548071,
-    OnResumingRole = -29808219,
-    OnRise = 1980127314,
-    OnRoleJoined = -1193135888,
-    OnRoleLeft = -1483602292,
-    OnRunningRole = -465221243,
-    OnSafeRoomBegin = 1734557530,
-    OnSafeRoomCompromised = 23683920,
-    OnSafeRoomEnd = 1691818368,
-    OnScoringEvent = 1937260849,
-    OnSearchStarted = -384414973,
-    OnSeeActorAgitatedBystander = 529829651,
-    OnSeeActorCombat = -763378547,
-    OnSeeActorGettingHelp = -1261062885,
-    OnSeeActorScared = 997384895,
-    OnSeeAgitatedBystander = 1853264409,
-    OnSeeCombat = -797139163,
-    OnSeeDead = 1439090185,
-    OnSeeDeadByAccident = -867404387,
-    OnSeeGettingHelp = -654428876,
-    OnSeePlayerIllegalInteraction = -100985269,
-    OnSeePlayerSevereIllegalInteraction = -2099455851,
-    OnSeeScared = 963754263,
-    OnSeeUnconscious = -1484026584,
-    OnSelected = 476540116,
-    OnSelectedMuzzleExtension = -1045702739,
-    OnSelectedScope = 1728342797,
-    OnSelectedSkin = 1947040389,
-    OnSet = -429915493,
-    OnSetAmmoScopeType = 680827495,
-    OnSetItem = -92793855,
-    OnSetKinematic = 1724970827,
-    OnSetVisible = 2133605281,
-    OnSetZoomLevel = 493696567,
-    OnShatter = 1638871716,
-    OnShot = 1136601263,
-    OnShotDamageReached = 576686960,
-    OnShotVolumeIntersection = -430887806,
-    OnShow = -625575659,
-    OnShowExitObjective = 1795390607,
-    OnSit = 1255493015,
-    OnSituation = 1775002817,
-    OnSleep = 352431729,
-    OnSniperScoringActive = 665298592,
-    OnSoundEventExplosion = -441796898,
-    OnSpawn = -1975737542,
-    OnSpawnPointFound = 1447772045,
-    OnSpeedChanged = 66930855,
-    OnSpotted = -976307870,
-    OnSpreadingActorDied = 635826224,
-    OnStandDown = 1826132528,
-    OnStart = -2058667694,
-    OnStartDumpingBody = -1304555876,
-    OnStartIntermediateFailed = 1607045,
-    OnStartIntermediateOnActorFailed = -734433535,
-    OnStartPriming = -1475845322,
-    OnStartRotating = -2035506635,
-    OnStarted = -1006363959,
-    OnStartedActor = -158663110,
-    OnStateChanged = -841036301,
-    OnStep = -1425973720,
-    OnStone = 51538423,
-    OnStop = 1374598818,
-    OnStopPriming = 845267402,
-    OnStopRotating = 842888608,
-    OnStopped = -701184769,
-    OnSuccess = 529683361,
-    OnTakeDamage = 869191507,
-    OnTallyChanged = -1357577400,
-    OnTargetDead = 1480320355,
-    OnTargetInRange = -1464832188,
-    OnTargetOutOfRange = 2098926056,
-    OnTargetUnconscious = 1270588714,
-    OnTerminate = -378268133,
-    OnThrown = 948046233,
-    OnTimeOut = -912343199,
-    OnTimeToSearch = -1165569847,
-    OnTransitionBegin = 1286978543,
-    OnTransitionEnd = 1743617244,
-    OnTriggeredEvent01 = -1422766636,
-    OnTriggeredEvent02 = 842734702,
-    OnTriggeredEvent03 = 1161571576,
-    OnTriggeredEvent04 = -614942373,
-    OnTriggeredEvent05 = -1403024947,
-    OnTriggeredEvent06 = 894883959,
-    OnTriggeredEvent07 = 1112664289,
-    OnTriggeredEvent08 = -756091536,
-    OnTrue = 356838553,
-    OnTumble = -1632330718,
-    OnTurnOff = 443402761,
-    OnTurnOn = -1230009242,
-    OnUnlocked = -2050634427,
-    OnUnnoticableKill = -1319688669,
-    OnUnpause = 1894295355,
-    OnUnpauseDrama = -2028481419,
-    OnUsed = -1845509364,
-    OnVRQuickDeath = -627571827,
-    OnValue = 121976041,
-    OnValueChanged = 1750683033,
-    OnVelocityChanged = 718045457,
-    OnVictimDeath = -301482151,
-    OnVictimDeathActor = 806634092,
-    OnVictimsInAccident = 1053830114,
-    OnVisible = 170026058,
-    OnWake = -841981567,
-    OnWarning = 819728597,
-    OnWeaponBroken = 333595650,
-    OnWillReact = 354984277,
-    OnWrap = 1149399241,
-    OpenCalled = 1894516874,
-    OpenMap = -91776405,
-    Opened = -1426447763,
-    Out00 = -368595208,
-    Out01 = -1660903826,
-    Out02 = 67751892,
-    Out03 = 1930362690,
-    Out04 = -311792927,
-    Out05 = -1704109449,
-    Out06 = 56888269,
-    Out07 = 1952660315,
-    Out08 = -455334198,
-    Out1 = -1434156796,
-    Out2 = 864932030,
-    Out3 = 1149952040,
-    Out4 = -621906549,
-    Out5 = -1377221347,
-    Out6 = 887100583,
-    Out7 = 1139221553,
-    Out8 = -749192800,
-    OutB = 1669898626,
-    OutG = 333600013,
-    OutOfSight = -55426879,
-    OutPeer = 1526892808,
-    OutR = 2118103526,
-    OutRGB = -764329266,
-    OutRGBA = -1344864130,
-    OutSelf = -2102441518,
-    OutSignal = -640187692,
-    OutSignalData = 1999668437,
-    OutX = -1628808968,
-    OutY = -370317202,
-    OutZ = 1894005204,
-    OutfitID = -388877218,
-    OutfitRecovered = -1234400111,
-    OutfitTaken = -1291165428,
-    Output = -881716824,
-    Output1 = 1528477308,
-    Output2 = -1038882874,
-    Output3 = -1256925360,
-    Output4 = 728777459,
-    Output5 = 1551331941,
-    OutputBool = 1899454797,
-    OutputEvent = 770077621,
-    OutputFloat = -538105977,
-    OutputInt = 379953986,
-    OutputModeHeadphones = -264168899,
-    OutputModeStereo = -1088273687,
-    OutputModeSystem = -666659963,
-    OutputTargetLocation = -1953855137,
-    Outside = 2052572218,
-    OutsideCone = 1641153220,
-    OutsideMonitorDistance = -2142302164,
-    OverTheShoulderCam = -375017870,
-    OwnedByHitman = -429425519,
-    OwnedByNPC = -1944252597,
-    Pacified = 211378661,
-    PacifiedData = 205533496,
-    PageBack = -1252123340,
-    PageClosed = -1601218488,
-    PageOpen = 2095079335,
-    PageOpened = 152974071,
-    PageSelectionChanged = 1235981324,
-    ParentRepositoryId = -788483810,
-    PausedControllerHintClosed = 191518696,
-    PausedControllerHintOpened = -1560593065,
-    PetrolCan = -1673580814,
-    Pig = -199961673,
-    Pigeon = -1981005522,
-    PipeSlideStart = -493529472,
-    PipeSlideStop = 1389078585,
-    Pitch = -430009891,
-    Play = -21270140,
-    PlaySound = -308354839,
-    PlayerAllShots = 723052756,
-    PlayerEndBurstShot = -1765717906,
-    PlayerFirstBurstShot = 357548882,
-    PlayerLoopShot = -1808271362,
-    PlayerSecondBurstShot = 818309893,
-    PlayerShot = 1948417164,
-    PollValue = -1272672686,
-    Port0Out = -1987055444,
-    Port1Out = 825464777,
-    Port2Out = 595998759,
-    Port3Out = -1690673342,
-    Position = -1084586333,
-    PositionOutput = 15622449,
-    Power = 1783312036,
-    PrecisionAimedKill = -1856877869,
-    Pressed = -722894362,
-    PressedWFrameTime = 1441079950,
-    PreviousPageTabSelected = 140167633,
-    PrimaryObjectiveCompleted = 269519631,
-    PrimaryObjectiveFailed = 471294817,
-    PrincipalTargetAngleHoriz = 716099570,
-    PrincipalTargetAngleVert = 282713860,
-    PrincipalTargetDistance = 969704402,
-    PrincipalTargetIndex = -140795354,
-    PrincipalTargetVisible = 1266359275,
-    Progress = -612921328,
-    ProjectileBodyShot = -536165175,
-    ProjectileCrowdBodyShot = 95116165,
-    ProjectileCrowdHeadShot = -123282813,
-    ProjectileHeadShot = 487015887,
-    ProjectileMissed = 373206903,
-    ProjectileMultiKillTargets = -376123929,
-    PromptPositionIndex = -1962363066,
-    PropKill = -841181530,
-    PunchBody = -694237316,
-    PunchFace = 136492969,
-    QuestItemPickup = -889955828,
-    RH_Hide = 1434537202,
-    RH_Place = -1948049094,
-    RH_Retrieve = -93287010,
-    RH_Show = -1021944104,
-    RH_Swap = -729087304,
-    RayLength = 1745842852,
-    Reached = -397467870,
-    ReachedArea = -1277745106,
-    ReachedZero = -811735852,
-    ReactionTriggered = 886011295,
-    ReactionTriggeredAtPos = 777456276,
-    ReceivedKeyword = 1621342873,
-    Received_ZString = -2017128801,
-    Received_ZVariant = 1054888328,
-    Received_bool = 909758687,
-    Received_float32 = 1214028898,
-    Received_int32 = -290253850,
-    Received_void = -1312604253,
-    Recovered = 504409269,
-    ReleasedItem = 1008625752,
-    Reload_Red = -1287872021,
-    Reload_White = 425456961,
-    RemoteTriggered = 2067827374,
-    RemovalOfObjectiveHudDisplayed = -253701457,
-    RemovedEntity = -1309489175,
-    RemovedKeyword = -1064101874,
-    RemovedSignal = -875161996,
-    ReportItemUsed = 1405626397,
-    ReportOwner = -1506485425,
-    ReportOwnerPosition = -2035339568,
-    RepositoryID = -2101769880,
-    RepositoryId = -1177048672,
-    RequestFailed = -42550003,
-    RequestSucceeded = -249322226,
-    ResetTestCase = 1533737095,
-    Result = 348570661,
-    RightHandHoldsFirearm = -649033386,
-    RightHandHoldsMelee = 1231615495,
-    RightHandIsReloading = 1217701313,
-    RightHandPredictionForce = -571729293,
-    RoomID = -1733941728,
-    RoomId = -1547172120,
-    RotationOutput = 802925910,
-    RoundingCover = -158875635,
-    Run = 1748754976,
-    RunTestCase = -1075015717,
-    RunUsed = -1392877180,
-    Same = 1549950586,
-    ScoreAwesome = -306766848,
-    ScoreCommon = 1470683812,
-    ScoreFail = -1641677355,
-    ScoreFair = 1680523446,
-    ScoreGood = 1954977806,
-    ScoreStartUpdate = 1669728585,
-    ScoreStopUpdate = 1283346791,
-    SecondaryObjectiveCompleted = 1780719647,
-    SecondaryObjectiveFailed = 1316272349,
-    SecurityCameraAttentionMax = 421316178,
-    SecurityCameraAttentionMaxPan = -1551354021,
-    SecurityTapePickup = -500730549,
-    Selected = 1642061264,
-    SelectionChanged = 1111174197,
-    SendDestinationPosition = -2129830719,
-    SendEventName = 388400141,
-    SendSourcePosition = -781516592,
-    SendValue = 1738882331,
-    SetActor = -1272936135,
-    SetCinemaMode = -635959245,
-    SetCinemaModeHighFramerate = 1934358366,
-    SetCrosshair = 351444829,
-    SetGlowType = -1058268134,
-    SetIActor = 1178330814,
-    SetImageRID = 395925583,
-    SetLength = -1696003619,
-    SetOpenCalled = -698857560,
-    SetParticleAlpha = 21618847,
-    SetParticleColor = -1207987940,
-    SetReticleMax = 1547664996,
-    SetReticleMin = 1613906237,
-    SetUpTestCase = -1697060939,
-    SetValue = -316504076,
-    ShotBegin = 1056173252,
-    ShotEnd = 1396300407,
-    ShotFired = -685231563,
-    ShotFiredIntoCrowd = 1471438046,
-    ShotInterval = -770267586,
-    ShotsPerMinute = -1637854294,
-    ShotsPerSecondHero = -682630777,
-    ShotsPerSecondNPC = -1170495594,
-    Show = -1841531329,
-    ShowClip = -1730884389,
-    ShowHint = 20110319,
-    ShowRecenterHint = -211197357,
-    ShowTargetsMustBeDead = 429965353,
-    Signal = 1939902659,
-    SignalData = -215926486,
-    SignalDistance = 1500202446,
-    SignalMatched = -1552504240,
-    SilentTakedownHardShakeEvent = 165549998,
-    SilentTakedownPrimingStart = 1154500282,
-    SilentTakedownPrimingStop = -1416825444,
-    SilentTakedownStartMovement = 1625388711,
-    SilentTakedownStopMovement = 2057674236,
-    SkullCrack = -1144039635,
-    SliderChanged = 1817884957,
-    SnapNeckBrokenNeckEvent = -1092124814,
-    SnapNeckPrimingStart = 66065153,
-    SnapNeckPrimingStop = 957755762,
-    SnapNeckStartMovement = 1008024822,
-    SnapNeckStopMovement = 1032177735,
-    SniperModeZoomIn = 1469732300,
-    SniperModeZoomLevel = -1544434904,
-    SniperModeZoomOut = -1168836274,
-    SniperSlowDownStart = 700499291,
-    SniperSlowDownStop = 1726742409,
-    SomeoneDied = -2132331931,
-    SomeonePacified = 404568849,
-    SomeoneScared = 8062158,
-    SoundEvent01 = -1082151796,
-    SoundEvent02 = 645332278,
-    SoundEvent03 = 1366412704,
-    SoundEvent04 = -820684797,
-    SoundSignalEmitted = -1686475288,
-    SoundTensionAmbient = -2039808820,
-    SpatialEntity = -380133019,
-    SpawnPhysicsClip = -629426625,
-    Speaking = 755042572,
-    SplashAtPos = 632825129,
-    SpottedByHitman = -1007550032,
-    SpottedEnteringCloset = 758776178,
-    SpottedThroughDisguise = -412484405,
-    Sqrt = -407973018,
-    StandToHang = 932817369,
-    Start = 1589148299,
-    StartCoverTakedown = -1824138053,
-    StartExecuteKill = -1639716792,
-    StartFiberwireKill = -1538036500,
-    StartLedgePullKill = -655954206,
-    StartLedgePushKill = -538511252,
-    StartPropKill = -97558275,
-    StartPropKillSilent = 1279019102,
-    StartSubdueTakedown = -372825993,
-    StartSurrender = -343837528,
-    StartWindowPullKill = -716436584,
-    StartWindowPushKill = -766763754,
-    Start_FWKill = -1236192982,
-    Start_FWLong = -1963995605,
-    Start_FWShort = 1615657199,
-    Start_KnifeBack = 1112265468,
-    Start_KnifeFront = -228393763,
-    Start_KnifeLeft = 1440937123,
-    Start_KnifeRight = -1202459841,
-    Started = 2066460486,
-    StateEntered = 1424871421,
-    StateExitedOrDisabled = -1051489536,
-    StateOut = 457748702,
-    StateOutSent = -1410942516,
-    StealthKill = -1938540444,
-    StepCounter = 1546520778,
-    Stop = 426031496,
-    StopEventEnded = 704810564,
-    StopSurrender = 1478187868,
-    Stop_FWLong = 1723681392,
-    Stop_FWShort = -1676074473,
-    Stop_KnifeBack = -131563818,
-    Stop_KnifeFront = 694376103,
-    Stop_KnifeLeft = -276735863,
-    Stop_KnifeRight = 1666335045,
-    Stopped = 1763406192,
-    StrayBullet = -1025481403,
-    StrengthAtOrigin = -1395824486,
-    StuckItemPulledOut = 501935096,
-    SubSound = -1165336308,
-    SubtitleChanged = 1750929202,
-    SwipeActivated = 1706378131,
-    SwooshLong = -817107053,
-    SwooshShort = -1514969232,
-    SyncBar = 488567492,
-    SyncBeat = 2140711869,
-    SyncEntry = 1742924931,
-    SyncExit = 1047013679,
-    SyncGrid = -2076085226,
-    SyncPoint = -77167913,
-    SyncUserCue = 1001479005,
-    TakeDamage = -339413771,
-    TakeHealthPack = -1599236937,
-    TakeOutNonLethal = -1641100752,
-    TakingNewDisguise = 1627761601,
-    TargetAccidentKill = 1646838764,
-    TargetDied = -314056027,
-    TargetKilled = 213230084,
-    TargetPacified = 2128429355,
-    TargetPosition = -853629331,
-    TearDownTestCase = 1242953680,
-    TellActiveReceiverCount = 1066095348,
-    TellReceiverCount = -1300901283,
-    Text = -1682372359,
-    TextLocaleChanged = -798878922,
-    Then = -1854992692,
-    ThresholdPassed = 231249837,
-    ThroughWallKill = 1621108147,
-    ThrowActivated = -254758250,
-    ThrowArcOff = 498342933,
-    ThrowArcOn = 45975906,
-    ThrowImpact = -303658819,
-    TimeMultiplierInBlendIn = -1769221630,
-    TimeOut = 1991314158,
-    TimeOutPending = -1969265683,
-    TimerEnded = 559811855,
-    TimerStarted = 1441702495,
-    TimersUpdated = -1208855358,
-    ToBlack = 1026739556,
-    ToGame = -1612559760,
-    Toggle = 575056061,
-    Toggled = 758104917,
-    ToggledOff = 847269377,
-    ToggledOn = 1502812766,
-    TotalCoverValue = -2087473529,
-    TotalSeconds = -914542825,
-    Tracked = -1760909726,
-    Transform = -180157682,
-    TrespassEscortAck = 1270701846,
-    TrespassEscortArrest = 49199309,
-    TrespassEscortOk = 649692372,
-    TrespassEscortOutActive = 1395243991,
-    TrespassEscortRequest = 1745607207,
-    TrespassEscortRequestRepeat = -405604071,
-    TrespassEscortStandDown = -568017300,
-    TrespassEscortStayClose = 623830022,
-    Trespassing = -488520781,
-    TrespassingAttentionMax = -398903749,
-    TrespassingAttentionMaxPan = -1154026753,
-    Trigger = -707381567,
-    TriggerBeforeRaycast = 1777100653,
-    TriggerPressed = 2074030651,
-    TriggerRelease = -24344228,
-    Triggered = 249007644,
-    TriggeredStealthSituation = -1426741825,
-    TurnLightOn = 1601692283,
-    TutorialEnd = 1364874445,
-    TutorialHintClosed = 209335169,
-    TutorialHintOpened = -1511302850,
-    TutorialStart = -819608024,
-    TypeRepositoryId = -1152600142,
-    UIAbortConversation = 316088787,
-    UIScrollOption = -1677454559,
-    UISelectOption = 1441342114,
-    UISkipLine = 450168469,
-    Unclamped = -1249961833,
-    Unequipped = 1481929005,
-    Unmark_Local = -1534646197,
-    Unmark_Remote = 356965440,
-    UnnoticedKill = -1835169493,
-    UnnoticedPacified = 1122758015,
-    UnsetCurrentAmbience = -1495113914,
-    Untracked = -562634082,
-    Up = -703542574,
-    UpToOrange = 1261253234,
-    UpToWhite = 428401809,
-    UpdatedPriority = 2069308737,
-    UseHealthStation = 800312554,
-    VR_CrowdImpact_Bother = -595822949,
-    VR_CrowdImpact_Kill = -402125284,
-    VR_ItemDrop = 227216306,
-    VR_ItemEquip = 33672954,
-    VR_ItemHolster = 2021757299,
-    VR_ItemStuckInActor = 1738520523,
-    VR_ItemThrowDeadly = -764265622,
-    VR_ItemThrowNormal = -1403561483,
-    VR_NPCImpact_Bother = 808301223,
-    VR_NPCImpact_Kill = 108932144,
-    VR_NPCImpact_Pacify = -1309663220,
-    VR_NPCImpact_Slap = 884454313,
-    VR_PrimeMelee = 1336182176,
-    VR_SnapNeckKillEvent = -1943654082,
-    VR_StartDraggingBody = -1710618329,
-    VR_StartPrecisionAim = 1291932997,
-    VR_StartSilentTakedown = 439972190,
-    VR_StartSnapNeck = -429132175,
-    VR_StartThreateningHandPose = -1245904875,
-    VR_StopDraggingBody = 499376918,
-    VR_StopPrecisionAim = -892813452,
-    VR_StopSilentTakedown = -1665402301,
-    VR_StopSnapNeck = -582766038,
-    VR_StopThreateningHandPose = -1728212417,
-    VR_StuckItemPulledOut = 1894287286,
-    VR_UnprimeMelee = -1464759458,
-    VR_UpdateDragBodyForce = -588832793,
-    VR_UpdateSilentTakedown = -1881262729,
-    Value = -592021712,
-    ValueChanged = 554657752,
-    Vector2 = 701129125,
-    Vector3 = 1590513971,
-    VectorMagnitude = -2024537553,
-    VectorValue = -1607050401,
-    VentEnter = -1964776811,
-    VentExit = 70687331,
-    VentPeekStart = 580178702,
-    VentPeekStop = -383612090,
-    VisiblyArmed = 717110842,
-    W = 655174618,
-    Warn1 = 845057677,
-    Warn2 = -1420304585,
-    WarnOffPath = -273817656,
-    WarnStopped = -345710127,
-    WarzoneBegin = -1035962704,
-    WaypointActFinished = 1101493748,
-    WaypointReached = -302761652,
-    Weapon = 1855955664,
-    WeaponAimStart = -1362076449,
-    WeaponAimStop = 2127669528,
-    WeaponEquip = 1343552391,
-    WeaponEquipAssaultRifle = -2026016605,
-    WeaponEquipDualPistols = -694644666,
-    WeaponEquipIllegal = 2046825726,
-    WeaponEquipLegal = -778681208,
-    WeaponEquipMelee = -49021063,
-    WeaponEquipShotgun = 1301965115,
-    WeaponEquipSinglePistol = 1146775227,
-    WeaponEquipSniperRifle = 675988200,
-    WeaponEquipSuspicious = 1643955720,
-    WeaponEquipped = -267556161,
-    WeaponFire = 1486310636,
-    WeaponFireEmpty = 534685362,
-    WeaponFireWhileCrippled = -1968477833,
-    WeaponPlayerEquipped = -15234501,
-    WeaponPlayerUnEquipped = -424863856,
-    WeaponPrecisionAim = -380837929,
-    WeaponPrecisionAimComplete = -1222848155,
-    WeaponPrecisionAimReset = 578987726,
-    WeaponReload = 447155298,
-    WeaponScroll = 1426652340,
-    WeaponSilencersEquip = -173047304,
-    WeaponSilencersUnequip = -2048813032,
-    WeaponStartReload = -1369784344,
-    WeaponSwap = 635093058,
-    WeaponSwapped = 654786286,
-    WeaponUnEquip = 1549266876,
-    WeaponUnEquipIllegal = 497432826,
-    WeaponUnEquipLegal = 108360002,
-    WeaponUnEquipSuspicious = 1618019264,
-    WeaponUnEquipped = 424191933,
-    Weight = 6377591,
-    WentAboveMax = 1350067353,
-    WentBelowMin = 908688100,
-    WentIntoRange = -187877283,
-    WireDetach = 445890690,
-    WithinProximityChanged = 155523603,
-    WithinThreshold = -538528601,
-    WorldPosition = -1758920068,
-    Wounded = 1979450136,
-    X = -1213057461,
-    Y = -1061878051,
-    Z = 1505515367,
-    ZoomMapIn = 1033081092,
-    ZoomMapOut = 797030920,
-    nAcknowledge = -273794410,
-    reportSetpieceUsed = -1061239543,
+#define ZHM_PIN(p_Name, p_Id) p_Name = p_Id,
+#include "PinList.h"
+#undef ZHM_PIN
 };
@@ -4,10 +4,13 @@
 #include "Common.h"
 #include "imgui.h"
 
+#include <vector>
+
 class IPluginInterface;
 class ZRenderDestination;
 class SVector2;
 class SVector3;
+class ZRuntimeResourceID;
 
 class IModSDK
 {
@@ -191,6 +194,17 @@ public:
 	  * @param p_Plugin The plugin to reload the settings for.
 	  */
 	 virtual void ReloadPluginSettings(IPluginInterface* p_Plugin) = 0;
+
+    /**
+     * Get the resources that reference the given resource.
+     * The lookup is served from an index that is built on the game thread when a scene loads. Resources installed
+     * after that are only included once the index has been rebuilt on the next frame, so the lookup can fail or
+     * miss referrers until then.
+     * @param p_ResourceId The runtime resource ID of the referenced resource.
+     * @param p_Referrers The output list the runtime resource IDs of the referencing resources are appended to.
+     * @return True if the resource was found in the index, false otherwise.
+     */
+    virtual bool GetResourceReferrers(const ZRuntimeResourceID& p_ResourceId, std::vector<ZRuntimeResourceID>& p_Referrers) = 0;
 };
 
 /**
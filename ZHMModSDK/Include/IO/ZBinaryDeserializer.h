@@ -1,9 +1,12 @@
 #pragma once
 
 #include <map>
+#include <shared_mutex>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include "ZBinaryReader.h"
+#include "ZBinarySpanReader.h"
 #include "ZBinaryWriter.h"
 #include <Glacier/ZResource.h>
 
@@ -16,11 +19,26 @@ public:
     const unsigned char GetAlignment() const;
 
 private:
-    void HandleRebaseSection(ZBinaryReader& binaryReader, ZBinaryReader& dataSectionbinaryReader, ZBinaryWriter& dataSectionBinaryWriter);
-    void HandleTypeReindexingSection(ZBinaryReader& binaryReader, ZBinaryReader& dataSectionbinaryReader, ZBinaryWriter& dataSectionBinaryWriter);
-    void HandleRuntimeResourceIDReindexingSection(ZBinaryReader& binaryReader, ZBinaryReader& dataSectionbinaryReader, ZBinaryWriter& dataSectionBinaryWriter, const TArray<ZResourceIndex>* referenceIndices = nullptr);
-    static void Align(ZBinaryReader& binaryReader, const size_t currentPosition, const size_t alignment);
-    STypeID* GetTypeIDFromTypeName(const std::string& typeName);
+    struct TypeNameHash
+    {
+        using is_transparent = void;
 
-    unsigned char alignment;
+        size_t operator()(std::string_view typeName) const
+        {
+            return std::hash<std::string_view>()(typeName);
+        }
+    };
+
+    static void HandleRebaseSection(ZBinarySpanReader& sectionReader, std::byte* data, size_t dataLength);
+    static void HandleTypeReindexingSection(ZBinarySpanReader& sectionReader, std::byte* data, size_t dataLength);
+    static void HandleRuntimeResourceIDReindexingSection(ZBinarySpanReader& sectionReader, std::byte* data, size_t dataLength, const TArray<ZResourceIndex>* referenceIndices);
+    static std::span<const std::byte> ReadRelocationOffsets(ZBinarySpanReader& sectionReader, size_t dataLength, size_t valueSize);
+    static void Align(ZBinarySpanReader& binaryReader, const size_t alignment);
+    static STypeID* GetTypeIDFromTypeName(std::string_view typeName);
+
+    unsigned char alignment = 0;
+
+    // Type names resolve to the same STypeID for the lifetime of the process, so lookups are shared across deserializations.
+    inline static std::shared_mutex m_TypeIDCacheMutex;
+    inline static std::unordered_map<std::string, STypeID*, TypeNameHash, std::equal_to<>> m_TypeIDCache;
 };
@@ -1,196 +1,186 @@
 #pragma once
 
 #include <fstream>
-
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ZBinarySpanReader.h"
+#include "ZMappedFile.h"
+
+/**
+ * Binary reader over a file or a block of memory.
+ * Files are memory-mapped when possible, and all memory-backed reads go through a bounds-checked ZBinarySpanReader.
+ * If a file cannot be mapped, the reader falls back to streaming it with an ifstream.
+ */
 class ZBinaryReader
 {
 public:
-    enum class ESeekOrigin
-    {
-        begin,
-        current,
-        end
-    };
+    using ESeekOrigin = ZBinarySpanReader::ESeekOrigin;
 
     ZBinaryReader(const std::string& filePath)
     {
-        stream = std::ifstream(filePath, std::ios::binary | std::ios_base::ate);
-        size = stream.tellg();
-        data = nullptr;
-        position = 0;
+        if (mappedFile.Open(filePath))
+        {
+            reader = ZBinarySpanReader(mappedFile.GetSpan());
+
+            return;
+        }
+
+        stream.emplace(filePath, std::ios::binary | std::ios_base::ate);
+        size = stream->tellg();
 
-        stream.seekg(0);
+        stream->seekg(0);
     }
 
-    ZBinaryReader(std::vector<char>* data)
+    ZBinaryReader(std::vector<char>* data) :
+        reader(data->data(), data->size())
     {
-        this->data = data->data();
-        size = data->size();
-        position = 0;
     }
 
-    ZBinaryReader(void* data, size_t dataSize)
+    ZBinaryReader(void* data, size_t dataSize) :
+        reader(data, dataSize)
     {
-        this->data = data;
-        size = dataSize;
-        position = 0;
     }
 
-    ~ZBinaryReader()
+    ZBinaryReader(std::span<const std::byte> data) :
+        reader(data)
     {
-        if (stream.is_open())
-        {
-            stream.close();
-        }
     }
 
     template <typename T>
     T Read()
     {
-        T data {};
-
-        if (stream.is_open())
+        if (stream)
         {
-            stream.read(reinterpret_cast<char*>(&data), sizeof(T));
-        }
-        else if (this->data && size > 0)
-        {
-            data = *reinterpret_cast<T*>(reinterpret_cast<char*>(this->data) + position);
+            T data {};
+
+            stream->read(reinterpret_cast<char*>(&data), sizeof(T));
 
-            position += sizeof(T);
+            return data;
         }
 
-        return data;
+        return reader.Read<T>();
     }
 
     char* ReadChars(const size_t size)
     {
         char* buffer = new char[size];
 
-        if (stream.is_open())
-        {
-            stream.read(buffer, size);
-        }
-        else if (this->data && size > 0)
-        {
-            memcpy(buffer, reinterpret_cast<char*>(this->data) + position, size);
-
-            position += size;
-        }
+        ReadBytes(buffer, size);
 
         return buffer;
     }
 
     std::string ReadString(const size_t size)
     {
-        char* buffer = ReadChars(size + 1);
-        std::string result = std::string(buffer, size);
+        if (stream)
+        {
+            std::string result(size, '\0');
 
-        delete[] buffer;
+            stream->read(result.data(), size);
+            stream->ignore(1);
 
-        return result;
+            return result;
+        }
+
+        return std::string(reader.ReadStringView(size, true));
+    }
+
+    /**
+     * Reads a string without copying it. Only valid for memory-backed and mapped readers.
+     * The returned view points into the underlying data and is only valid while it is alive.
+     */
+    std::string_view ReadStringView(const size_t size)
+    {
+        return reader.ReadStringView(size, true);
     }
 
     template <typename T>
     void ReadBytes(T* data, size_t count)
     {
-        if (stream.is_open())
+        if (stream)
         {
-            stream.read(reinterpret_cast<char*>(data), sizeof(T) * count);
-        }
-        else if (this->data && size > 0)
-        {
-            memcpy(data, this->data, sizeof(T) * count);
+            stream->read(reinterpret_cast<char*>(data), sizeof(T) * count);
 
-            position += count;
+            return;
         }
+
+        reader.ReadArray(data, count);
     }
 
     void ReadBytes(void* data, size_t count)
     {
-        if (stream.is_open())
+        if (stream)
         {
-            stream.read(reinterpret_cast<char*>(data), count);
-        }
-        else if (this->data && size > 0)
-        {
-            memcpy(data, this->data, count);
+            stream->read(reinterpret_cast<char*>(data), count);
 
-            position += count;
+            return;
         }
+
+        reader.ReadBytes(data, count);
     }
 
     void Skip(size_t count)
     {
-        if (stream.is_open())
+        if (stream)
         {
-            stream.seekg(static_cast<size_t>(stream.tellg()) + count);
-        }
-        else if (this->data && size > 0)
-        {
-            position += count;
+            stream->seekg(static_cast<size_t>(stream->tellg()) + count);
+
+            return;
         }
+
+        reader.Skip(count);
     }
 
     void Seek(size_t offset, ESeekOrigin seekOrigin = ESeekOrigin::begin)
     {
-        if (stream.is_open())
-        {
-            stream.seekg(offset, static_cast<std::ios_base::seekdir>(seekOrigin));
-        }
-        else if (this->data && size > 0)
+        if (stream)
         {
-            switch (seekOrigin)
-            {
-                case ESeekOrigin::begin:
-                {
-                    position = offset;
-
-                    break;
-                }
-                case ESeekOrigin::current:
-                {
-                    position += offset;
-
-                    break;
-                }
-                case ESeekOrigin::end:
-                {
-                    position = size - offset;
-
-                    break;
-                }
-            }
+            stream->seekg(offset, static_cast<std::ios_base::seekdir>(seekOrigin));
+
+            return;
         }
+
+        reader.Seek(offset, seekOrigin);
     }
 
     size_t GetPosition()
     {
-        if (stream.is_open())
+        if (stream)
         {
-            return stream.tellg();
-        }
-        else if (this->data && size > 0)
-        {
-            return position;
+            return stream->tellg();
         }
 
-        return -1;
+        return reader.GetPosition();
     }
 
     size_t GetSize() const
     {
-        return size;
+        if (stream)
+        {
+            return size;
+        }
+
+        return reader.GetSize();
     }
 
     void* GetData()
     {
-        return data;
+        return const_cast<std::byte*>(reader.GetData());
+    }
+
+    /**
+     * Returns the span reader backing this reader, or nullptr if the reader is streaming from a file.
+     */
+    ZBinarySpanReader* GetSpanReader()
+    {
+        return stream ? nullptr : &reader;
     }
 
 private:
-    std::ifstream stream;
-    size_t size;
-    void* data;
-    size_t position;
+    ZMappedFile mappedFile;
+    ZBinarySpanReader reader;
+    std::optional<std::ifstream> stream;
+    size_t size = 0;
 };
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Glacier/Reflection.h>
+#include <Glacier/ZResourceID.h>
+
+/**
+ * Serializes reflected game structures into BIN1 resources that can be read back by ZBinaryDeserializer.
+ * The object graph is walked once: the object is copied into the data section as-is, and members that hold
+ * pointers (strings, arrays, variants, resource ids) are moved out of line and recorded in the relocation tables.
+ */
+class ZHMSDK_API ZBinarySerializer
+{
+public:
+    /**
+     * Serializes an object into a BIN1 resource.
+     * Throws std::invalid_argument if the object contains a type that can't be represented in BIN1 (e.g. maps or entity references).
+     * @param object The object to serialize.
+     * @param type The type of the object.
+     * @return The serialized BIN1 resource.
+     */
+    std::vector<char> Serialize(const void* object, STypeID* type);
+
+    /**
+     * Returns the runtime resource ids referenced by the last serialized object, in reference index order.
+     * These need to become the references of the resource the BIN1 data is loaded as.
+     */
+    const std::vector<ZRuntimeResourceID>& GetReferences() const;
+
+private:
+    size_t Allocate(size_t size, size_t alignment);
+    void WriteValue(const void* source, IType* type, size_t offset);
+    void WriteClass(const void* source, IClassType* type, size_t offset);
+    void WriteArray(const void* source, IArrayType* type, size_t offset);
+    void WriteFixedArray(const void* source, IArrayType* type, size_t offset);
+    void WriteString(const void* source, size_t offset);
+    void WriteVariant(const void* source, size_t offset);
+    void WriteResourceID(const void* source, size_t offset);
+    void WritePointer(size_t offset, long long target);
+    uint32_t GetTypeIndex(IType* type);
+    std::vector<char> WriteResource();
+
+    std::vector<char> data;
+    size_t maxAlignment = 1;
+    std::vector<uint32_t> rebaseOffsets;
+    std::vector<uint32_t> typeOffsets;
+    std::vector<uint32_t> resourceIDOffsets;
+    std::vector<IType*> types;
+    std::unordered_map<IType*, uint32_t> typeIndices;
+    std::vector<ZRuntimeResourceID> references;
+    std::unordered_map<unsigned long long, uint32_t> referenceIndices;
+};
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Bounds-checked binary reader over a contiguous block of memory.
+ * The reader never copies or owns the underlying data; byte and string reads return views into it,
+ * so the memory must outlive any view handed out. Reads past the end throw std::out_of_range.
+ */
+class ZBinarySpanReader
+{
+public:
+    enum class ESeekOrigin
+    {
+        begin,
+        current,
+        end
+    };
+
+    ZBinarySpanReader() = default;
+
+    explicit ZBinarySpanReader(std::span<const std::byte> data) :
+        data(data),
+        position(0)
+    {
+    }
+
+    ZBinarySpanReader(const void* data, size_t dataSize) :
+        data(static_cast<const std::byte*>(data), dataSize),
+        position(0)
+    {
+    }
+
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Read<T> requires a trivially copyable type.");
+
+        T value;
+
+        std::memcpy(&value, Advance(sizeof(T)), sizeof(T));
+
+        return value;
+    }
+
+    template <typename T>
+    T Peek() const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Peek<T> requires a trivially copyable type.");
+
+        EnsureAvailable(sizeof(T));
+
+        T value;
+
+        std::memcpy(&value, data.data() + position, sizeof(T));
+
+        return value;
+    }
+
+    std::span<const std::byte> ReadBytes(size_t count)
+    {
+        return { Advance(count), count };
+    }
+
+    void ReadBytes(void* destination, size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::memcpy(destination, Advance(count), count);
+    }
+
+    template <typename T>
+    void ReadArray(T* destination, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadArray<T> requires a trivially copyable type.");
+
+        if (count > GetRemaining() / sizeof(T))
+        {
+            ThrowOutOfRange(count * sizeof(T));
+        }
+
+        ReadBytes(destination, count * sizeof(T));
+    }
+
+    /**
+     * Reads a string of the given length and returns a view into the underlying data.
+     * @param length The number of characters to read.
+     * @param skipTerminator Whether a trailing null terminator should be consumed after the characters.
+     */
+    std::string_view ReadStringView(size_t length, bool skipTerminator = false)
+    {
+        const auto* chars = reinterpret_cast<const char*>(Advance(length));
+
+        if (skipTerminator)
+        {
+            Advance(1);
+        }
+
+        return { chars, length };
+    }
+
+    void Skip(size_t count)
+    {
+        Advance(count);
+    }
+
+    void Seek(size_t offset, ESeekOrigin seekOrigin = ESeekOrigin::begin)
+    {
+        size_t newPosition = 0;
+
+        switch (seekOrigin)
+        {
+            case ESeekOrigin::begin:
+            {
+                newPosition = offset;
+
+                break;
+            }
+            case ESeekOrigin::current:
+            {
+                if (offset > GetRemaining())
+                {
+                    ThrowOutOfRange(offset);
+                }
+
+                newPosition = position + offset;
+
+                break;
+            }
+            case ESeekOrigin::end:
+            {
+                if (offset > data.size())
+                {
+                    ThrowOutOfRange(offset);
+                }
+
+                newPosition = data.size() - offset;
+
+                break;
+            }
+        }
+
+        if (newPosition > data.size())
+        {
+            throw std::out_of_range(std::format("Cannot seek to offset {} in a buffer of {} bytes.", newPosition, data.size()));
+        }
+
+        position = newPosition;
+    }
+
+    size_t GetPosition() const
+    {
+        return position;
+    }
+
+    size_t GetSize() const
+    {
+        return data.size();
+    }
+
+    size_t GetRemaining() const
+    {
+        return data.size() - position;
+    }
+
+    std::span<const std::byte> GetSpan() const
+    {
+        return data;
+    }
+
+    const std::byte* GetData() const
+    {
+        return data.data();
+    }
+
+private:
+    const std::byte* Advance(size_t count)
+    {
+        EnsureAvailable(count);
+
+        const std::byte* current = data.data() + position;
+
+        position += count;
+
+        return current;
+    }
+
+    void EnsureAvailable(size_t count) const
+    {
+        if (count > GetRemaining())
+        {
+            ThrowOutOfRange(count);
+        }
+    }
+
+    [[noreturn]] void ThrowOutOfRange(size_t count) const
+    {
+        throw std::out_of_range(std::format("Cannot read {} bytes at offset {} in a buffer of {} bytes.", count, position, data.size()));
+    }
+
+    std::span<const std::byte> data;
+    size_t position = 0;
+};
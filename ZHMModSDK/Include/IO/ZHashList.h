@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "ZMappedFile.h"
+
+/**
+ * Binary hash list mapping runtime resource ids to resource paths.
+ *
+ * The file is meant to be memory-mapped and used in place:
+ *   SHashListHeader
+ *   uint64_t ids[entryCount]              (sorted ascending)
+ *   uint32_t pathOffsets[entryCount]      (offsets into the string pool, parallel to ids)
+ *   uint32_t pilots[bucketCount]          (minimal perfect hash, optional)
+ *   uint32_t slots[entryCount]            (minimal perfect hash slot -> entry index, only if bucketCount != 0)
+ *   char stringPool[stringPoolSize]       (deduplicated, null-terminated paths)
+ *
+ * Every section starts at an 8 byte aligned offset from the start of the file.
+ */
+struct SHashListHeader
+{
+    static constexpr uint32_t c_Magic = 0x314C4848; // "HHL1"
+    static constexpr uint32_t c_Version = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t entryCount;
+    uint64_t bucketCount;
+    uint64_t stringPoolSize;
+    uint64_t idsOffset;
+    uint64_t pathOffsetsOffset;
+    uint64_t pilotsOffset;
+    uint64_t slotsOffset;
+    uint64_t stringPoolOffset;
+};
+
+/**
+ * Hash functions of the minimal perfect hash. Shared between the reader and the converter that builds the table.
+ */
+struct ZHashListHash
+{
+    static constexpr uint64_t Mix(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= value >> 33;
+
+        return value;
+    }
+
+    static constexpr uint64_t Bucket(uint64_t id, uint64_t bucketCount)
+    {
+        return Mix(id) % bucketCount;
+    }
+
+    static constexpr uint64_t Slot(uint64_t id, uint32_t pilot, uint64_t entryCount)
+    {
+        return Mix(id ^ Mix(0x9E3779B97F4A7C15ull + pilot)) % entryCount;
+    }
+};
+
+/**
+ * Read-only view over a binary hash list file.
+ */
+class ZHashList
+{
+public:
+    bool Load(const std::string& filePath)
+    {
+        Reset();
+
+        if (!mappedFile.Open(filePath))
+        {
+            return false;
+        }
+
+        const auto* data = static_cast<const char*>(mappedFile.GetData());
+        const size_t size = mappedFile.GetSize();
+
+        if (size < sizeof(SHashListHeader))
+        {
+            Reset();
+
+            return false;
+        }
+
+        std::memcpy(&header, data, sizeof(SHashListHeader));
+
+        const auto fits = [size](uint64_t offset, uint64_t count, uint64_t elementSize)
+        {
+            return offset % 8 == 0 && offset <= size && count <= (size - offset) / elementSize;
+        };
+
+        if (header.magic != SHashListHeader::c_Magic || header.version != SHashListHeader::c_Version ||
+            header.entryCount > UINT32_MAX ||
+            !fits(header.idsOffset, header.entryCount, sizeof(uint64_t)) ||
+            !fits(header.pathOffsetsOffset, header.entryCount, sizeof(uint32_t)) ||
+            !fits(header.stringPoolOffset, header.stringPoolSize, 1) ||
+            (header.bucketCount != 0 && (
+                !fits(header.pilotsOffset, header.bucketCount, sizeof(uint32_t)) ||
+                !fits(header.slotsOffset, header.entryCount, sizeof(uint32_t)))) ||
+            (header.stringPoolSize > 0 && data[header.stringPoolOffset + header.stringPoolSize - 1] != '\0'))
+        {
+            Reset();
+
+            return false;
+        }
+
+        ids = reinterpret_cast<const uint64_t*>(data + header.idsOffset);
+        pathOffsets = reinterpret_cast<const uint32_t*>(data + header.pathOffsetsOffset);
+        pilots = header.bucketCount != 0 ? reinterpret_cast<const uint32_t*>(data + header.pilotsOffset) : nullptr;
+        slots = header.bucketCount != 0 ? reinterpret_cast<const uint32_t*>(data + header.slotsOffset) : nullptr;
+        stringPool = data + header.stringPoolOffset;
+
+        return true;
+    }
+
+    void Reset()
+    {
+        mappedFile.Close();
+
+        header = {};
+        ids = nullptr;
+        pathOffsets = nullptr;
+        pilots = nullptr;
+        slots = nullptr;
+        stringPool = nullptr;
+    }
+
+    bool IsLoaded() const
+    {
+        return mappedFile.IsOpen() && ids;
+    }
+
+    size_t GetSize() const
+    {
+        return header.entryCount;
+    }
+
+    /**
+     * Returns the path of the resource with the given runtime resource id, or an empty view if it isn't in the list.
+     * The view points into the mapped file and stays valid until the list is reset.
+     */
+    std::string_view Find(uint64_t id) const
+    {
+        const int64_t index = FindIndex(id);
+
+        if (index < 0 || pathOffsets[index] >= header.stringPoolSize)
+        {
+            return {};
+        }
+
+        return { stringPool + pathOffsets[index] };
+    }
+
+    bool Contains(uint64_t id) const
+    {
+        return FindIndex(id) >= 0;
+    }
+
+private:
+    int64_t FindIndex(uint64_t id) const
+    {
+        if (header.entryCount == 0)
+        {
+            return -1;
+        }
+
+        if (pilots)
+        {
+            const uint32_t pilot = pilots[ZHashListHash::Bucket(id, header.bucketCount)];
+            const uint32_t index = slots[ZHashListHash::Slot(id, pilot, header.entryCount)];
+
+            return index < header.entryCount && ids[index] == id ? static_cast<int64_t>(index) : -1;
+        }
+
+        const uint64_t* end = ids + header.entryCount;
+        const uint64_t* it = std::lower_bound(ids, end, id);
+
+        return it != end && *it == id ? it - ids : -1;
+    }
+
+    ZMappedFile mappedFile;
+    SHashListHeader header {};
+    const uint64_t* ids = nullptr;
+    const uint32_t* pathOffsets = nullptr;
+    const uint32_t* pilots = nullptr;
+    const uint32_t* slots = nullptr;
+    const char* stringPool = nullptr;
+};
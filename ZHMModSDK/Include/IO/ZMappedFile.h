@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+
+// The platform specific parts live in ZMappedFile.cpp, so this header doesn't pull Windows.h into everything
+// that reads files. The SDK exports them; tools that compile ZMappedFile.cpp themselves define ZHM_IO_STATIC.
+#if defined(_WIN32) && !defined(ZHM_IO_STATIC)
+#   if LOADER_EXPORTS
+#       define ZHM_IO_API __declspec(dllexport)
+#   else
+#       define ZHM_IO_API __declspec(dllimport)
+#   endif
+#else
+#   define ZHM_IO_API
+#endif
+
+/**
+ * Read-only memory mapping of a file on disk.
+ * Check IsOpen() after construction; a file that cannot be opened or mapped (or is empty) leaves the mapping closed.
+ */
+class ZHM_IO_API ZMappedFile
+{
+public:
+    ZMappedFile() = default;
+
+    explicit ZMappedFile(const std::string& filePath)
+    {
+        Open(filePath);
+    }
+
+    ZMappedFile(const ZMappedFile&) = delete;
+    ZMappedFile& operator=(const ZMappedFile&) = delete;
+
+    ZMappedFile(ZMappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    ZMappedFile& operator=(ZMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+            file = std::exchange(other.file, nullptr);
+            mapping = std::exchange(other.mapping, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~ZMappedFile()
+    {
+        Close();
+    }
+
+    bool Open(const std::string& filePath);
+    void Close();
+
+    bool IsOpen() const
+    {
+        return data != nullptr;
+    }
+
+    std::span<const std::byte> GetSpan() const
+    {
+        return { static_cast<const std::byte*>(data), size };
+    }
+
+    const void* GetData() const
+    {
+        return data;
+    }
+
+    size_t GetSize() const
+    {
+        return size;
+    }
+
+private:
+    void* data = nullptr;
+    size_t size = 0;
+
+    // The file and file mapping handles on Windows. Unused elsewhere.
+    void* file = nullptr;
+    void* mapping = nullptr;
+};
@@ -1,7 +1,39 @@
-#pragma once
-
 #include "IO/ZBinaryDeserializer.h"
 
+#include <memory>
+#include <mutex>
+#include <xmmintrin.h>
+
+// How many relocations ahead of the current one to prefetch. Relocation offsets are sorted in file order,
+// so this mostly helps when pointers are spread across a large data section (e.g. big TEMP / TBLU resources).
+static constexpr size_t c_RelocationPrefetchDistance = 16;
+
+template <typename T>
+static T LoadUnaligned(const std::byte* source)
+{
+    T value;
+    std::memcpy(&value, source, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void StoreUnaligned(std::byte* destination, const T& value)
+{
+    std::memcpy(destination, &value, sizeof(T));
+}
+
+static void PrefetchRelocation(const std::span<const std::byte> offsets, const size_t index, const std::byte* data)
+{
+    const size_t prefetchIndex = index + c_RelocationPrefetchDistance;
+
+    if (prefetchIndex * sizeof(unsigned int) < offsets.size())
+    {
+        const unsigned int offset = LoadUnaligned<unsigned int>(offsets.data() + prefetchIndex * sizeof(unsigned int));
+
+        _mm_prefetch(reinterpret_cast<const char*>(data + offset), _MM_HINT_T0);
+    }
+}
+
 void* ZBinaryDeserializer::Deserialize(const std::string& filePath, const TArray<ZResourceIndex>* referenceIndices)
 {
     ZBinaryReader binaryReader = ZBinaryReader(filePath);
@@ -40,43 +72,54 @@ void* ZBinaryDeserializer::Deserialize(ZBinaryReader& binaryReader, const TArray
 
     unsigned int unusedDWORD = binaryReader.Read<unsigned int>();
 
-    void* data = operator new(dataLength, std::align_val_t(alignment));
+    const auto freeData = [alignment](void* data) { operator delete(data, std::align_val_t(alignment)); };
+    std::unique_ptr<void, decltype(freeData)> data(operator new(dataLength, std::align_val_t(alignment)), freeData);
 
-    binaryReader.ReadBytes(data, dataLength);
+    binaryReader.ReadBytes(data.get(), dataLength);
 
-    ZBinaryReader dataSectionBinaryReader = ZBinaryReader(data, dataLength);
-    ZBinaryWriter dataSectionBinaryWriter = ZBinaryWriter(data, dataLength);
+    std::byte* dataBytes = static_cast<std::byte*>(data.get());
+    std::vector<std::byte> sectionBuffer;
 
     for (unsigned char i = 0; i < sectionsCount; ++i)
     {
         const unsigned int sectionType = binaryReader.Read<unsigned int>();
         const unsigned int sectionSize = binaryReader.Read<unsigned int>();
 
+        // Sections are parsed in place when the reader is backed by memory, and copied out once otherwise.
+        std::span<const std::byte> sectionData;
+
+        if (ZBinarySpanReader* spanReader = binaryReader.GetSpanReader())
+        {
+            sectionData = spanReader->ReadBytes(sectionSize);
+        }
+        else
+        {
+            sectionBuffer.resize(sectionSize);
+            binaryReader.ReadBytes(sectionBuffer.data(), sectionSize);
+            sectionData = sectionBuffer;
+        }
+
+        ZBinarySpanReader sectionReader = ZBinarySpanReader(sectionData);
+
         switch (sectionType)
         {
             case 0x12EBA5ED:
-                HandleRebaseSection(binaryReader, dataSectionBinaryReader, dataSectionBinaryWriter);
+                HandleRebaseSection(sectionReader, dataBytes, dataLength);
                 break;
             case 0x3989BF9F:
-                HandleTypeReindexingSection(binaryReader, dataSectionBinaryReader, dataSectionBinaryWriter);
+                HandleTypeReindexingSection(sectionReader, dataBytes, dataLength);
                 break;
             case 0x578FBCEE:
-                HandleRuntimeResourceIDReindexingSection(binaryReader, dataSectionBinaryReader, dataSectionBinaryWriter, referenceIndices);
+                HandleRuntimeResourceIDReindexingSection(sectionReader, dataBytes, dataLength, referenceIndices);
                 break;
             default:
-            {
-                std::stringstream stream;
-
-                stream << std::hex << sectionType;
-
-                throw std::invalid_argument(std::format("Unknown section type: 0x{}!", stream.str()));
-            }
+                throw std::invalid_argument(std::format("Unknown section type: 0x{:x}!", sectionType));
         }
     }
 
     this->alignment = alignment;
 
-    return data;
+    return data.release();
 }
 
 const unsigned char ZBinaryDeserializer::GetAlignment() const
@@ -84,60 +127,50 @@ const unsigned char ZBinaryDeserializer::GetAlignment() const
     return alignment;
 }
 
-void ZBinaryDeserializer::HandleRebaseSection(ZBinaryReader& binaryReader, ZBinaryReader& dataSectionbinaryReader, ZBinaryWriter& dataSectionBinaryWriter)
+void ZBinaryDeserializer::HandleRebaseSection(ZBinarySpanReader& sectionReader, std::byte* data, size_t dataLength)
 {
-    const unsigned int numberOfRebaseLocations = binaryReader.Read<unsigned int>();
+    const std::span<const std::byte> offsets = ReadRelocationOffsets(sectionReader, dataLength, sizeof(long long));
+    const size_t numberOfRebaseLocations = offsets.size() / sizeof(unsigned int);
+    const uintptr_t dataAddress = reinterpret_cast<uintptr_t>(data);
 
-    for (unsigned int i = 0; i < numberOfRebaseLocations; ++i)
+    for (size_t i = 0; i < numberOfRebaseLocations; ++i)
     {
-        const unsigned int rebaseLocationOffset = binaryReader.Read<unsigned int>();
-
-        dataSectionbinaryReader.Seek(rebaseLocationOffset);
-        dataSectionBinaryWriter.Seek(rebaseLocationOffset);
+        PrefetchRelocation(offsets, i, data);
 
-        const long long value = dataSectionbinaryReader.Read<long long>();
+        std::byte* location = data + LoadUnaligned<unsigned int>(offsets.data() + i * sizeof(unsigned int));
+        const long long value = LoadUnaligned<long long>(location);
 
-        if (value != -1)
-        {
-            dataSectionBinaryWriter.Write<unsigned long long>(reinterpret_cast<uintptr_t>(dataSectionbinaryReader.GetData()) + value);
-        }
-        else
-        {
-            dataSectionBinaryWriter.Write<unsigned long long>(0);
-        }
+        StoreUnaligned<uintptr_t>(location, value != -1 ? dataAddress + value : 0);
     }
 }
 
-void ZBinaryDeserializer::HandleTypeReindexingSection(ZBinaryReader& binaryReader, ZBinaryReader& dataSectionbinaryReader, ZBinaryWriter& dataSectionBinaryWriter)
+void ZBinaryDeserializer::HandleTypeReindexingSection(ZBinarySpanReader& sectionReader, std::byte* data, size_t dataLength)
 {
-    size_t sectionStartPosition = binaryReader.GetPosition();
-    unsigned int numberOfOffsetsToReindex = binaryReader.Read<unsigned int>();
-    std::unordered_map<unsigned int, size_t> typeIDsToReindex;
-
-    for (unsigned int i = 0; i < numberOfOffsetsToReindex; ++i)
-    {
-        const unsigned int typeIDOffset = binaryReader.Read<unsigned int>();
-
-        dataSectionbinaryReader.Seek(typeIDOffset);
+    const std::span<const std::byte> offsets = ReadRelocationOffsets(sectionReader, dataLength, sizeof(unsigned long long));
+    const size_t numberOfOffsetsToReindex = offsets.size() / sizeof(unsigned int);
 
-        const size_t typeIDIndex = dataSectionbinaryReader.Read<unsigned long long>();
-
-        typeIDsToReindex.insert(std::make_pair(typeIDOffset, typeIDIndex));
-    }
-
-    const unsigned int numberOfTypeNames = binaryReader.Read<unsigned int>();
+    const unsigned int numberOfTypeNames = sectionReader.Read<unsigned int>();
     std::vector<STypeID*> typeIDs = std::vector<STypeID*>(numberOfTypeNames);
 
     for (unsigned int i = 0; i < numberOfTypeNames; ++i)
     {
-        size_t currentPosition = binaryReader.GetPosition() - sectionStartPosition;
+        Align(sectionReader, 4);
 
-        Align(binaryReader, currentPosition, 4);
+        const unsigned int typeID = sectionReader.Read<unsigned int>();
+        const int typeSize = sectionReader.Read<int>();
+        const unsigned int typeNameLength = sectionReader.Read<unsigned int>();
 
-        const unsigned int typeID = binaryReader.Read<unsigned int>();
-        const int typeSize = binaryReader.Read<int>();
-        const unsigned int typeNameLength = binaryReader.Read<unsigned int>();
-        std::string typeName = binaryReader.ReadString(typeNameLength - 1);
+        if (typeNameLength == 0)
+        {
+            throw std::invalid_argument("Type name in type reindexing section is missing its terminator!");
+        }
+
+        const std::string_view typeName = sectionReader.ReadStringView(typeNameLength - 1, true);
+
+        if (typeID >= numberOfTypeNames)
+        {
+            throw std::invalid_argument(std::format("Type index {} of {} is out of range!", typeID, typeName));
+        }
 
         STypeID* type = GetTypeIDFromTypeName(typeName);
 
@@ -149,56 +182,112 @@ void ZBinaryDeserializer::HandleTypeReindexingSection(ZBinaryReader& binaryReade
         typeIDs[typeID] = type;
     }
 
-    for (auto it = typeIDsToReindex.begin(); it != typeIDsToReindex.end(); it++)
+    for (size_t i = 0; i < numberOfOffsetsToReindex; ++i)
     {
-        const unsigned int typeIDOffset = it->first;
-        const size_t typeIDIndex = it->second;
+        PrefetchRelocation(offsets, i, data);
 
-        dataSectionBinaryWriter.Seek(typeIDOffset);
-        dataSectionBinaryWriter.Write<unsigned long long>(reinterpret_cast<uintptr_t>(typeIDs[typeIDIndex]));
+        std::byte* location = data + LoadUnaligned<unsigned int>(offsets.data() + i * sizeof(unsigned int));
+        const unsigned long long typeIDIndex = LoadUnaligned<unsigned long long>(location);
+
+        if (typeIDIndex >= typeIDs.size())
+        {
+            throw std::invalid_argument(std::format("Type index {} is out of range!", typeIDIndex));
+        }
+
+        StoreUnaligned<uintptr_t>(location, reinterpret_cast<uintptr_t>(typeIDs[typeIDIndex]));
     }
 }
 
-void ZBinaryDeserializer::HandleRuntimeResourceIDReindexingSection(ZBinaryReader& binaryReader, ZBinaryReader& dataSectionbinaryReader, ZBinaryWriter& dataSectionBinaryWriter, const TArray<ZResourceIndex>* referenceIndices)
+void ZBinaryDeserializer::HandleRuntimeResourceIDReindexingSection(ZBinarySpanReader& sectionReader, std::byte* data, size_t dataLength, const TArray<ZResourceIndex>* referenceIndices)
 {
     if (!referenceIndices)
     {
         return;
     }
 
-    const unsigned int numberOfOffsetsToReindex = binaryReader.Read<unsigned int>();
+    const std::span<const std::byte> offsets = ReadRelocationOffsets(sectionReader, dataLength, sizeof(ZRuntimeResourceID));
+    const size_t numberOfOffsetsToReindex = offsets.size() / sizeof(unsigned int);
+    const TArray<ZResourceContainer::SResourceInfo>& resources = (*Globals::ResourceContainer)->m_resources;
 
-    for (unsigned int i = 0; i < numberOfOffsetsToReindex; ++i)
+    for (size_t i = 0; i < numberOfOffsetsToReindex; ++i)
     {
-        const unsigned int runtimeResourceIDOffset = binaryReader.Read<unsigned int>();
+        PrefetchRelocation(offsets, i, data);
 
-        dataSectionbinaryReader.Seek(runtimeResourceIDOffset);
+        std::byte* location = data + LoadUnaligned<unsigned int>(offsets.data() + i * sizeof(unsigned int));
+        const unsigned int idLow = LoadUnaligned<unsigned int>(location + sizeof(unsigned int)); //Index of resource reference
 
-        const unsigned int idHigh = dataSectionbinaryReader.Read<unsigned int>();
-        const unsigned int idLow = dataSectionbinaryReader.Read<unsigned int>(); //Index of resource reference
+        if (idLow == UINT32_MAX)
+        {
+            continue;
+        }
 
-        if (idLow != UINT32_MAX)
+        if (idLow >= referenceIndices->size())
         {
-            ZResourceIndex referenceIndex = (*referenceIndices)[idLow];
-            ZResourceContainer::SResourceInfo resourceInfo = (*Globals::ResourceContainer)->m_resources[referenceIndex.val];
+            throw std::invalid_argument(std::format("Resource reference index {} is out of range!", idLow));
+        }
+
+        StoreUnaligned(location, resources[(*referenceIndices)[idLow].val].rid);
+    }
+}
+
+std::span<const std::byte> ZBinaryDeserializer::ReadRelocationOffsets(ZBinarySpanReader& sectionReader, size_t dataLength, size_t valueSize)
+{
+    const unsigned int numberOfOffsets = sectionReader.Read<unsigned int>();
+
+    if (numberOfOffsets > sectionReader.GetRemaining() / sizeof(unsigned int))
+    {
+        throw std::invalid_argument(std::format("Relocation section with {} offsets is truncated!", numberOfOffsets));
+    }
+
+    const std::span<const std::byte> offsets = sectionReader.ReadBytes(numberOfOffsets * sizeof(unsigned int));
 
-            dataSectionBinaryWriter.Seek(runtimeResourceIDOffset);
-            dataSectionBinaryWriter.Write(resourceInfo.rid);
+    // Validate every offset up front so the relocation loops don't have to.
+    for (size_t i = 0; i < numberOfOffsets; ++i)
+    {
+        const unsigned int offset = LoadUnaligned<unsigned int>(offsets.data() + i * sizeof(unsigned int));
+
+        if (dataLength < valueSize || offset > dataLength - valueSize)
+        {
+            throw std::invalid_argument(std::format("Relocation offset 0x{:x} is outside of the data section!", offset));
         }
     }
+
+    return offsets;
 }
 
-void ZBinaryDeserializer::Align(ZBinaryReader& binaryReader, const size_t currentPosition, const size_t alignment)
+void ZBinaryDeserializer::Align(ZBinarySpanReader& binaryReader, const size_t alignment)
 {
-    size_t misalign = currentPosition % alignment;
+    size_t misalign = binaryReader.GetPosition() % alignment;
 
     if (misalign != 0)
     {
-        binaryReader.Seek(alignment - misalign, ZBinaryReader::ESeekOrigin::current);
+        binaryReader.Seek(alignment - misalign, ZBinarySpanReader::ESeekOrigin::current);
     }
 }
 
-STypeID* ZBinaryDeserializer::GetTypeIDFromTypeName(const std::string& typeName)
+STypeID* ZBinaryDeserializer::GetTypeIDFromTypeName(std::string_view typeName)
 {
-    return (*Globals::TypeRegistry)->m_types.find(typeName.c_str())->second;
+    {
+        std::shared_lock lock(m_TypeIDCacheMutex);
+
+        const auto it = m_TypeIDCache.find(typeName);
+
+        if (it != m_TypeIDCache.end())
+        {
+            return it->second;
+        }
+    }
+
+    const auto it = (*Globals::TypeRegistry)->m_types.find(ZString(typeName));
+
+    if (it == (*Globals::TypeRegistry)->m_types.end())
+    {
+        return nullptr;
+    }
+
+    std::unique_lock lock(m_TypeIDCacheMutex);
+
+    m_TypeIDCache.emplace(std::string(typeName), it->second);
+
+    return it->second;
 }
@@ -0,0 +1,399 @@
+#include "IO/ZBinarySerializer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <string_view>
+
+#include <Glacier/ZObject.h>
+
+// ZString length flag for string data that is owned by the resource rather than allocated on the heap.
+static constexpr uint32_t c_ResourceStringFlag = 0x40000000;
+
+// ZString is laid out as { int32_t m_nLength; const char* m_pChars; }.
+static constexpr size_t c_StringCharsOffset = sizeof(void*);
+
+template <typename T>
+static void StoreUnaligned(std::vector<char>& buffer, size_t offset, const T& value)
+{
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static void AppendValue(std::vector<char>& buffer, const T& value)
+{
+    const size_t offset = buffer.size();
+
+    buffer.resize(offset + sizeof(T));
+    StoreUnaligned(buffer, offset, value);
+}
+
+static void AlignBuffer(std::vector<char>& buffer, size_t startOffset, size_t alignment)
+{
+    const size_t misalign = (buffer.size() - startOffset) % alignment;
+
+    if (misalign != 0)
+    {
+        buffer.resize(buffer.size() + alignment - misalign);
+    }
+}
+
+static uint32_t ToOffset(size_t offset)
+{
+    if (offset > UINT32_MAX)
+    {
+        throw std::invalid_argument("BIN1 data section exceeds 4 GiB!");
+    }
+
+    return static_cast<uint32_t>(offset);
+}
+
+std::vector<char> ZBinarySerializer::Serialize(const void* object, STypeID* type)
+{
+    IType* typeInfo = type->typeInfo();
+
+    data.clear();
+    maxAlignment = 1;
+    rebaseOffsets.clear();
+    typeOffsets.clear();
+    resourceIDOffsets.clear();
+    types.clear();
+    typeIndices.clear();
+    references.clear();
+    referenceIndices.clear();
+
+    // Most resources are dominated by their root object, so size the buffers off of it to avoid regrowth.
+    data.reserve(static_cast<size_t>(typeInfo->m_nTypeSize) * 4);
+    rebaseOffsets.reserve(64);
+    typeOffsets.reserve(16);
+    resourceIDOffsets.reserve(16);
+
+    const size_t rootOffset = Allocate(typeInfo->m_nTypeSize, typeInfo->m_nTypeAlignment);
+
+    WriteValue(object, typeInfo, rootOffset);
+
+    return WriteResource();
+}
+
+const std::vector<ZRuntimeResourceID>& ZBinarySerializer::GetReferences() const
+{
+    return references;
+}
+
+size_t ZBinarySerializer::Allocate(size_t size, size_t alignment)
+{
+    alignment = std::max<size_t>(alignment, 1);
+    maxAlignment = (std::max)(maxAlignment, alignment);
+
+    AlignBuffer(data, 0, alignment);
+
+    const size_t offset = data.size();
+
+    data.resize(offset + size);
+
+    return offset;
+}
+
+void ZBinarySerializer::WriteValue(const void* source, IType* type, size_t offset)
+{
+    // Copy the value verbatim first. Members that hold pointers are patched afterwards.
+    std::memcpy(data.data() + offset, source, type->m_nTypeSize);
+
+    const std::string_view typeName = type->m_pTypeName;
+
+    if (typeName == "ZString")
+    {
+        WriteString(source, offset);
+    }
+    else if (typeName == "ZVariant")
+    {
+        WriteVariant(source, offset);
+    }
+    else if (typeName == "ZRuntimeResourceID")
+    {
+        WriteResourceID(source, offset);
+    }
+    else if (type->isFixedArray())
+    {
+        WriteFixedArray(source, static_cast<IArrayType*>(type), offset);
+    }
+    else if (type->isArray())
+    {
+        WriteArray(source, static_cast<IArrayType*>(type), offset);
+    }
+    else if (type->isMap() || type->isContainer() || type->isEntity() || type->isResource()
+        || typeName.starts_with("TEntityRef<") || typeName.starts_with("TResourcePtr<")
+        || typeName == "ZEntityRef" || typeName == "ZResourcePtr")
+    {
+        throw std::invalid_argument(std::format("Type {} can't be serialized to BIN1!", typeName));
+    }
+    else if (type->isClass())
+    {
+        WriteClass(source, static_cast<IClassType*>(type), offset);
+    }
+}
+
+void ZBinarySerializer::WriteClass(const void* source, IClassType* type, size_t offset)
+{
+    const auto* sourceBytes = static_cast<const char*>(source);
+
+    for (uint16_t i = 0; i < type->m_nBaseClassCount; ++i)
+    {
+        const ZClassComponent& baseClass = type->m_pBaseClasses[i];
+        IType* baseClassType = baseClass.m_pType->typeInfo();
+
+        if (baseClassType->isClass())
+        {
+            WriteClass(sourceBytes + baseClass.m_nOffset, static_cast<IClassType*>(baseClassType), offset + baseClass.m_nOffset);
+        }
+    }
+
+    for (uint16_t i = 0; i < type->m_nPropertyCount; ++i)
+    {
+        const ZClassProperty& property = type->m_pProperties[i];
+
+        WriteValue(sourceBytes + property.m_nOffset, property.m_pType->typeInfo(), offset + property.m_nOffset);
+    }
+}
+
+void ZBinarySerializer::WriteArray(const void* source, IArrayType* type, size_t offset)
+{
+    IType* elementType = type->m_pArrayElementType->typeInfo();
+    void* array = const_cast<void*>(source);
+    const size_t elementCount = type->m_pArrayFunctions->size(array);
+
+    if (elementCount == 0)
+    {
+        WritePointer(offset, -1);
+        WritePointer(offset + sizeof(void*), -1);
+        WritePointer(offset + sizeof(void*) * 2, -1);
+
+        return;
+    }
+
+    // Element data is preceded by the element count.
+    const size_t elementAlignment = std::max<size_t>(elementType->m_nTypeAlignment, alignof(uint32_t));
+
+    Allocate(0, elementAlignment);
+
+    if ((data.size() + sizeof(uint32_t)) % elementAlignment != 0)
+    {
+        Allocate(elementAlignment - (data.size() + sizeof(uint32_t)) % elementAlignment, 1);
+    }
+
+    AppendValue(data, static_cast<uint32_t>(elementCount));
+
+    const size_t elementsOffset = Allocate(elementCount * elementType->m_nTypeSize, elementType->m_nTypeAlignment);
+    size_t elementOffset = elementsOffset;
+
+    for (void* element = type->m_pArrayFunctions->begin(array); element != type->m_pArrayFunctions->end(array);
+         element = type->m_pArrayFunctions->next(array, element))
+    {
+        WriteValue(element, elementType, elementOffset);
+
+        elementOffset += elementType->m_nTypeSize;
+    }
+
+    const size_t elementsEnd = elementsOffset + elementCount * elementType->m_nTypeSize;
+
+    WritePointer(offset, elementsOffset);
+    WritePointer(offset + sizeof(void*), elementsEnd);
+    WritePointer(offset + sizeof(void*) * 2, elementsEnd);
+}
+
+void ZBinarySerializer::WriteFixedArray(const void* source, IArrayType* type, size_t offset)
+{
+    IType* elementType = type->m_pArrayElementType->typeInfo();
+    const auto* sourceBytes = static_cast<const char*>(source);
+
+    for (size_t i = 0; i < type->fixedArraySize(); ++i)
+    {
+        WriteValue(sourceBytes + i * elementType->m_nTypeSize, elementType, offset + i * elementType->m_nTypeSize);
+    }
+}
+
+void ZBinarySerializer::WriteString(const void* source, size_t offset)
+{
+    const auto* string = static_cast<const ZString*>(source);
+    const uint32_t length = string->size();
+
+    Allocate(0, alignof(uint32_t));
+    AppendValue(data, length);
+
+    const size_t charsOffset = Allocate(length + 1, 1);
+
+    std::memcpy(data.data() + charsOffset, string->c_str(), length);
+    data[charsOffset + length] = '\0';
+
+    StoreUnaligned(data, offset, length | c_ResourceStringFlag);
+    WritePointer(offset + c_StringCharsOffset, charsOffset);
+}
+
+void ZBinarySerializer::WriteVariant(const void* source, size_t offset)
+{
+    const auto* variant = static_cast<const ZObjectRef*>(source);
+    const size_t typeIDOffset = offset + offsetof(ZObjectRef, m_pTypeID);
+    const size_t dataOffset = offset + offsetof(ZObjectRef, m_pData);
+
+    if (!variant->m_pTypeID)
+    {
+        StoreUnaligned<uint64_t>(data, typeIDOffset, 0);
+        WritePointer(dataOffset, -1);
+
+        return;
+    }
+
+    IType* valueType = variant->m_pTypeID->typeInfo();
+
+    StoreUnaligned<uint64_t>(data, typeIDOffset, GetTypeIndex(valueType));
+    typeOffsets.push_back(ToOffset(typeIDOffset));
+
+    if (!variant->m_pData || valueType->m_nTypeSize == 0)
+    {
+        WritePointer(dataOffset, -1);
+
+        return;
+    }
+
+    const size_t valueOffset = Allocate(valueType->m_nTypeSize, valueType->m_nTypeAlignment);
+
+    WriteValue(variant->m_pData, valueType, valueOffset);
+    WritePointer(dataOffset, valueOffset);
+}
+
+void ZBinarySerializer::WriteResourceID(const void* source, size_t offset)
+{
+    const auto* resourceID = static_cast<const ZRuntimeResourceID*>(source);
+    uint32_t referenceIndex = UINT32_MAX;
+
+    if (resourceID->GetID() != ZRuntimeResourceID().GetID())
+    {
+        const auto [it, inserted] = referenceIndices.try_emplace(resourceID->GetID(), static_cast<uint32_t>(references.size()));
+
+        if (inserted)
+        {
+            references.push_back(*resourceID);
+        }
+
+        referenceIndex = it->second;
+    }
+
+    // Null ids keep their high bits set, so they remain null when the reference isn't reindexed on load.
+    StoreUnaligned(data, offset, ZRuntimeResourceID(referenceIndex == UINT32_MAX ? UINT32_MAX : 0, referenceIndex));
+    resourceIDOffsets.push_back(ToOffset(offset));
+}
+
+void ZBinarySerializer::WritePointer(size_t offset, long long target)
+{
+    StoreUnaligned(data, offset, target);
+    rebaseOffsets.push_back(ToOffset(offset));
+}
+
+uint32_t ZBinarySerializer::GetTypeIndex(IType* type)
+{
+    const auto [it, inserted] = typeIndices.try_emplace(type, static_cast<uint32_t>(types.size()));
+
+    if (inserted)
+    {
+        types.push_back(type);
+    }
+
+    return it->second;
+}
+
+std::vector<char> ZBinarySerializer::WriteResource()
+{
+    // Relocations are applied in file order when loading, so keep the tables sorted.
+    std::ranges::sort(rebaseOffsets);
+    std::ranges::sort(typeOffsets);
+    std::ranges::sort(resourceIDOffsets);
+
+    const uint32_t dataLength = ToOffset(data.size());
+    const unsigned char sectionsCount = 1 + !types.empty() + !resourceIDOffsets.empty();
+
+    size_t typeNamesSize = 0;
+
+    for (const IType* type : types)
+    {
+        typeNamesSize += sizeof(uint32_t) * 4 + std::strlen(type->m_pTypeName) + 1;
+    }
+
+    std::vector<char> resource;
+
+    resource.reserve(
+        16 + data.size() + sectionsCount * sizeof(uint32_t) * 3
+        + (rebaseOffsets.size() + typeOffsets.size() + resourceIDOffsets.size() + 1) * sizeof(uint32_t) + typeNamesSize
+    );
+
+    AppendValue<uint32_t>(resource, 'BIN1');
+    AppendValue<unsigned char>(resource, 0);
+    AppendValue<unsigned char>(resource, static_cast<unsigned char>(maxAlignment));
+    AppendValue<unsigned char>(resource, sectionsCount);
+    AppendValue<unsigned char>(resource, 0);
+
+    // The data length is stored big endian.
+    AppendValue<unsigned char>(resource, static_cast<unsigned char>(dataLength >> 24));
+    AppendValue<unsigned char>(resource, static_cast<unsigned char>(dataLength >> 16));
+    AppendValue<unsigned char>(resource, static_cast<unsigned char>(dataLength >> 8));
+    AppendValue<unsigned char>(resource, static_cast<unsigned char>(dataLength));
+    AppendValue<uint32_t>(resource, 0);
+
+    resource.insert(resource.end(), data.begin(), data.end());
+
+    const auto writeOffsetsSection = [&resource](uint32_t sectionType, const std::vector<uint32_t>& offsets)
+    {
+        AppendValue(resource, sectionType);
+        AppendValue(resource, ToOffset(sizeof(uint32_t) + offsets.size() * sizeof(uint32_t)));
+        AppendValue(resource, static_cast<uint32_t>(offsets.size()));
+
+        const size_t offsetsStart = resource.size();
+
+        resource.resize(offsetsStart + offsets.size() * sizeof(uint32_t));
+        std::memcpy(resource.data() + offsetsStart, offsets.data(), offsets.size() * sizeof(uint32_t));
+    };
+
+    writeOffsetsSection(0x12EBA5ED, rebaseOffsets);
+
+    if (!types.empty())
+    {
+        AppendValue<uint32_t>(resource, 0x3989BF9F);
+
+        const size_t sectionSizeOffset = resource.size();
+
+        AppendValue<uint32_t>(resource, 0);
+
+        const size_t sectionStart = resource.size();
+
+        AppendValue(resource, static_cast<uint32_t>(typeOffsets.size()));
+
+        for (const uint32_t typeOffset : typeOffsets)
+        {
+            AppendValue(resource, typeOffset);
+        }
+
+        AppendValue(resource, static_cast<uint32_t>(types.size()));
+
+        for (uint32_t i = 0; i < types.size(); ++i)
+        {
+            const std::string_view typeName = types[i]->m_pTypeName;
+
+            AlignBuffer(resource, sectionStart, 4);
+            AppendValue(resource, i);
+            AppendValue(resource, static_cast<int>(types[i]->m_nTypeSize));
+            AppendValue(resource, static_cast<uint32_t>(typeName.size() + 1));
+
+            resource.insert(resource.end(), typeName.begin(), typeName.end());
+            resource.push_back('\0');
+        }
+
+        StoreUnaligned(resource, sectionSizeOffset, ToOffset(resource.size() - sectionStart));
+    }
+
+    if (!resourceIDOffsets.empty())
+    {
+        writeOffsetsSection(0x578FBCEE, resourceIDOffsets);
+    }
+
+    return resource;
+}
@@ -0,0 +1,124 @@
+#include "IO/ZMappedFile.h"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool ZMappedFile::Open(const std::string& filePath)
+{
+    Close();
+
+#if defined(_WIN32)
+    const HANDLE fileHandle = CreateFileA(
+        filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    file = fileHandle;
+
+    LARGE_INTEGER fileSize {};
+
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        Close();
+
+        return false;
+    }
+
+    mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (!mapping)
+    {
+        Close();
+
+        return false;
+    }
+
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (!data)
+    {
+        Close();
+
+        return false;
+    }
+
+    size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = open(filePath.c_str(), O_RDONLY);
+
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    struct stat fileStat {};
+
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (view == MAP_FAILED)
+    {
+        return false;
+    }
+
+    data = view;
+    size = static_cast<size_t>(fileStat.st_size);
+#endif
+
+    return true;
+}
+
+void ZMappedFile::Close()
+{
+#if defined(_WIN32)
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+
+    if (mapping)
+    {
+        CloseHandle(mapping);
+    }
+
+    if (file)
+    {
+        CloseHandle(file);
+    }
+#else
+    if (data)
+    {
+        munmap(data, size);
+    }
+#endif
+
+    data = nullptr;
+    size = 0;
+    file = nullptr;
+    mapping = nullptr;
+}
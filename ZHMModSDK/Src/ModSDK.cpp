@@ -9,6 +9,7 @@
 #include "Logging.h"
 #include "IPluginInterface.h"
 #include "PinRegistry.h"
+#include "ResourceReferenceIndex.h"
 #include "Util/ProcessUtils.h"
 
 #include "Rendering/Renderers/DirectXTKRenderer.h"
@@ -123,6 +124,8 @@ ModSDK::ModSDK() {
 	m_ImguiRenderer = std::make_shared<Rendering::Renderers::ImGuiRenderer>();
 	m_D3D12Hooks = std::make_shared<Rendering::D3D12Hooks>();
 
+	m_ResourceReferenceIndex = std::make_shared<ResourceReferenceIndex>();
+
 	HMODULE s_Module = GetModuleHandleA(nullptr);
 
 	m_ModuleBase = reinterpret_cast<uintptr_t>(s_Module) + Util::ProcessUtils::GetBaseOfCode(s_Module);
@@ -139,6 +142,8 @@ ModSDK::~ModSDK() {
 	m_ImguiRenderer.reset();
 	m_DirectXTKRenderer.reset();
 
+	m_ResourceReferenceIndex.reset();
+
 	HookRegistry::DestroyHooks();
 	Trampolines::ClearTrampolines();
 
@@ -488,6 +493,9 @@ bool ModSDK::Startup() {
 	Hooks::Engine_Init->AddDetour(this, &ModSDK::Engine_Init);
 	Hooks::EOS_Platform_Create->AddDetour(this, &ModSDK::EOS_Platform_Create);
 
+	// Rebuild the reverse resource reference index once a new scene has been loaded.
+	Hooks::ZEntitySceneContext_LoadScene->AddDetour(this, &ModSDK::ZEntitySceneContext_LoadScene);
+
 	m_D3D12Hooks->Startup();
 
 	// Patch mutex creation to allow multiple instances.
@@ -623,6 +631,8 @@ void ModSDK::OnEngineInit() {
 		m_ImguiRenderer->OnEngineInit();
 	}
 
+	m_ResourceReferenceIndex->Init();
+
 	m_ModLoader->LockRead();
 
 	for (auto& s_Mod: m_ModLoader->GetLoadedMods())
@@ -981,6 +991,10 @@ void ModSDK::ReloadPluginSettings(IPluginInterface* p_Plugin) {
 	s_Settings->Reload();
 }
 
+bool ModSDK::GetResourceReferrers(const ZRuntimeResourceID& p_ResourceId, std::vector<ZRuntimeResourceID>& p_Referrers) {
+	return m_ResourceReferenceIndex->GetReferrers(p_ResourceId, p_Referrers);
+}
+
 DEFINE_DETOUR_WITH_CONTEXT(ModSDK, bool, Engine_Init, void* th, void* a2) {
 	auto s_Result = p_Hook->CallOriginal(th, a2);
 
@@ -989,6 +1003,15 @@ DEFINE_DETOUR_WITH_CONTEXT(ModSDK, bool, Engine_Init, void* th, void* a2) {
 	return HookResult<bool>(HookAction::Return(), s_Result);
 }
 
+DEFINE_DETOUR_WITH_CONTEXT(ModSDK, void, ZEntitySceneContext_LoadScene, ZEntitySceneContext* th, ZSceneData& p_SceneData) {
+	p_Hook->CallOriginal(th, p_SceneData);
+
+	// Scenes are loaded on the game thread, so the resource container can be read here.
+	m_ResourceReferenceIndex->Rebuild();
+
+	return HookResult<void>(HookAction::Return());
+}
+
 typedef int32_t EOS_Bool;
 #define EOS_TRUE 1
 #define EOS_FALSE 0
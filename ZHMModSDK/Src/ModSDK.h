@@ -31,6 +31,7 @@ namespace UI
 class IRenderer;
 class IPluginInterface;
 class ModLoader;
+class ResourceReferenceIndex;
 class DebugConsole;
 struct IDXGISwapChain3;
 
@@ -126,10 +127,12 @@ public:
 	bool HasPluginSetting(IPluginInterface* p_Plugin, const ZString& p_Section, const ZString& p_Name) override;
 	void RemovePluginSetting(IPluginInterface* p_Plugin, const ZString& p_Section, const ZString& p_Name) override;
 	void ReloadPluginSettings(IPluginInterface* p_Plugin) override;
+	bool GetResourceReferrers(const ZRuntimeResourceID& p_ResourceId, std::vector<ZRuntimeResourceID>& p_Referrers) override;
 
 private:
     DECLARE_DETOUR_WITH_CONTEXT(ModSDK, bool, Engine_Init, void* th, void* a2);
     DECLARE_DETOUR_WITH_CONTEXT(ModSDK, EOS_PlatformHandle*, EOS_Platform_Create, EOS_Platform_Options* Options);
+    DECLARE_DETOUR_WITH_CONTEXT(ModSDK, void, ZEntitySceneContext_LoadScene, ZEntitySceneContext* th, ZSceneData& p_SceneData);
 
 private:
     bool m_UiEnabled = true;
@@ -153,4 +156,6 @@ private:
     std::shared_ptr<UI::Console> m_UIConsole {};
     std::shared_ptr<UI::MainMenu> m_UIMainMenu {};
     std::shared_ptr<UI::ModSelector> m_UIModSelector {};
+
+    std::shared_ptr<ResourceReferenceIndex> m_ResourceReferenceIndex {};
 };
@@ -0,0 +1,138 @@
+#include "ResourceReferenceIndex.h"
+
+#include "Functions.h"
+#include "Globals.h"
+#include "Logging.h"
+
+#include "Glacier/ZGameLoopManager.h"
+#include "Glacier/ZResource.h"
+
+ResourceReferenceIndex::~ResourceReferenceIndex() {
+	if (!m_FrameUpdateRegistered)
+		return;
+
+	const ZMemberDelegate<ResourceReferenceIndex, void(const SGameUpdateEvent&)> s_Delegate(this, &ResourceReferenceIndex::OnFrameUpdate);
+	Globals::GameLoopManager->UnregisterFrameUpdate(s_Delegate, 0, EUpdateMode::eUpdateAlways);
+}
+
+void ResourceReferenceIndex::Init() {
+	const ZMemberDelegate<ResourceReferenceIndex, void(const SGameUpdateEvent&)> s_Delegate(this, &ResourceReferenceIndex::OnFrameUpdate);
+	Globals::GameLoopManager->RegisterFrameUpdate(s_Delegate, 0, EUpdateMode::eUpdateAlways);
+
+	m_FrameUpdateRegistered = true;
+}
+
+void ResourceReferenceIndex::Rebuild() {
+	if (!Globals::ResourceContainer || !*Globals::ResourceContainer)
+		return;
+
+	auto s_Graph = Build();
+
+	std::unique_lock s_Lock(m_GraphMutex);
+	m_Graph = std::move(s_Graph);
+}
+
+void ResourceReferenceIndex::OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent) {
+	if (!m_RebuildRequested.exchange(false) || !Globals::ResourceContainer || !*Globals::ResourceContainer)
+		return;
+
+	size_t s_GraphSize = 0;
+
+	{
+		std::shared_lock s_Lock(m_GraphMutex);
+
+		if (m_Graph)
+			s_GraphSize = m_Graph->ResourceIds.size();
+	}
+
+	// Resources installed since the last build (e.g. streamed in after the scene was loaded) aren't covered by the graph yet.
+	if (s_GraphSize != (*Globals::ResourceContainer)->m_resourcesSize)
+		Rebuild();
+}
+
+bool ResourceReferenceIndex::GetReferrers(const ZRuntimeResourceID& p_ResourceId, std::vector<ZRuntimeResourceID>& p_Referrers) {
+	// Queries keep using the current graph until the game thread has rebuilt it.
+	m_RebuildRequested = true;
+
+	std::shared_ptr<const Graph> s_Graph;
+
+	{
+		std::shared_lock s_Lock(m_GraphMutex);
+		s_Graph = m_Graph;
+	}
+
+	if (!s_Graph)
+		return false;
+
+	const auto s_IndexIt = s_Graph->Indices.find(p_ResourceId.GetID());
+
+	if (s_IndexIt == s_Graph->Indices.end())
+		return false;
+
+	const auto s_Index = s_IndexIt->second;
+
+	const uint32_t s_Begin = s_Graph->Offsets[s_Index];
+	const uint32_t s_End = s_Graph->Offsets[s_Index + 1];
+
+	p_Referrers.reserve(p_Referrers.size() + (s_End - s_Begin));
+
+	for (uint32_t i = s_Begin; i < s_End; ++i)
+		p_Referrers.push_back(s_Graph->ResourceIds[s_Graph->Referrers[i]]);
+
+	return true;
+}
+
+std::shared_ptr<const ResourceReferenceIndex::Graph> ResourceReferenceIndex::Build() {
+	ZResourceContainer* s_ResourceContainer = *Globals::ResourceContainer;
+	const uint32_t s_ResourceCount = s_ResourceContainer->m_resourcesSize;
+
+	auto s_Graph = std::make_shared<Graph>();
+	s_Graph->ResourceIds.resize(s_ResourceCount);
+	s_Graph->Offsets.assign(s_ResourceCount + 1, 0);
+
+	size_t s_TotalReferences = 0;
+
+	s_Graph->Indices.reserve(s_ResourceCount);
+
+	for (uint32_t i = 0; i < s_ResourceCount; ++i) {
+		s_Graph->ResourceIds[i] = s_ResourceContainer->m_resources[i].rid;
+		s_Graph->Indices.emplace(s_Graph->ResourceIds[i].GetID(), i);
+		s_TotalReferences += s_ResourceContainer->m_resources[i].numReferences;
+	}
+
+	// Collect (referenced, referrer) edges, counting the in-degree of every resource as we go.
+	std::vector<std::pair<uint32_t, uint32_t>> s_Edges;
+	s_Edges.reserve(s_TotalReferences);
+
+	for (uint32_t i = 0; i < s_ResourceCount; ++i) {
+		if (s_ResourceContainer->m_resources[i].numReferences == 0)
+			continue;
+
+		TArray<ZResourceIndex> s_ReferenceIndices;
+		TArray<unsigned char> s_ReferenceFlags;
+
+		Functions::ZResourceContainer_GetResourceReferences->Call(s_ResourceContainer, ZResourceIndex(i), s_ReferenceIndices, s_ReferenceFlags);
+
+		for (const auto& s_ReferenceIndex : s_ReferenceIndices) {
+			if (s_ReferenceIndex.val < 0 || static_cast<uint32_t>(s_ReferenceIndex.val) >= s_ResourceCount)
+				continue;
+
+			s_Edges.emplace_back(static_cast<uint32_t>(s_ReferenceIndex.val), i);
+			++s_Graph->Offsets[s_ReferenceIndex.val + 1];
+		}
+	}
+
+	for (uint32_t i = 0; i < s_ResourceCount; ++i)
+		s_Graph->Offsets[i + 1] += s_Graph->Offsets[i];
+
+	s_Graph->Referrers.resize(s_Edges.size());
+
+	std::vector<uint32_t> s_Cursors(s_Graph->Offsets.begin(), s_Graph->Offsets.end() - 1);
+
+	for (const auto& [s_Referenced, s_Referrer] : s_Edges)
+		s_Graph->Referrers[s_Cursors[s_Referenced]++] = s_Referrer;
+
+	Logger::Debug("Built reverse resource reference index with {} resources and {} references.", s_ResourceCount, s_Edges.size());
+
+	return s_Graph;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Glacier/SGameUpdateEvent.h"
+#include "Glacier/ZResourceID.h"
+
+/**
+ * Reverse resource reference graph (referenced resource -> resources referencing it).
+ * The graph is stored in CSR form: the referrers of the resource at index i are
+ * m_Referrers[m_Offsets[i]] to m_Referrers[m_Offsets[i + 1]]. It is built on the game
+ * thread after every scene load, since that's the only thread the resource container can
+ * safely be read on. Queries don't touch the container, and have the graph rebuilt on the
+ * next frame if more resources have been installed since.
+ */
+class ResourceReferenceIndex {
+public:
+	~ResourceReferenceIndex();
+
+	// Registers for frame updates. Called once the engine is initialized.
+	void Init();
+
+	// Must be called on the game thread.
+	void Rebuild();
+
+	// Can be called from any thread.
+	bool GetReferrers(const ZRuntimeResourceID& p_ResourceId, std::vector<ZRuntimeResourceID>& p_Referrers);
+
+private:
+	struct Graph {
+		std::vector<ZRuntimeResourceID> ResourceIds;
+		std::vector<uint32_t> Offsets;
+		std::vector<uint32_t> Referrers;
+
+		// Index of every resource in ResourceIds, by its id.
+		std::unordered_map<uint64_t, uint32_t> Indices;
+	};
+
+	void OnFrameUpdate(const SGameUpdateEvent& p_UpdateEvent);
+
+	static std::shared_ptr<const Graph> Build();
+
+private:
+	bool m_FrameUpdateRegistered = false;
+
+	// Set by queries, so the game thread checks if the graph is stale on the next frame.
+	std::atomic<bool> m_RebuildRequested = false;
+
+	std::shared_mutex m_GraphMutex;
+	std::shared_ptr<const Graph> m_Graph;
+};